@@ -0,0 +1,101 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+// Benchmark for compressed signal history (HistoryBuffer::AddCompressedSignal()):
+// memory, compression ratio, and costs of snapshots and reads compared to
+// uncompressed signals
+//
+// usage: benchCompression [depth]
+//
+#include <cmath>
+
+#include "benchmark.h"
+#include "safecass/historyBuffer.h"
+
+using namespace SC;
+
+namespace {
+
+//! Slowly varying sensor signals
+struct Signals {
+    ParamEigen<double> Temperature; // 12-bit ADC reading, quantized
+    ParamEigen<float>  Pressure;    // changes every 10 samples
+    ParamEigen<int>    Encoder;     // position in counts
+
+    void Update(size_t i) {
+        Temperature = std::floor((36.5 + std::sin(0.0005 * i)) * 4096.0 / 50.0) * 50.0 / 4096.0;
+        Pressure = (float) (101.3 + 0.1 * (double) (i / 10 % 7));
+        Encoder = (int) (1000.0 * std::sin(0.001 * i));
+        Temperature.SetTimestamp(1000000LL * i);
+        Pressure.SetTimestamp(1000000LL * i);
+        Encoder.SetTimestamp(1000000LL * i);
+        Temperature.SetValid();
+        Pressure.SetValid();
+        Encoder.SetValid();
+    }
+};
+
+void Measure(const std::string & name, size_t depth, bool compressed)
+{
+    Signals signals;
+    HistoryBuffer hb(depth);
+    HistoryBufferBase::IndexType indices[3];
+    if (compressed) {
+        indices[0] = hb.AddCompressedSignal(signals.Temperature, "temperature");
+        indices[1] = hb.AddCompressedSignal(signals.Pressure, "pressure");
+        indices[2] = hb.AddCompressedSignal(signals.Encoder, "encoder");
+    } else {
+        indices[0] = hb.AddSignal(signals.Temperature, "temperature");
+        indices[1] = hb.AddSignal(signals.Pressure, "pressure");
+        indices[2] = hb.AddSignal(signals.Encoder, "encoder");
+    }
+
+    const size_t n = 2 * depth;
+    Stopwatch watch;
+    for (size_t i = 0; i < n; ++i) {
+        signals.Update(i);
+        hb.Snapshot();
+    }
+    PrintResult(name + ": snapshot", watch.Elapsed() / n, "ns/snapshot");
+
+    // Latest values through base class
+    ParamEigen<double> latest;
+    const size_t reads = 100000;
+    double sum = 0.0;
+    watch.Reset();
+    for (size_t i = 0; i < reads; ++i) {
+        hb.GetNewValue(indices[0], latest);
+        sum += latest.Val;
+    }
+    PrintResult(name + ": GetNewValue()", watch.Elapsed() / reads, "ns/read");
+    DoNotOptimize(sum);
+
+    const char * names[] = { "temperature", "pressure", "encoder" };
+    for (size_t i = 0; i < 3; ++i)
+        PrintResult(name + ": ratio " + names[i], hb.GetCompressionRatio(indices[i]), "x");
+    PrintResult(name + ": memory", hb.GetMemoryUsage() / 1024.0, "KB");
+}
+
+};
+
+int RunBenchmark(int argc, char * argv[])
+{
+    const size_t depth = (argc > 1 ? atoi(argv[1]) : 100000);
+
+    std::cout << "Compressed signal history: 3 signals (double, float, int), depth "
+              << depth << std::endl;
+
+    Measure("uncompressed", depth, false);
+    Measure("compressed", depth, true);
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+// Benchmark for delivery of events from filter to event sink: typed events
+// vs. JSON-encoded events (serialized by filter, parsed by sink as
+// Coordinator does)
+//
+// usage: benchFilterEvent
+//
+#include "benchmark.h"
+#include "safecass/filterThresholdBank.h"
+
+using namespace SC;
+
+// Receives typed events
+class TypedSink: public FilterEventSink
+{
+public:
+    size_t Count;
+    TypedSink(void): Count(0) {}
+    void OnFilterEvent(const FilterBase * filter, TimestampType timestamp, const std::string & event) {}
+    void OnFilterEvent(const FilterBase * filter, const FilterEvent & event) {
+        Count += StringTable::GetInstance()->GetString(event.Name).size();
+    }
+};
+
+// Receives JSON-encoded events, parsed if Parse is true
+class JsonSink: public FilterEventSink
+{
+public:
+    size_t Count;
+    bool Parse;
+    JsonSink(bool parse): Count(0), Parse(parse) {}
+    void OnFilterEvent(const FilterBase * filter, TimestampType timestamp, const std::string & event) {
+        if (!Parse) {
+            Count += event.size();
+            return;
+        }
+        Json::Value json;
+        Json::Reader reader;
+        reader.parse(event, json);
+        Count += json["event"]["name"].asString().size();
+    }
+};
+
+// Runs filter with input crossing threshold at every tick; returns time per event
+static double Run(FilterEventSink & sink, size_t numTicks)
+{
+    FilterThresholdBank bank(FilterBase::FILTERING_INTERNAL,
+                             FilterBase::StateMachineInfo(State::STATEMACHINE_PROVIDED, "robot", "control"));
+    bank.AddSignal("x", 1.0, 0.0, "EVT_X", "/EVT_X");
+    bank.Enable();
+    bank.SetEventSink(&sink);
+
+    ParamEigen<double> x(0.0);
+    bank.GetInputSignalElement(0)->SetSource(&x);
+
+    FilterBase & filter = bank;
+    Stopwatch watch;
+    for (size_t t = 0; t < numTicks; ++t) {
+        x.Val = (t & 1) ? 0.0 : 2.0;
+        x.SetTimestamp((TimestampType) (t + 1) * 1000000LL);
+        filter.RunFilter();
+    }
+
+    return watch.Elapsed() / (double) numTicks;
+}
+
+int RunBenchmark(int argc, char * argv[])
+{
+    const size_t numTicks = 200000;
+
+    TypedSink typed;
+    PrintResult("typed event", Run(typed, numTicks), "ns/event");
+
+    JsonSink serialized(false);
+    PrintResult("JSON event (serialized)", Run(serialized, numTicks), "ns/event");
+
+    JsonSink parsed(true);
+    PrintResult("JSON event (serialized, parsed)", Run(parsed, numTicks), "ns/event");
+
+    return 0;
+}
@@ -0,0 +1,124 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+// Benchmark for chained filters: outputs passed through history buffer (each
+// filter copies its input from the latest snapshot) vs. FilterPipeline (each
+// filter reads output of upstream filter in place)
+//
+// usage: benchFilterPipeline [number of stages]
+//
+#include <vector>
+#include <sstream>
+
+#include "benchmark.h"
+#include "safecass/filterPipeline.h"
+#include "safecass/historyBuffer.h"
+
+using namespace SC;
+
+typedef ParamEigen<double> ParamType;
+
+// Filter: output = input * 0.5 + 1
+class FilterStage: public FilterBase
+{
+public:
+    ParamType In;
+    ParamType Out;
+
+    FilterStage(const std::string & input, const std::string & output)
+        : FilterBase(output, FILTERING_INTERNAL, StateMachineInfo(State::STATEMACHINE_APP, "bench")),
+          In(0.0), Out(0.0)
+    {
+        AddInputSignal(In, input);
+        AddOutputSignal(Out, output);
+    }
+
+    bool ConfigureFilter(const Json::Value & jsonNode) { return true; }
+    bool InitFilter(void) { return true; }
+    void RunFilter(void) {
+        Out.Val = GetInputValue<ParamType>(0).Val * 0.5 + 1.0;
+    }
+    void CleanupFilter(void) {}
+};
+
+static void RunChain(const std::vector<FilterStage *> & filters, size_t numTicks)
+{
+    const size_t numStages = filters.size();
+
+    // Outputs through history buffer: output of each stage is available to
+    // the next stage after snapshot, i.e., one tick later
+    HistoryBuffer history(1024);
+    std::vector<SignalHandle<double> > handles;
+    for (size_t i = 0; i < numStages; ++i)
+        handles.push_back(history.AddSignal(filters[i]->Out, filters[i]->GetOutputSignalName(0)));
+
+    Stopwatch watch;
+    for (size_t t = 0; t < numTicks; ++t) {
+        for (size_t i = numStages; i-- > 0; ) {
+            if (i + 1 < numStages)
+                handles[i + 1].GetLatest(filters[i]->In);
+            filters[i]->RunFilter();
+        }
+        history.Snapshot();
+    }
+    PrintResult("RunFilter() with history buffer", watch.Elapsed() / numTicks, "ns/tick");
+    DoNotOptimize(filters[0]->Out.Val);
+
+    // Outputs in place: output of each stage is available to the next stage
+    // at the same tick
+    FilterPipeline pipeline;
+    for (size_t i = 0; i < numStages; ++i)
+        pipeline.AddFilter(filters[i]);
+    watch.Reset();
+    pipeline.Build();
+    PrintResult("FilterPipeline::Build()", watch.Elapsed(), "ns");
+
+    pipeline.EnableLatencyMeasurement(false);
+    watch.Reset();
+    for (size_t t = 0; t < numTicks; ++t)
+        pipeline.Run();
+    PrintResult("FilterPipeline::Run()", watch.Elapsed() / numTicks, "ns/tick");
+    DoNotOptimize(filters[0]->Out.Val);
+
+    pipeline.EnableLatencyMeasurement(true);
+    watch.Reset();
+    for (size_t t = 0; t < numTicks; ++t)
+        pipeline.Run();
+    PrintResult("FilterPipeline::Run() with latency", watch.Elapsed() / numTicks, "ns/tick");
+    DoNotOptimize(filters[0]->Out.Val);
+
+    pipeline.ReportLatency(std::cout);
+}
+
+int RunBenchmark(int argc, char * argv[])
+{
+    const size_t numStages = (argc > 1 ? atoi(argv[1]) : 8);
+    const size_t numTicks  = 100000;
+
+    std::cout << "Chained filters: " << numStages << " stages" << std::endl;
+
+    // Filters are added in reverse order; the pipeline sorts them
+    std::vector<FilterStage *> filters;
+    for (size_t i = 0; i < numStages; ++i) {
+        std::stringstream in, out;
+        in << "s" << (numStages - 1 - i);
+        out << "s" << (numStages - i);
+        filters.push_back(new FilterStage(in.str(), out.str()));
+    }
+
+    RunChain(filters, numTicks);
+
+    for (size_t i = 0; i < filters.size(); ++i)
+        delete filters[i];
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+// Benchmark for external filters: one monitoring thread running all filters
+// vs. FilterScheduler with worker threads
+//
+// usage: benchFilterScheduler [number of filters] [max number of threads]
+//
+#include <vector>
+#include <sstream>
+
+#include "benchmark.h"
+#include "safecass/filterScheduler.h"
+
+using namespace SC;
+
+typedef ParamEigen<double> ParamType;
+
+// External filter of uneven cost
+class FilterWork: public FilterBase
+{
+public:
+    ParamType In;
+    ParamType Out;
+    size_t Work;
+
+    FilterWork(const std::string & name, size_t work)
+        : FilterBase(name, FILTERING_EXTERNAL, StateMachineInfo(State::STATEMACHINE_APP, "bench")),
+          In(1.0), Out(0.0), Work(work)
+    {
+        AddInputSignal(In, name + ":in");
+        AddOutputSignal(Out, name + ":out");
+    }
+
+    bool ConfigureFilter(const Json::Value & jsonNode) { return true; }
+    bool InitFilter(void) { return true; }
+    void RunFilter(void) {
+        double x = GetInputValue<ParamType>(0).Val;
+        for (size_t i = 0; i < Work; ++i)
+            x = x * 0.999999 + 1e-6;
+        Out.Val = x;
+    }
+    void CleanupFilter(void) {}
+};
+
+int RunBenchmark(int argc, char * argv[])
+{
+    const size_t numFilters = (argc > 1 ? atoi(argv[1]) : 256);
+    const size_t maxThreads = (argc > 2 ? atoi(argv[2]) : 8);
+    const size_t numTicks   = 200;
+
+    std::cout << "External filters: " << numFilters << " filters (uneven cost)" << std::endl;
+
+    std::vector<FilterWork *> filters;
+    for (size_t i = 0; i < numFilters; ++i) {
+        std::stringstream ss;
+        ss << "filter" << i;
+        filters.push_back(new FilterWork(ss.str(), 200 + (i % 8) * 400));
+    }
+
+    Stopwatch watch;
+    for (size_t t = 0; t < numTicks; ++t)
+        for (size_t i = 0; i < numFilters; ++i)
+            filters[i]->RunFilter();
+    PrintResult("RunFilter() on one thread", watch.Elapsed() / numTicks / 1e3, "us/tick");
+    DoNotOptimize(filters[0]->Out.Val);
+
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        FilterScheduler scheduler(threads);
+        for (size_t i = 0; i < numFilters; ++i)
+            scheduler.AddFilter(filters[i]);
+        scheduler.Build();
+
+        watch.Reset();
+        for (size_t t = 0; t < numTicks; ++t)
+            scheduler.Run();
+        std::stringstream ss;
+        ss << "FilterScheduler::Run(), " << threads << " threads";
+        PrintResult(ss.str(), watch.Elapsed() / numTicks / 1e3, "us/tick");
+        DoNotOptimize(filters[0]->Out.Val);
+
+        if (threads * 2 > maxThreads)
+            scheduler.ReportUtilization(std::cout);
+    }
+
+    for (size_t i = 0; i < filters.size(); ++i)
+        delete filters[i];
+
+    return 0;
+}
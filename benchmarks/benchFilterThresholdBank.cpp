@@ -0,0 +1,128 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+// Benchmark for threshold checks of many signals: one filter per signal vs.
+// one FilterThresholdBank for all signals
+//
+// usage: benchFilterThresholdBank [number of signals]
+//
+#include <vector>
+#include <sstream>
+
+#include "benchmark.h"
+#include "safecass/filterThresholdBank.h"
+#include "safecass/filterPipeline.h"
+
+using namespace SC;
+
+typedef ParamEigen<double> ParamType;
+
+// Writes signals "x0", "x1", ...
+class FilterSource: public FilterBase
+{
+public:
+    std::vector<ParamType *> Out;
+
+    FilterSource(size_t n)
+        : FilterBase("source", FILTERING_INTERNAL, StateMachineInfo(State::STATEMACHINE_APP, "bench"))
+    {
+        for (size_t i = 0; i < n; ++i) {
+            std::stringstream ss;
+            ss << "x" << i;
+            Out.push_back(new ParamType(0.0));
+            AddOutputSignal(*Out.back(), ss.str());
+        }
+    }
+    ~FilterSource() {
+        for (size_t i = 0; i < Out.size(); ++i)
+            delete Out[i];
+    }
+
+    bool ConfigureFilter(const Json::Value & jsonNode) { return true; }
+    bool InitFilter(void) { return true; }
+    void RunFilter(void) {}
+    void CleanupFilter(void) {}
+};
+
+// Counts events
+class EventCounter: public FilterEventSink
+{
+public:
+    size_t Count;
+    EventCounter(void): Count(0) {}
+    void OnFilterEvent(const FilterBase * filter, TimestampType timestamp, const std::string & event) { ++Count; }
+};
+
+static std::string SignalName(size_t i)
+{
+    std::stringstream ss;
+    ss << "x" << i;
+    return ss.str();
+}
+
+// Runs pipeline of source and banks for numTicks; crossing at every tick if toggle is true
+static double Run(FilterSource & source, std::vector<FilterThresholdBank *> & banks, size_t numTicks, bool toggle)
+{
+    FilterPipeline pipeline;
+    pipeline.EnableLatencyMeasurement(false);
+    pipeline.AddFilter(&source);
+    for (size_t i = 0; i < banks.size(); ++i)
+        pipeline.AddFilter(banks[i]);
+    pipeline.Build();
+
+    Stopwatch watch;
+    for (size_t t = 0; t < numTicks; ++t) {
+        if (toggle)
+            source.Out[0]->Val = (t % 2 ? 10.0 : 0.0);
+        pipeline.Run();
+    }
+    return watch.Elapsed() / (double) numTicks;
+}
+
+int RunBenchmark(int argc, char * argv[])
+{
+    const size_t numSignals = (argc > 1 ? atoi(argv[1]) : 512);
+    const size_t numTicks   = 20000;
+
+    std::cout << "Threshold checks: " << numSignals << " signals" << std::endl;
+
+    FilterSource source(numSignals);
+    EventCounter counter;
+    const FilterBase::StateMachineInfo target(State::STATEMACHINE_APP, "bench");
+
+    // One filter per signal
+    std::vector<FilterThresholdBank *> filters;
+    for (size_t i = 0; i < numSignals; ++i) {
+        filters.push_back(new FilterThresholdBank(FilterBase::FILTERING_INTERNAL, target));
+        filters.back()->AddSignal(SignalName(i), 1.0, 0.1, "EVT_ABOVE", "EVT_BELOW");
+        filters.back()->SetEventSink(&counter);
+        filters.back()->Enable();
+    }
+    PrintResult("one filter per signal", Run(source, filters, numTicks, false), "ns/tick");
+
+    // One bank for all signals
+    std::vector<FilterThresholdBank *> bank;
+    bank.push_back(new FilterThresholdBank(FilterBase::FILTERING_INTERNAL, target));
+    for (size_t i = 0; i < numSignals; ++i)
+        bank.back()->AddSignal(SignalName(i), 1.0, 0.1, "EVT_ABOVE", "EVT_BELOW");
+    bank.back()->SetEventSink(&counter);
+    bank.back()->Enable();
+    PrintResult("FilterThresholdBank", Run(source, bank, numTicks, false), "ns/tick");
+    PrintResult("FilterThresholdBank, one crossing per tick", Run(source, bank, numTicks, true), "ns/tick");
+    DoNotOptimize(counter.Count);
+
+    for (size_t i = 0; i < filters.size(); ++i)
+        delete filters[i];
+    delete bank[0];
+
+    return 0;
+}
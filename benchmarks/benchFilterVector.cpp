@@ -0,0 +1,140 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+// Benchmark for checks of 7-joint vector: one scalar threshold filter per
+// element vs. one vector filter (fixed-size and dynamic-size)
+//
+// usage: benchFilterVector
+//
+#include <vector>
+#include <sstream>
+
+#include "benchmark.h"
+#include "safecass/filterThresholdBank.h"
+#include "safecass/filterVectorNorm.h"
+#include "safecass/filterVectorBounds.h"
+#include "safecass/filterVectorRate.h"
+#include "safecass/filterPipeline.h"
+
+using namespace SC;
+
+typedef Eigen::Matrix<double, 7, 1> Vector7d;
+
+static const int N = 7;
+
+// Writes vector signal "q" and its elements "q0", "q1", ...
+class FilterSource: public FilterBase
+{
+public:
+    ParamEigen<Vector7d> Fixed;
+    ParamEigen<Eigen::VectorXd> Dynamic;
+    std::vector<ParamEigen<double> *> Elements;
+
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    FilterSource(void)
+        : FilterBase("source", FILTERING_INTERNAL, StateMachineInfo(State::STATEMACHINE_APP, "bench")),
+          Fixed(Vector7d::Zero()), Dynamic(Eigen::VectorXd::Zero(N))
+    {
+        AddOutputSignal(Fixed, "q");
+        AddOutputSignal(Dynamic, "qx");
+        for (int i = 0; i < N; ++i) {
+            std::stringstream ss;
+            ss << "q" << i;
+            Elements.push_back(new ParamEigen<double>(0.0));
+            AddOutputSignal(*Elements.back(), ss.str());
+        }
+    }
+    ~FilterSource() {
+        for (size_t i = 0; i < Elements.size(); ++i)
+            delete Elements[i];
+    }
+
+    // New sample at every tick
+    void Update(size_t t) {
+        const TimestampType timestamp = (TimestampType) (t + 1) * 1000000LL;
+        for (int i = 0; i < N; ++i) {
+            const double q = 0.001 * ((t + i) % 100);
+            Fixed.Val(i) = Dynamic.Val(i) = Elements[i]->Val = q;
+            Elements[i]->SetTimestamp(timestamp);
+        }
+        Fixed.SetTimestamp(timestamp);
+        Dynamic.SetTimestamp(timestamp);
+    }
+
+    bool ConfigureFilter(const Json::Value & jsonNode) { return true; }
+    bool InitFilter(void) { return true; }
+    void RunFilter(void) {}
+    void CleanupFilter(void) {}
+};
+
+// Runs pipeline of source and filters for numTicks
+static double Run(FilterSource & source, std::vector<FilterBase *> & filters, size_t numTicks)
+{
+    FilterPipeline pipeline;
+    pipeline.EnableLatencyMeasurement(false);
+    pipeline.AddFilter(&source);
+    for (size_t i = 0; i < filters.size(); ++i) {
+        filters[i]->Enable();
+        pipeline.AddFilter(filters[i]);
+    }
+    pipeline.Build();
+
+    Stopwatch watch;
+    for (size_t t = 0; t < numTicks; ++t) {
+        source.Update(t);
+        pipeline.Run();
+    }
+    const double elapsed = watch.Elapsed() / (double) numTicks;
+
+    for (size_t i = 0; i < filters.size(); ++i)
+        delete filters[i];
+    filters.clear();
+
+    return elapsed;
+}
+
+int RunBenchmark(int argc, char * argv[])
+{
+    const size_t numTicks = 200000;
+    const FilterBase::StateMachineInfo target(State::STATEMACHINE_APP, "bench");
+    const FilterBase::FilteringType type = FilterBase::FILTERING_INTERNAL;
+
+    std::cout << "Checks of " << N << "-element vector" << std::endl;
+
+    FilterSource source;
+    std::vector<FilterBase *> filters;
+
+    // Status quo: one scalar filter per element (upper threshold only)
+    for (int i = 0; i < N; ++i) {
+        FilterThresholdBank * filter = new FilterThresholdBank(type, target);
+        std::stringstream ss;
+        ss << "q" << i;
+        filter->AddSignal(ss.str(), 1.0, 0.0, "on", "off");
+        filters.push_back(filter);
+    }
+    PrintResult("one threshold filter per element", Run(source, filters, numTicks), "ns/tick");
+
+    filters.push_back(new FilterVectorBounds<Vector7d>(type, target, "q", Vector7d::Constant(-1.0), Vector7d::Constant(1.0), "on", "off"));
+    PrintResult("FilterVectorBounds<Vector7d>", Run(source, filters, numTicks), "ns/tick");
+
+    filters.push_back(new FilterVectorBounds<>(type, target, "qx", Eigen::VectorXd::Constant(N, -1.0), Eigen::VectorXd::Constant(N, 1.0), "on", "off"));
+    PrintResult("FilterVectorBounds<VectorXd>", Run(source, filters, numTicks), "ns/tick");
+
+    filters.push_back(new FilterVectorNorm<Vector7d>(type, target, "q", 2.0, 0.0, "on", "off"));
+    PrintResult("FilterVectorNorm<Vector7d>", Run(source, filters, numTicks), "ns/tick");
+
+    filters.push_back(new FilterVectorRate<Vector7d>(type, target, "q", Vector7d::Constant(1000.0), "on", "off"));
+    PrintResult("FilterVectorRate<Vector7d>", Run(source, filters, numTicks), "ns/tick");
+
+    return 0;
+}
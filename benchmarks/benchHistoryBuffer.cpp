@@ -0,0 +1,183 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+// Benchmark for HistoryBuffer::Snapshot()
+//
+// usage: benchHistoryBuffer [number of signals] [buffer size] [number of snapshots]
+//
+#include <vector>
+#include <sstream>
+
+#include "benchmark.h"
+#include "safecass/historyBuffer.h"
+#include "safecass/historyBufferColumnar.h"
+
+using namespace SC;
+
+namespace {
+
+//! Signal objects shared by all history buffers under test
+/*!
+    Mix of scalar and fixed-size Eigen signals, which are typical signals of
+    surgical robot components (e.g., joint positions, tip positions).
+*/
+struct Signals
+{
+    std::vector<ParamEigen<double> *>          Doubles;
+    std::vector<ParamEigen<int> *>             Ints;
+    std::vector<ParamEigen<Eigen::Vector3d> *> Vectors;
+
+    Signals(size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            switch (i % 3) {
+            case 0: Doubles.push_back(new ParamEigen<double>(i)); break;
+            case 1: Ints.push_back(new ParamEigen<int>(i)); break;
+            case 2: Vectors.push_back(new ParamEigen<Eigen::Vector3d>(Eigen::Vector3d::Constant(i))); break;
+            }
+        }
+    }
+    ~Signals() {
+        for (size_t i = 0; i < Doubles.size(); ++i) delete Doubles[i];
+        for (size_t i = 0; i < Ints.size(); ++i)    delete Ints[i];
+        for (size_t i = 0; i < Vectors.size(); ++i) delete Vectors[i];
+    }
+
+    //! Emulates the component updating its signals between snapshots
+    void Update(void) {
+        for (size_t i = 0; i < Doubles.size(); ++i) Doubles[i]->Val += 1.0;
+        for (size_t i = 0; i < Ints.size(); ++i)    Ints[i]->Val += 1;
+        for (size_t i = 0; i < Vectors.size(); ++i) Vectors[i]->Val.array() += 1.0;
+    }
+
+    template<class _bufferType>
+    void AddTo(_bufferType & hb) const {
+        for (size_t i = 0; i < Doubles.size(); ++i) hb.AddSignal(*Doubles[i], Name("d", i));
+        for (size_t i = 0; i < Ints.size(); ++i)    hb.AddSignal(*Ints[i],    Name("i", i));
+        for (size_t i = 0; i < Vectors.size(); ++i) hb.AddSignal(*Vectors[i], Name("v", i));
+    }
+
+    static std::string Name(const char * prefix, size_t i) {
+        std::stringstream ss;
+        ss << prefix << i;
+        return ss.str();
+    }
+};
+
+//! Reference implementation of per-signal snapshot
+/*!
+    Reproduces how HistoryBuffer::Snapshot() used to copy signals: one virtual
+    call and one dynamic_cast per signal.  Kept as a baseline for comparison.
+*/
+template<class T>
+class PerSignalAccessor: public SignalAccessorBase
+{
+protected:
+    boost::circular_buffer<T> Container;
+
+public:
+    PerSignalAccessor(const ParamBase & object, size_t size)
+        : SignalAccessorBase(object, ""), Container(size)
+    {}
+
+    virtual void Push(void) {
+        const T * param = dynamic_cast<const T *>(&SignalObject);
+        SCASSERT(param);
+        Container.push_back(*param);
+    }
+    virtual void GetValue(ParamBase & arg) const {}
+    virtual void ToStream(std::ostream & os) const {}
+};
+
+class PerSignalHistoryBuffer
+{
+protected:
+    const size_t BufferSize;
+    std::vector<SignalAccessorBase *> Accessors;
+
+public:
+    PerSignalHistoryBuffer(size_t bufferSize): BufferSize(bufferSize) {}
+    ~PerSignalHistoryBuffer() {
+        for (size_t i = 0; i < Accessors.size(); ++i)
+            delete Accessors[i];
+    }
+
+    template<typename _type>
+    void AddSignal(const ParamEigen<_type> & arg, const std::string & name) {
+        Accessors.push_back(new PerSignalAccessor<ParamEigen<_type> >(arg, BufferSize));
+    }
+
+    void Snapshot(void) {
+        for (size_t i = 0; i < Accessors.size(); ++i)
+            Accessors[i]->Push();
+    }
+
+    inline size_t GetBufferSize(void) const { return BufferSize; }
+};
+
+//! Returns average time of Snapshot() in nanoseconds
+template<class _bufferType>
+double MeasureSnapshot(_bufferType & hb, Signals & signals, size_t snapshots)
+{
+    // Warm up: fill every row once
+    for (size_t i = 0; i < hb.GetBufferSize(); ++i)
+        hb.Snapshot();
+
+    double elapsed = 0.0;
+    Stopwatch watch;
+    for (size_t i = 0; i < snapshots; ++i) {
+        signals.Update();
+        watch.Reset();
+        hb.Snapshot();
+        elapsed += watch.Elapsed();
+    }
+
+    return elapsed / snapshots;
+}
+
+};
+
+int RunBenchmark(int argc, char * argv[])
+{
+    const size_t numSignals   = (argc > 1 ? atoi(argv[1]) : 300);
+    const size_t bufferSize   = (argc > 2 ? atoi(argv[2]) : 1024);
+    const size_t numSnapshots = (argc > 3 ? atoi(argv[3]) : 10000);
+
+    std::cout << "Snapshot(): " << numSignals << " signals, buffer size "
+              << bufferSize << ", " << numSnapshots << " snapshots" << std::endl;
+
+    Signals signals(numSignals);
+
+    double ns;
+    {
+        PerSignalHistoryBuffer hb(bufferSize);
+        signals.AddTo(hb);
+        ns = MeasureSnapshot(hb, signals, numSnapshots);
+        PrintResult("Per-signal virtual Push() (reference)", ns, "ns/snapshot");
+        PrintResult("Per-signal virtual Push() (reference)", ns / numSignals, "ns/signal");
+    }
+    {
+        HistoryBuffer hb(bufferSize);
+        signals.AddTo(hb);
+        ns = MeasureSnapshot(hb, signals, numSnapshots);
+        PrintResult("HistoryBuffer::Snapshot()", ns, "ns/snapshot");
+        PrintResult("HistoryBuffer::Snapshot()", ns / numSignals, "ns/signal");
+    }
+    {
+        HistoryBufferColumnar hb(bufferSize);
+        signals.AddTo(hb);
+        ns = MeasureSnapshot(hb, signals, numSnapshots);
+        PrintResult("HistoryBufferColumnar::Snapshot()", ns, "ns/snapshot");
+        PrintResult("HistoryBufferColumnar::Snapshot()", ns / numSignals, "ns/signal");
+    }
+
+    return 0;
+}
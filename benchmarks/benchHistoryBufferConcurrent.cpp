@@ -0,0 +1,141 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+// Benchmark for read/write latency of HistoryBufferConcurrent
+//
+// usage: benchHistoryBufferConcurrent [number of readers] [number of signals] [number of snapshots]
+//
+#include <vector>
+#include <sstream>
+
+#include <boost/thread.hpp>
+
+#include "benchmark.h"
+#include "safecass/historyBufferConcurrent.h"
+
+using namespace SC;
+
+namespace {
+
+//! Writer: takes snapshots and measures average latency of Snapshot()
+struct Writer
+{
+    HistoryBufferConcurrent & HB;
+    std::vector<ParamEigen<double> *> & Signals;
+    const size_t Snapshots;
+    boost::atomic<bool> & Done;
+    double Latency;
+
+    Writer(HistoryBufferConcurrent & hb, std::vector<ParamEigen<double> *> & signals,
+           size_t snapshots, boost::atomic<bool> & done)
+        : HB(hb), Signals(signals), Snapshots(snapshots), Done(done), Latency(0.0)
+    {}
+
+    void operator()(void) {
+        Stopwatch watch;
+        double elapsed = 0.0;
+        for (size_t i = 0; i < Snapshots; ++i) {
+            for (size_t j = 0; j < Signals.size(); ++j)
+                Signals[j]->Val += 1.0;
+            watch.Reset();
+            HB.Snapshot();
+            elapsed += watch.Elapsed();
+        }
+        Latency = elapsed / Snapshots;
+        Done.store(true);
+    }
+};
+
+//! Reader: reads latest value of all signals until writer is done
+struct Reader
+{
+    const HistoryBufferConcurrent & HB;
+    const size_t NumSignals;
+    boost::atomic<bool> & Done;
+    double Latency;
+
+    Reader(const HistoryBufferConcurrent & hb, size_t numSignals, boost::atomic<bool> & done)
+        : HB(hb), NumSignals(numSignals), Done(done), Latency(0.0)
+    {}
+
+    void operator()(void) {
+        ParamEigen<double> value;
+        Stopwatch watch;
+        double elapsed = 0.0;
+        size_t reads = 0;
+        while (!Done.load()) {
+            for (size_t j = 0; j < NumSignals; ++j) {
+                watch.Reset();
+                if (HB.GetNewValue((HistoryBufferBase::IndexType) j, value)) {
+                    elapsed += watch.Elapsed();
+                    ++reads;
+                }
+            }
+        }
+        Latency = (reads ? elapsed / reads : 0.0);
+    }
+};
+
+};
+
+int RunBenchmark(int argc, char * argv[])
+{
+    const size_t numReaders   = (argc > 1 ? atoi(argv[1]) : 2);
+    const size_t numSignals   = (argc > 2 ? atoi(argv[2]) : 100);
+    const size_t numSnapshots = (argc > 3 ? atoi(argv[3]) : 100000);
+
+    std::cout << "HistoryBufferConcurrent: " << numReaders << " readers, " << numSignals
+              << " signals, " << numSnapshots << " snapshots" << std::endl;
+
+    std::vector<ParamEigen<double> *> signals;
+    HistoryBufferConcurrent hb(1024);
+    for (size_t i = 0; i < numSignals; ++i) {
+        std::stringstream ss;
+        ss << "s" << i;
+        signals.push_back(new ParamEigen<double>(0.0));
+        hb.AddSignal(*signals.back(), ss.str());
+    }
+    hb.Snapshot();
+
+    // Without readers
+    {
+        boost::atomic<bool> done(false);
+        Writer writer(hb, signals, numSnapshots, done);
+        writer();
+        PrintResult("Snapshot() without readers", writer.Latency, "ns/snapshot");
+    }
+
+    // With concurrent readers
+    {
+        boost::atomic<bool> done(false);
+        Writer writer(hb, signals, numSnapshots, done);
+        std::vector<Reader> readers(numReaders, Reader(hb, numSignals, done));
+
+        boost::thread_group threads;
+        for (size_t i = 0; i < numReaders; ++i)
+            threads.create_thread(boost::ref(readers[i]));
+        threads.create_thread(boost::ref(writer));
+        threads.join_all();
+
+        PrintResult("Snapshot() with concurrent readers", writer.Latency, "ns/snapshot");
+        for (size_t i = 0; i < numReaders; ++i) {
+            std::stringstream ss;
+            ss << "GetNewValue() reader " << i;
+            PrintResult(ss.str(), readers[i].Latency, "ns/read");
+        }
+    }
+
+    for (size_t i = 0; i < signals.size(); ++i)
+        delete signals[i];
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+// Benchmark for cross-buffer aligned reads: timestamp search in each history
+// buffer (HistoryBuffer::GetValueAt()) vs. tick arithmetic (HistoryBufferGroup)
+//
+// usage: benchHistoryBufferGroup [number of buffers] [depth]
+//
+#include <vector>
+#include <sstream>
+
+#include "benchmark.h"
+#include "safecass/historyBufferGroup.h"
+
+using namespace SC;
+
+int RunBenchmark(int argc, char * argv[])
+{
+    const size_t numBuffers = (argc > 1 ? atoi(argv[1]) : 8);
+    const size_t depth      = (argc > 2 ? atoi(argv[2]) : 4096);
+    const size_t numSignals = 10;
+
+    std::cout << "Aligned reads: " << numBuffers << " buffers, " << numSignals
+              << " signals each, depth " << depth << std::endl;
+
+    std::vector<HistoryBuffer *> buffers;
+    std::vector<ParamEigen<double> *> params;
+    std::vector<SignalHandle<double> > handles;
+    HistoryBufferGroup group;
+    for (size_t b = 0; b < numBuffers; ++b) {
+        buffers.push_back(new HistoryBuffer(depth));
+        for (size_t s = 0; s < numSignals; ++s) {
+            std::stringstream ss;
+            ss << "signal" << s;
+            params.push_back(new ParamEigen<double>((double) s));
+            handles.push_back(buffers.back()->AddSignal(*params.back(), ss.str()));
+        }
+    }
+
+    Stopwatch watch;
+    const size_t numTicks = 2 * depth;
+    for (size_t i = 0; i < numTicks; ++i)
+        for (size_t b = 0; b < numBuffers; ++b)
+            buffers[b]->Snapshot();
+    PrintResult("HistoryBuffer::Snapshot() per buffer", watch.Elapsed() / numTicks, "ns/tick");
+
+    // Buffers are aligned from the first tick after they join the group
+    for (size_t b = 0; b < numBuffers; ++b)
+        group.AddBuffer(buffers[b]);
+    watch.Reset();
+    for (size_t i = 0; i < numTicks; ++i)
+        group.Snapshot();
+    PrintResult("HistoryBufferGroup::Snapshot()", watch.Elapsed() / numTicks, "ns/tick");
+
+    // Read all signals of all buffers at random ticks
+    const size_t numReads = 100000;
+    std::vector<HistoryBufferGroup::TickType> ticks(numReads);
+    srand(0);
+    for (size_t i = 0; i < numReads; ++i)
+        ticks[i] = group.GetLatestTick() - rand() % (depth / 2);
+
+    ParamEigen<double> arg;
+    double sum = 0.0;
+    watch.Reset();
+    for (size_t i = 0; i < numReads; ++i) {
+        SC::TimestampType t;
+        group.GetTimestamp(ticks[i], t);
+        for (size_t b = 0; b < numBuffers; ++b) {
+            buffers[b]->GetValueAt(handles[b * numSignals].GetIndex(), t, arg);
+            sum += arg.Val;
+        }
+    }
+    PrintResult("GetValueAt(timestamp) per buffer", watch.Elapsed() / (numReads * numBuffers), "ns/read");
+    DoNotOptimize(sum);
+
+    sum = 0.0;
+    watch.Reset();
+    for (size_t i = 0; i < numReads; ++i) {
+        for (size_t b = 0; b < numBuffers; ++b)
+            sum += group.GetSample((HistoryBufferGroup::IndexType) b, handles[b * numSignals], ticks[i])->Val;
+    }
+    PrintResult("HistoryBufferGroup::GetSample(tick)", watch.Elapsed() / (numReads * numBuffers), "ns/read");
+    DoNotOptimize(sum);
+
+    for (size_t i = 0; i < params.size(); ++i)
+        delete params[i];
+    for (size_t i = 0; i < buffers.size(); ++i)
+        delete buffers[i];
+
+    return 0;
+}
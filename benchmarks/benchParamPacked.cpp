@@ -0,0 +1,83 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+// Benchmark for construction of parameters: ParamEigen (reads clock), ParamEigen
+// with explicit timestamp, and PackedParam
+//
+// usage: benchParamPacked [number of parameters]
+//
+#include <vector>
+
+#include "benchmark.h"
+#include "safecass/paramPacked.h"
+
+using namespace SC;
+
+int RunBenchmark(int argc, char * argv[])
+{
+    const size_t n = (argc > 1 ? atoi(argv[1]) : 1000000);
+
+    std::cout << "Construction of " << n << " parameters" << std::endl;
+
+    const SC::TimestampType timestamp = GetCurrentTimestamp();
+    double sum;
+    Stopwatch watch;
+
+    // Value constructor reads clock
+    sum = 0.0;
+    watch.Reset();
+    for (size_t i = 0; i < n; ++i) {
+        ParamEigen<double> param((double) i);
+        DoNotOptimize(param);
+        sum += param.Val;
+    }
+    PrintResult("ParamEigen<double>(val)", watch.Elapsed() / n, "ns/param");
+    DoNotOptimize(sum);
+
+    sum = 0.0;
+    watch.Reset();
+    for (size_t i = 0; i < n; ++i) {
+        ParamEigen<double> param((double) i, timestamp, true);
+        DoNotOptimize(param);
+        sum += param.Val;
+    }
+    PrintResult("ParamEigen<double>(val, timestamp, valid)", watch.Elapsed() / n, "ns/param");
+    DoNotOptimize(sum);
+
+    sum = 0.0;
+    watch.Reset();
+    for (size_t i = 0; i < n; ++i) {
+        PackedParam<double> packed;
+        packed.Set((double) i, timestamp, true);
+        DoNotOptimize(packed);
+        sum += packed.Val;
+    }
+    PrintResult("PackedParam<double>::Set()", watch.Elapsed() / n, "ns/param");
+    DoNotOptimize(sum);
+
+    // Arrays of parameters
+    watch.Reset();
+    {
+        std::vector<ParamEigen<double> > params(n);
+        DoNotOptimize(params[n - 1]);
+    }
+    PrintResult("std::vector<ParamEigen<double> >(n)", watch.Elapsed() / n, "ns/param");
+
+    watch.Reset();
+    {
+        std::vector<PackedParam<double> > packed(n);
+        DoNotOptimize(packed[n - 1]);
+    }
+    PrintResult("std::vector<PackedParam<double> >(n)", watch.Elapsed() / n, "ns/param");
+
+    return 0;
+}
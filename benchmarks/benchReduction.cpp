@@ -0,0 +1,137 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+// Benchmark for windowed reductions over samples (SignalAccessor::Reduce()) and
+// over contiguous columns (HistoryBufferColumnar::ReduceLastN()) compared to
+// naive loops over windows of ParamEigen objects (SignalAccessor::GetWindow())
+//
+// usage: benchReduction [number of elements processed per measurement]
+//
+#include <cmath>
+#include <vector>
+
+#include "benchmark.h"
+#include "safecass/signalAccessor.h"
+#include "safecass/historyBufferColumnar.h"
+
+using namespace SC;
+
+namespace {
+
+//! Naive reduction over window of ParamEigen objects
+double NaiveReduce(const SignalWindow<ParamEigen<double> > & window, ReductionType type)
+{
+    const size_t n = window.GetSize();
+    double result = 0.0;
+    switch (type) {
+    case REDUCTION_MEAN:
+        for (size_t i = 0; i < n; ++i)
+            result += window[i].Val;
+        return result / n;
+    case REDUCTION_MAX:
+        result = window[0].Val;
+        for (size_t i = 1; i < n; ++i)
+            result = std::max(result, window[i].Val);
+        return result;
+    case REDUCTION_VARIANCE:
+        {
+            double mean = 0.0;
+            for (size_t i = 0; i < n; ++i)
+                mean += window[i].Val;
+            mean /= n;
+            for (size_t i = 0; i < n; ++i)
+                result += (window[i].Val - mean) * (window[i].Val - mean);
+        }
+        return result / n;
+    case REDUCTION_RMS:
+        for (size_t i = 0; i < n; ++i)
+            result += window[i].Val * window[i].Val;
+        return std::sqrt(result / n);
+    default:
+        return 0.0;
+    }
+}
+
+typedef enum { NAIVE, ACCESSOR, COLUMNAR } MethodType;
+
+//! Returns throughput in million samples per second
+double Measure(const SignalAccessor<ParamEigen<double> > & accessor, const HistoryBufferColumnar & columnar,
+               size_t windowSize, ReductionType type, MethodType method, size_t repetitions)
+{
+    double result = 0.0, sum = 0.0;
+    SignalWindow<ParamEigen<double> > window;
+
+    Stopwatch watch;
+    for (size_t i = 0; i < repetitions; ++i) {
+        switch (method) {
+        case NAIVE:
+            accessor.GetLastN(windowSize, window);
+            result = NaiveReduce(window, type);
+            break;
+        case ACCESSOR:
+            accessor.ReduceLastN(windowSize, type, result);
+            break;
+        default:
+            columnar.ReduceLastN(0, windowSize, type, result);
+            break;
+        }
+        sum += result;
+    }
+    const double elapsed = watch.Elapsed();
+    DoNotOptimize(sum);
+
+    return (repetitions * windowSize / 1e6) / (elapsed / 1e9);
+}
+
+};
+
+int RunBenchmark(int argc, char * argv[])
+{
+    const size_t total = (argc > 1 ? atoi(argv[1]) : 50000000);
+
+    std::cout << "Reductions: backend " << Reduction::GetBackendName()
+              << ", " << total << " samples per measurement" << std::endl;
+
+    const char * names[] = { "mean", "max", "variance", "rms" };
+    const ReductionType types[] = { REDUCTION_MEAN, REDUCTION_MAX, REDUCTION_VARIANCE, REDUCTION_RMS };
+    const size_t windowSizes[] = { 16, 256, 4096, 65536 };
+
+    for (size_t w = 0; w < sizeof(windowSizes) / sizeof(windowSizes[0]); ++w) {
+        const size_t windowSize = windowSizes[w];
+
+        // Ring buffer wraps around, as in steady state
+        ParamEigen<double> signal;
+        SignalAccessor<ParamEigen<double> > accessor(signal, "signal", windowSize);
+        HistoryBufferColumnar columnar(windowSize);
+        columnar.AddSignal(signal, "signal");
+        for (size_t i = 0; i < windowSize + windowSize / 3; ++i) {
+            signal = ParamEigen<double>(std::sin(0.01 * i), 0, true);
+            accessor.Push(signal);
+            columnar.Snapshot();
+        }
+
+        const size_t repetitions = std::max((size_t) 1, total / windowSize);
+        for (size_t t = 0; t < sizeof(types) / sizeof(types[0]); ++t) {
+            std::stringstream ss;
+            ss << "window " << windowSize << ", " << names[t];
+            const double naive    = Measure(accessor, columnar, windowSize, types[t], NAIVE, repetitions);
+            const double samples  = Measure(accessor, columnar, windowSize, types[t], ACCESSOR, repetitions);
+            const double columns  = Measure(accessor, columnar, windowSize, types[t], COLUMNAR, repetitions);
+            PrintResult(ss.str() + ": naive", naive, "M samples/s");
+            PrintResult(ss.str() + ": SignalAccessor::Reduce()", samples, "M samples/s");
+            PrintResult(ss.str() + ": HistoryBufferColumnar::ReduceLastN()", columns, "M samples/s");
+            PrintResult(ss.str() + ": speedup (columnar)", columns / naive, "x");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,143 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+// Benchmark for HistoryBuffer::Serialize() and HistoryBuffer::Deserialize()
+//
+// usage: benchSerialize [number of signals] [buffer size] [number of repetitions]
+//
+#include <vector>
+#include <sstream>
+
+#include "benchmark.h"
+#include "safecass/historyBuffer.h"
+
+using namespace SC;
+
+namespace {
+
+//! Mix of scalar and fixed-size Eigen signals (see benchHistoryBuffer.cpp)
+struct Signals
+{
+    std::vector<ParamEigen<double> *>          Doubles;
+    std::vector<ParamEigen<int> *>             Ints;
+    std::vector<ParamEigen<Eigen::Vector3d> *> Vectors;
+
+    Signals(size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            switch (i % 3) {
+            case 0: Doubles.push_back(new ParamEigen<double>(i)); break;
+            case 1: Ints.push_back(new ParamEigen<int>(i)); break;
+            case 2: Vectors.push_back(new ParamEigen<Eigen::Vector3d>(Eigen::Vector3d::Random())); break;
+            }
+        }
+    }
+    ~Signals() {
+        for (size_t i = 0; i < Doubles.size(); ++i) delete Doubles[i];
+        for (size_t i = 0; i < Ints.size(); ++i)    delete Ints[i];
+        for (size_t i = 0; i < Vectors.size(); ++i) delete Vectors[i];
+    }
+
+    void Update(void) {
+        for (size_t i = 0; i < Doubles.size(); ++i) Doubles[i]->Val += 0.1;
+        for (size_t i = 0; i < Ints.size(); ++i)    Ints[i]->Val += 1;
+        for (size_t i = 0; i < Vectors.size(); ++i) Vectors[i]->Val.array() += 0.1;
+    }
+
+    void AddTo(HistoryBuffer & hb) const {
+        for (size_t i = 0; i < Doubles.size(); ++i) hb.AddSignal(*Doubles[i], Name("d", i));
+        for (size_t i = 0; i < Ints.size(); ++i)    hb.AddSignal(*Ints[i],    Name("i", i));
+        for (size_t i = 0; i < Vectors.size(); ++i) hb.AddSignal(*Vectors[i], Name("v", i));
+    }
+
+    static std::string Name(const char * prefix, size_t i) {
+        std::stringstream ss;
+        ss << prefix << i;
+        return ss.str();
+    }
+};
+
+//! Returns throughput of Serialize() in MB/s
+double MeasureSerialize(const HistoryBuffer & hb, HistoryBuffer::FormatType format,
+                        size_t repetitions, std::string & output)
+{
+    double elapsed = 0.0;
+    size_t bytes = 0;
+    for (size_t i = 0; i < repetitions; ++i) {
+        std::ostringstream os;
+        Stopwatch watch;
+        hb.Serialize(os, format);
+        elapsed += watch.Elapsed();
+        output = os.str();
+        bytes += output.size();
+    }
+
+    return (bytes / 1e6) / (elapsed / 1e9);
+}
+
+//! Returns throughput of Deserialize() in MB/s
+double MeasureDeserialize(HistoryBuffer & hb, HistoryBuffer::FormatType format,
+                          size_t repetitions, const std::string & input)
+{
+    double elapsed = 0.0;
+    for (size_t i = 0; i < repetitions; ++i) {
+        std::istringstream is(input);
+        Stopwatch watch;
+        if (!hb.Deserialize(is, format)) {
+            std::cerr << "Deserialize() failed" << std::endl;
+            return 0.0;
+        }
+        elapsed += watch.Elapsed();
+    }
+
+    return (repetitions * input.size() / 1e6) / (elapsed / 1e9);
+}
+
+};
+
+int RunBenchmark(int argc, char * argv[])
+{
+    const size_t numSignals  = (argc > 1 ? atoi(argv[1]) : 300);
+    const size_t bufferSize  = (argc > 2 ? atoi(argv[2]) : 1024);
+    const size_t repetitions = (argc > 3 ? atoi(argv[3]) : 5);
+
+    std::cout << "Serialize(): " << numSignals << " signals, buffer size "
+              << bufferSize << ", " << repetitions << " repetitions" << std::endl;
+
+    Signals signals(numSignals);
+    HistoryBuffer hb(bufferSize);
+    signals.AddTo(hb);
+    for (size_t i = 0; i < bufferSize; ++i) {
+        signals.Update();
+        hb.Snapshot();
+    }
+
+    std::string output;
+    double mbps;
+
+    mbps = MeasureSerialize(hb, HistoryBuffer::FORMAT_TEXT, repetitions, output);
+    PrintResult("Serialize(FORMAT_TEXT)", mbps, "MB/s");
+    PrintResult("Serialize(FORMAT_TEXT) output size", output.size() / 1e6, "MB");
+
+    mbps = MeasureSerialize(hb, HistoryBuffer::FORMAT_CSV, repetitions, output);
+    PrintResult("Serialize(FORMAT_CSV)", mbps, "MB/s");
+    PrintResult("Serialize(FORMAT_CSV) output size", output.size() / 1e6, "MB");
+    mbps = MeasureDeserialize(hb, HistoryBuffer::FORMAT_CSV, repetitions, output);
+    PrintResult("Deserialize(FORMAT_CSV)", mbps, "MB/s");
+
+    mbps = MeasureSerialize(hb, HistoryBuffer::FORMAT_BINARY, repetitions, output);
+    PrintResult("Serialize(FORMAT_BINARY)", mbps, "MB/s");
+    PrintResult("Serialize(FORMAT_BINARY) output size", output.size() / 1e6, "MB");
+    mbps = MeasureDeserialize(hb, HistoryBuffer::FORMAT_BINARY, repetitions, output);
+    PrintResult("Deserialize(FORMAT_BINARY)", mbps, "MB/s");
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+// Benchmark for reads of latest values: HistoryBuffer::GetNewValue() (virtual
+// call and dynamic_cast per read) vs. SignalHandle (typed, inlined)
+//
+// usage: benchSignalHandle [number of signals] [number of rounds]
+//
+#include <vector>
+#include <sstream>
+
+#include "benchmark.h"
+#include "safecass/historyBuffer.h"
+
+using namespace SC;
+
+int RunBenchmark(int argc, char * argv[])
+{
+    const size_t numSignals = (argc > 1 ? atoi(argv[1]) : 100);
+    const size_t numRounds  = (argc > 2 ? atoi(argv[2]) : 100000);
+
+    std::cout << "Latest value reads: " << numSignals << " signals, "
+              << numRounds << " rounds" << std::endl;
+
+    std::vector<ParamEigen<double> *> signals;
+    std::vector<SignalHandle<double> > handles;
+    HistoryBuffer hb(64);
+    for (size_t i = 0; i < numSignals; ++i) {
+        std::stringstream ss;
+        ss << "signal" << i;
+        signals.push_back(new ParamEigen<double>((double) i));
+        handles.push_back(hb.AddSignal(*signals.back(), ss.str()));
+    }
+    hb.Snapshot();
+
+    const double numReads = (double) numSignals * numRounds;
+    double sum;
+    Stopwatch watch;
+
+    // Type-erased reads
+    ParamEigen<double> arg;
+    sum = 0.0;
+    watch.Reset();
+    for (size_t r = 0; r < numRounds; ++r) {
+        for (size_t i = 0; i < numSignals; ++i) {
+            hb.GetNewValue(handles[i].GetIndex(), arg);
+            sum += arg.Val;
+        }
+    }
+    PrintResult("GetNewValue(index, ParamBase &)", watch.Elapsed() / numReads, "ns/read");
+    DoNotOptimize(sum);
+
+    // Typed reads of samples (including validity and timestamp)
+    sum = 0.0;
+    watch.Reset();
+    for (size_t r = 0; r < numRounds; ++r) {
+        for (size_t i = 0; i < numSignals; ++i) {
+            handles[i].GetLatest(arg);
+            sum += arg.Val;
+        }
+    }
+    PrintResult("SignalHandle::GetLatest(ParamEigen &)", watch.Elapsed() / numReads, "ns/read");
+    DoNotOptimize(sum);
+
+    // Typed reads of values
+    double value;
+    sum = 0.0;
+    watch.Reset();
+    for (size_t r = 0; r < numRounds; ++r) {
+        for (size_t i = 0; i < numSignals; ++i) {
+            handles[i].GetLatestValue(value);
+            sum += value;
+        }
+    }
+    PrintResult("SignalHandle::GetLatestValue(double &)", watch.Elapsed() / numReads, "ns/read");
+    DoNotOptimize(sum);
+
+    for (size_t i = 0; i < signals.size(); ++i)
+        delete signals[i];
+
+    return 0;
+}
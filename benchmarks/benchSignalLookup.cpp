@@ -0,0 +1,79 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+// Benchmark for signal name lookup (HistoryBuffer::GetSignalIndex())
+//
+// usage: benchSignalLookup [number of signals] [number of lookups]
+//
+#include <map>
+#include <vector>
+#include <sstream>
+
+#include "benchmark.h"
+#include "safecass/historyBuffer.h"
+
+using namespace SC;
+
+int RunBenchmark(int argc, char * argv[])
+{
+    const size_t numSignals = (argc > 1 ? atoi(argv[1]) : 5000);
+    const size_t numLookups = (argc > 2 ? atoi(argv[2]) : 1000000);
+
+    std::cout << "GetSignalIndex(): " << numSignals << " signals, "
+              << numLookups << " lookups" << std::endl;
+
+    // Names similar to those of components (long common prefix)
+    std::vector<std::string> names;
+    for (size_t i = 0; i < numSignals; ++i) {
+        std::stringstream ss;
+        ss << "robot/arm/joint/position/" << i;
+        names.push_back(ss.str());
+    }
+
+    ParamEigen<double> signal;
+    HistoryBuffer hb;
+    std::map<std::string, int> reference;
+    for (size_t i = 0; i < numSignals; ++i) {
+        hb.AddSignal(signal, names[i], 1);
+        reference.insert(std::make_pair(names[i], (int) i));
+    }
+
+    std::vector<StringIDType> ids;
+    for (size_t i = 0; i < numSignals; ++i)
+        ids.push_back(StringTable::GetInstance()->Find(names[i]));
+
+    long long sum;
+    Stopwatch watch;
+
+    sum = 0;
+    watch.Reset();
+    for (size_t i = 0; i < numLookups; ++i)
+        sum += reference.find(names[(i * 7919) % numSignals])->second;
+    PrintResult("std::map<std::string, int>::find() (reference)", watch.Elapsed() / numLookups, "ns/lookup");
+    DoNotOptimize(sum);
+
+    sum = 0;
+    watch.Reset();
+    for (size_t i = 0; i < numLookups; ++i)
+        sum += hb.GetSignalIndex(names[(i * 7919) % numSignals]);
+    PrintResult("GetSignalIndex(std::string)", watch.Elapsed() / numLookups, "ns/lookup");
+    DoNotOptimize(sum);
+
+    sum = 0;
+    watch.Reset();
+    for (size_t i = 0; i < numLookups; ++i)
+        sum += hb.GetSignalIndex(ids[(i * 7919) % numSignals]);
+    PrintResult("GetSignalIndex(StringIDType)", watch.Elapsed() / numLookups, "ns/lookup");
+    DoNotOptimize(sum);
+
+    return 0;
+}
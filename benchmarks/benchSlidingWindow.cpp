@@ -0,0 +1,84 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+// Benchmark for sliding-window statistics (mean, variance, min, max) per new
+// sample: incremental update (SlidingWindowStatistics) vs. recomputation over
+// all samples in window (Reduction::Reduce())
+//
+// usage: benchSlidingWindow [max window size]
+//
+#include <sstream>
+#include <cstdlib>
+
+#include "benchmark.h"
+#include "common/ringBuffer.h"
+#include "safecass/slidingWindow.h"
+#include "safecass/reduction.h"
+
+using namespace SC;
+
+static std::string Label(const char * name, size_t size)
+{
+    std::stringstream ss;
+    ss << name << ", window " << size;
+    return ss.str();
+}
+
+int RunBenchmark(int argc, char * argv[])
+{
+    const size_t maxSize = (argc > 1 ? atoi(argv[1]) : 100000);
+
+    std::cout << "Sliding-window statistics (" << Reduction::GetBackendName() << " kernels for recomputation)" << std::endl;
+
+    std::vector<double> input(1 << 16);
+    for (size_t i = 0; i < input.size(); ++i)
+        input[i] = (std::rand() % 10000) / 100.0;
+    const size_t mask = input.size() - 1;
+
+    for (size_t size = 10; size <= maxSize; size *= 10) {
+        // Window is filled first to measure steady state
+        const size_t numSamples = 1000000;
+        SlidingWindowStatistics window(size);
+        for (size_t i = 0; i < size; ++i)
+            window.Push(input[i & mask]);
+        double sink = 0.0;
+        Stopwatch watch;
+        for (size_t i = 0; i < numSamples; ++i) {
+            window.Push(input[(size + i) & mask]);
+            sink += window.GetMean() + window.GetVariance() + window.GetMin() + window.GetMax();
+        }
+        PrintResult(Label("incremental", size), watch.Elapsed() / numSamples, "ns/sample");
+        DoNotOptimize(sink);
+
+        RingBuffer<double> ring(size, 0.0);
+        for (size_t i = 0; i < size; ++i)
+            ring.PushBack(input[i & mask]);
+        const size_t numRecompute = std::max((size_t) 100, 10000000 / size);
+        sink = 0.0;
+        watch.Reset();
+        for (size_t i = 0; i < numRecompute; ++i) {
+            ring.PushBack(input[(size + i) & mask]);
+            const RingBuffer<double>::ArrayRangeType one = ring.GetArrayOne();
+            const RingBuffer<double>::ArrayRangeType two = ring.GetArrayTwo();
+            double mean, variance, min, max;
+            Reduction::Reduce(one.first, one.second, two.first, two.second, REDUCTION_MEAN, mean);
+            Reduction::Reduce(one.first, one.second, two.first, two.second, REDUCTION_VARIANCE, variance);
+            Reduction::Reduce(one.first, one.second, two.first, two.second, REDUCTION_MIN, min);
+            Reduction::Reduce(one.first, one.second, two.first, two.second, REDUCTION_MAX, max);
+            sink += mean + variance + min + max;
+        }
+        PrintResult(Label("recompute", size), watch.Elapsed() / numRecompute, "ns/sample");
+        DoNotOptimize(sink);
+    }
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+// Benchmark for timestamp lookup of HistoryBuffer (HistoryBuffer::GetValueAt())
+// compared to linear scan and std::upper_bound over snapshot timestamps
+//
+// usage: benchTimestampLookup [number of queries]
+//
+#include <vector>
+#include <algorithm>
+#include <sstream>
+
+#include "benchmark.h"
+#include "safecass/historyBuffer.h"
+
+using namespace SC;
+
+namespace {
+
+typedef HistoryBuffer::TimestampsType TimestampsType;
+
+//! Baseline: index of latest timestamp at or before t by linear scan
+size_t LinearScan(const TimestampsType & ts, TimestampType t)
+{
+    size_t i = 0;
+    for (; i < ts.size(); ++i)
+        if (ts[i] > t)
+            break;
+    return (i == 0 ? 0 : i - 1);
+}
+
+size_t BinarySearch(const TimestampsType & ts, TimestampType t)
+{
+    TimestampsType::const_iterator it = std::upper_bound(ts.begin(), ts.end(), t);
+    return (it == ts.begin() ? 0 : (it - ts.begin()) - 1);
+}
+
+};
+
+int RunBenchmark(int argc, char * argv[])
+{
+    const size_t numQueries = (argc > 1 ? atoi(argv[1]) : 10000);
+
+    const size_t sizes[] = { 128, 1024, 16 * 1024, 128 * 1024, 1024 * 1024 };
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        const size_t size = sizes[s];
+
+        HistoryBuffer hb(size);
+        ParamEigen<double> signal(0.0);
+        hb.AddSignal(signal, "signal");
+        // Fill buffer and wrap around
+        for (size_t i = 0; i < size + size / 2; ++i) {
+            signal = (double) i;
+            hb.Snapshot();
+        }
+
+        const TimestampsType & ts = hb.GetSnapshotTimestamps();
+        std::vector<TimestampType> queries(numQueries);
+        for (size_t i = 0; i < numQueries; ++i)
+            queries[i] = ts.front() + (TimestampType) ((double) rand() / RAND_MAX * (ts.back() - ts.front()));
+
+        std::cout << "Buffer size " << size << ":" << std::endl;
+
+        // Linear scan gets too slow for large buffers; use fewer queries
+        const size_t numLinear = std::max((size_t) 10, std::min(numQueries, (size_t) 20000000 / size));
+        size_t sink = 0;
+        Stopwatch watch;
+        for (size_t i = 0; i < numLinear; ++i)
+            sink += LinearScan(ts, queries[i]);
+        PrintResult("  linear scan", watch.Elapsed() / numLinear, "ns/lookup");
+
+        watch.Reset();
+        for (size_t i = 0; i < numQueries; ++i)
+            sink += BinarySearch(ts, queries[i]);
+        PrintResult("  std::upper_bound", watch.Elapsed() / numQueries, "ns/lookup");
+
+        ParamEigen<double> value;
+        double sum = 0.0;
+        watch.Reset();
+        for (size_t i = 0; i < numQueries; ++i) {
+            hb.GetValueAt(0, queries[i], value, HistoryBuffer::LOOKUP_PREVIOUS);
+            sum += value.Val;
+        }
+        PrintResult("  GetValueAt(LOOKUP_PREVIOUS)", watch.Elapsed() / numQueries, "ns/lookup");
+
+        watch.Reset();
+        for (size_t i = 0; i < numQueries; ++i) {
+            hb.GetValueAt(0, queries[i], value, HistoryBuffer::LOOKUP_INTERPOLATE);
+            sum += value.Val;
+        }
+        PrintResult("  GetValueAt(LOOKUP_INTERPOLATE)", watch.Elapsed() / numQueries, "ns/lookup");
+
+        DoNotOptimize(sink);
+        DoNotOptimize(sum);
+    }
+
+    return 0;
+}
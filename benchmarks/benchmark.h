@@ -0,0 +1,63 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _benchmark_h
+#define _benchmark_h
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+#include <boost/chrono.hpp>
+
+//! Entry point of each benchmark (defined in bench*.cpp)
+int RunBenchmark(int argc, char * argv[]);
+
+//! Simple stopwatch based on steady clock
+class Stopwatch
+{
+protected:
+    typedef boost::chrono::steady_clock ClockType;
+
+    ClockType::time_point Start;
+
+public:
+    Stopwatch(void) { Reset(); }
+
+    inline void Reset(void) { Start = ClockType::now(); }
+
+    //! Returns elapsed time since last reset in nanoseconds
+    inline double Elapsed(void) const {
+        return (double) boost::chrono::duration_cast<boost::chrono::nanoseconds>(
+            ClockType::now() - Start).count();
+    }
+};
+
+//! Prints one line of benchmark result
+inline void PrintResult(const std::string & name, double value, const std::string & unit)
+{
+    const std::ios::fmtflags f(std::cout.flags());
+    std::cout << std::left << std::setw(48) << name << " "
+              << std::right << std::setw(12) << std::fixed << std::setprecision(2) << value
+              << " " << unit << std::endl;
+    std::cout.flags(f);
+}
+
+//! Prevents the compiler from optimizing out the value computed
+template<typename _type>
+inline void DoNotOptimize(const _type & value)
+{
+    static volatile const void * sink;
+    sink = &value;
+}
+
+#endif // _benchmark_h
@@ -0,0 +1,30 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common/common.h"
+#include "benchmark.h"
+
+int main(int argc, char * argv[])
+{
+    // Initialize Google logger (glog); suppress informational messages so that
+    // they don't interfere with benchmark results
+    FLAGS_logtostderr = 1;
+    FLAGS_minloglevel = 1;
+
+    google::InitGoogleLogging(argv[0]);
+
+    return RunBenchmark(argc, argv);
+}
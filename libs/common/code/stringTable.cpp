@@ -0,0 +1,43 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include "common/stringTable.h"
+
+using namespace SC;
+
+StringIDType StringTable::Intern(const std::string & str)
+{
+    const StringIDType * id = IDs.Find(str);
+    if (id)
+        return *id;
+
+    const StringIDType newId = (StringIDType) Strings.size();
+    Strings.push_back(str);
+    IDs.Insert(str, newId);
+
+    return newId;
+}
+
+StringIDType StringTable::Find(const std::string & str) const
+{
+    const StringIDType * id = IDs.Find(str);
+
+    return (id ? *id : INVALID_STRING_ID);
+}
+
+const std::string & StringTable::GetString(StringIDType id) const
+{
+    static const std::string empty;
+
+    return (id < Strings.size() ? Strings[id] : empty);
+}
@@ -7,7 +7,7 @@
 //----------------------------------------------------------------------------------
 //
 // Created on   : May 27, 2012
-// Last revision: Apr 21, 2016
+// Last revision: Oct 17, 2026
 // Author       : Min Yang Jung <myj@jhu.edu>
 // Github       : https://github.com/safecass/safecass
 //
@@ -202,6 +202,12 @@ SC::TimestampType SC::GetCurrentTimestamp(void)
         (boost::chrono::system_clock::now().time_since_epoch()).count();
 }
 
+SC::TimestampType SC::GetMonotonicTimestamp(void)
+{
+    return boost::chrono::duration_cast<boost::chrono::nanoseconds>
+        (boost::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 std::string SC::GetCurrentTimestampString(bool humanReadable)
 {
     std::stringstream ss;
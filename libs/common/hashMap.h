@@ -0,0 +1,146 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _hashMap_h
+#define _hashMap_h
+
+#include <string>
+#include <vector>
+#include <boost/cstdint.hpp>
+
+namespace SC {
+
+//! Hash functions used by HashMap
+template <typename T> struct Hash;
+
+//! FNV-1a
+template <> struct Hash<std::string> {
+    inline size_t operator()(const std::string & key) const {
+        boost::uint64_t h = 14695981039346656037ULL;
+        for (size_t i = 0; i < key.size(); ++i) {
+            h ^= (unsigned char) key[i];
+            h *= 1099511628211ULL;
+        }
+        return (size_t) h;
+    }
+};
+
+//! Finalizer of MurmurHash3 (spreads consecutive integers over the table)
+template <> struct Hash<boost::uint32_t> {
+    inline size_t operator()(boost::uint32_t key) const {
+        key ^= key >> 16;
+        key *= 0x85ebca6b;
+        key ^= key >> 13;
+        key *= 0xc2b2ae35;
+        key ^= key >> 16;
+        return key;
+    }
+};
+
+//! Hash map using open addressing with linear probing
+/*!
+    Entries are stored in one flat array, and thus a lookup typically touches
+    one or two cache lines without pointer chasing.  The table size is a power
+    of two and the load factor is kept below 1/2.
+
+    Entries cannot be removed; this map is intended for lookup tables that only
+    grow (e.g., names of signals).  Key and value types must be default and
+    copy constructible.
+*/
+template <typename _keyType, typename _valueType, typename _hashType = Hash<_keyType> >
+class HashMap
+{
+public:
+    typedef _keyType   KeyType;
+    typedef _valueType ValueType;
+
+protected:
+    struct SlotType {
+        KeyType   Key;
+        ValueType Value;
+        bool      Used;
+
+        SlotType(void): Key(), Value(), Used(false) {}
+    };
+    typedef std::vector<SlotType> SlotsType;
+
+    SlotsType Slots;
+    size_t    Size;
+    _hashType HashFunction;
+
+    //! Returns slot of key, or empty slot where key would be inserted
+    inline size_t Probe(const KeyType & key) const {
+        const size_t mask = Slots.size() - 1;
+        size_t i = HashFunction(key) & mask;
+        while (Slots[i].Used && !(Slots[i].Key == key))
+            i = (i + 1) & mask;
+        return i;
+    }
+
+    void Rehash(size_t capacity) {
+        SlotsType old;
+        old.swap(Slots);
+        Slots.resize(capacity);
+        for (size_t i = 0; i < old.size(); ++i) {
+            if (!old[i].Used)
+                continue;
+            Slots[Probe(old[i].Key)] = old[i];
+        }
+    }
+
+public:
+    HashMap(size_t capacity = 16): Size(0) {
+        size_t n = 16;
+        while (n < capacity * 2)
+            n <<= 1;
+        Slots.resize(n);
+    }
+
+    //! Inserts key and value
+    /*!
+        \return false if key already exists (value is not updated)
+    */
+    bool Insert(const KeyType & key, const ValueType & value) {
+        if ((Size + 1) * 2 > Slots.size())
+            Rehash(Slots.size() * 2);
+
+        const size_t i = Probe(key);
+        if (Slots[i].Used)
+            return false;
+
+        Slots[i].Key   = key;
+        Slots[i].Value = value;
+        Slots[i].Used  = true;
+        ++Size;
+
+        return true;
+    }
+
+    //! Returns pointer to value of key (0 if not found)
+    inline const ValueType * Find(const KeyType & key) const {
+        const size_t i = Probe(key);
+        return (Slots[i].Used ? &Slots[i].Value : 0);
+    }
+
+    //! Removes all entries
+    void Clear(void) {
+        Slots.assign(Slots.size(), SlotType());
+        Size = 0;
+    }
+
+    inline size_t GetSize(void) const { return Size; }
+    inline bool IsEmpty(void) const { return (Size == 0); }
+};
+
+};
+
+#endif // _hashMap_h
@@ -0,0 +1,149 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _ringBuffer_h
+#define _ringBuffer_h
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+namespace SC {
+
+//! Ring buffer with preallocated slots
+/*!
+    Unlike boost::circular_buffer, which copy-constructs an element whenever a
+    slot is used for the first time, all slots of this ring buffer are
+    constructed up front as copies of a prototype and are then reused in place:
+    PushBack() copy-assigns the new element to an existing slot.  For element
+    types that own heap memory (e.g., ParamEigen<Eigen::VectorXd>), assignment
+    does not allocate as long as the size of the new element matches the size
+    of the slot, and thus pushing elements is allocation-free.
+
+    Clear() keeps the slots; only SetCapacity() reallocates them.  Because slots
+    are kept in std::vector, ValueType must not be bool.
+*/
+template <typename _valueType>
+class RingBuffer
+{
+public:
+    typedef _valueType ValueType;
+    typedef std::vector<ValueType> SlotsType;
+    //! Contiguous span of elements (pointer and number of elements)
+    typedef std::pair<const ValueType *, size_t> ArrayRangeType;
+
+protected:
+    //! Slots of the ring (all constructed)
+    SlotsType Slots;
+    //! Slot of the oldest element
+    size_t First;
+    //! Number of elements
+    size_t Size;
+
+    //! Returns slot of i-th element (0: oldest)
+    inline size_t GetSlotIndex(size_t i) const {
+        const size_t j = First + i;
+        return (j < Slots.size() ? j : j - Slots.size());
+    }
+
+public:
+    RingBuffer(size_t capacity, const ValueType & prototype)
+        : Slots(capacity, prototype), First(0), Size(0)
+    {}
+
+    //! Appends element in place and returns its slot
+    /*!
+        The slot keeps its previous contents (the oldest element if the ring is
+        full), which the caller overwrites.  The ring must have at least one slot.
+    */
+    inline ValueType & Advance(void) {
+        if (Size < Slots.size())
+            return Slots[GetSlotIndex(Size++)];
+        ValueType & slot = Slots[First];
+        if (++First == Slots.size())
+            First = 0;
+        return slot;
+    }
+
+    //! Appends element, overwriting the oldest element if the ring is full
+    inline void PushBack(const ValueType & item) {
+        if (Slots.empty())
+            return;
+        Advance() = item;
+    }
+
+    //! Removes the oldest element (the ring must not be empty)
+    inline void PopFront(void) {
+        if (++First == Slots.size())
+            First = 0;
+        --Size;
+    }
+
+    //! Removes the latest element (the ring must not be empty)
+    inline void PopBack(void) {
+        --Size;
+    }
+
+    //! Removes all elements (slots are kept)
+    inline void Clear(void) {
+        First = 0;
+        Size = 0;
+    }
+
+    //! Changes number of slots, keeping the latest elements
+    /*!
+        New slots are copies of prototype.  This reallocates all slots.
+    */
+    void SetCapacity(size_t capacity, const ValueType & prototype) {
+        SlotsType slots(capacity, prototype);
+        const size_t n = std::min(Size, capacity);
+        for (size_t i = 0; i < n; ++i)
+            slots[i] = (*this)[Size - n + i];
+        Slots.swap(slots);
+        First = 0;
+        Size = n;
+    }
+
+    //! Random access (0: oldest)
+    inline ValueType & operator[](size_t i)             { return Slots[GetSlotIndex(i)]; }
+    inline const ValueType & operator[](size_t i) const { return Slots[GetSlotIndex(i)]; }
+
+    inline ValueType & Front(void)             { return Slots[First]; }
+    inline const ValueType & Front(void) const { return Slots[First]; }
+    inline ValueType & Back(void)              { return Slots[GetSlotIndex(Size - 1)]; }
+    inline const ValueType & Back(void) const  { return Slots[GetSlotIndex(Size - 1)]; }
+
+    //! Returns span from the oldest element up to the end of slots
+    inline ArrayRangeType GetArrayOne(void) const {
+        if (Size == 0)
+            return ArrayRangeType(0, 0);
+        return ArrayRangeType(&Slots[First], std::min(Size, Slots.size() - First));
+    }
+    //! Returns span of elements wrapped around to the beginning of slots (may be empty)
+    inline ArrayRangeType GetArrayTwo(void) const {
+        if (First + Size <= Slots.size())
+            return ArrayRangeType(0, 0);
+        return ArrayRangeType(&Slots[0], First + Size - Slots.size());
+    }
+
+    //! Returns all slots, including those not in use
+    inline const SlotsType & GetSlots(void) const { return Slots; }
+
+    inline size_t GetSize(void) const     { return Size; }
+    inline size_t GetCapacity(void) const { return Slots.size(); }
+    inline bool IsEmpty(void) const       { return (Size == 0); }
+    inline bool IsFull(void) const        { return (Size == Slots.size()); }
+};
+
+};
+
+#endif // _ringBuffer_h
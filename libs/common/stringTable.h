@@ -0,0 +1,75 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _stringTable_h
+#define _stringTable_h
+
+#include <string>
+#include <deque>
+
+#include "common/hashMap.h"
+
+namespace SC {
+
+//! Typedef of interned string ID
+typedef boost::uint32_t StringIDType;
+
+//! Invalid interned string ID
+const StringIDType INVALID_STRING_ID = 0xFFFFFFFF;
+
+//! String interning table
+/*!
+    Maps each distinct string to a stable integer ID so that hot paths can
+    identify signals (or anything named) by integer comparison rather than by
+    string comparison.  IDs are assigned in order of interning starting from 0
+    and remain valid for the lifetime of the table.
+
+    The process-wide instance (GetInstance()) is used for names of signals,
+    which allows IDs to be shared by history buffers and filters.
+
+    Note that this class is not thread-safe: strings are expected to be
+    interned at initialization or configuration time.
+*/
+class StringTable
+{
+protected:
+    //! Interned strings (deque keeps references returned by GetString() valid)
+    std::deque<std::string> Strings;
+
+    //! Map for ID lookup
+    HashMap<std::string, StringIDType> IDs;
+
+public:
+    StringTable(void) {}
+
+    //! Returns process-wide table
+    static StringTable * GetInstance(void) {
+        static StringTable Instance;
+        return &Instance;
+    }
+
+    //! Returns ID of string (interned if not found)
+    StringIDType Intern(const std::string & str);
+
+    //! Returns ID of string (INVALID_STRING_ID if not interned)
+    StringIDType Find(const std::string & str) const;
+
+    //! Returns string of ID (empty string if ID is invalid)
+    const std::string & GetString(StringIDType id) const;
+
+    //! Returns number of strings interned
+    inline size_t GetSize(void) const { return Strings.size(); }
+};
+
+};
+
+#endif // _stringTable_h
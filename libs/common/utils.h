@@ -7,7 +7,7 @@
 //----------------------------------------------------------------------------------
 //
 // Created on   : May 16, 2012
-// Last revision: Aug 21, 2016
+// Last revision: Oct 17, 2026
 // Author       : Min Yang Jung <myj@jhu.edu>
 // Github       : https://github.com/safecass/casros
 //
@@ -44,6 +44,13 @@ std::string to_uppercase(const std::string & s);
 //! Returns current timestamp
 TimestampType GetCurrentTimestamp(void);
 
+//! Returns timestamp of monotonic clock (for measuring elapsed time only)
+/*!
+    Unlike GetCurrentTimestamp(), which reads wall clock, this timestamp is
+    not affected by adjustment of system time but has no relation to UTC.
+*/
+TimestampType GetMonotonicTimestamp(void);
+
 //! Returns current timestamp string
 /*!
     \param clockFormat Specifies time representation format.  If true, current
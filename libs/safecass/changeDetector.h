@@ -0,0 +1,206 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+/*!
+    This file implements streaming detectors of changes in the mean of a
+    signal.  Each detector keeps a test statistic that is updated in O(1) time
+    and memory per sample, and raises an alarm while the statistic exceeds
+    its threshold:
+
+    - CusumDetector: two-sided cumulative sum (Page's CUSUM) of deviations
+      from the target mean beyond drift k, with threshold h
+    - PageHinkleyDetector: two-sided Page-Hinkley test of deviations from the
+      running mean beyond tolerance delta, with threshold lambda
+    - EwmaDetector: exponentially weighted moving average control chart, with
+      smoothing factor lambda and control limits at L standard deviations
+
+    CUSUM and EWMA compare samples against the target mean (and standard
+    deviation, for EWMA) of the signal in control.  If not given, they are
+    estimated from the first samples (see SetWarmUp()), during which no alarm
+    is raised.
+*/
+
+#ifndef _ChangeDetector_h
+#define _ChangeDetector_h
+
+#include <iostream>
+#include <string>
+
+#include "common/common.h"
+
+namespace SC {
+
+//! Base class of streaming change detectors
+class SCLIB_EXPORT ChangeDetector
+{
+public:
+    //! Typedef of detector type
+    typedef enum {
+        DETECTOR_CUSUM,
+        DETECTOR_PAGE_HINKLEY,
+        DETECTOR_EWMA
+    } DetectorType;
+
+protected:
+    const DetectorType Type;
+
+    //! Alarm threshold of test statistic
+    double Threshold;
+
+    //! Target mean and standard deviation
+    double Mean;
+    double StdDev;
+
+    //! Number of samples to estimate target from (0 if target is given)
+    size_t WarmUp;
+    //! Number of samples pushed since reset
+    size_t Count;
+    //! Running mean and sum of squared deviations during warm-up (Welford)
+    double WarmUpMean;
+    double WarmUpM2;
+
+    //! Current test statistic and alarm state
+    double Statistic;
+    bool Alarm;
+
+    //! Reset test statistic of derived detector
+    virtual void ResetStatistic(void) = 0;
+    //! Update and return test statistic with new sample
+    virtual double UpdateStatistic(double x) = 0;
+
+    ChangeDetector(DetectorType type, double threshold);
+
+public:
+    virtual ~ChangeDetector() {}
+
+    //! Create detector of given type (see GetDetectorTypeFromString()), 0 if type is invalid
+    /*!
+        Parameters that do not apply to the type are ignored:
+        - CUSUM: drift k (param1), threshold h
+        - Page-Hinkley: tolerance delta (param1), threshold lambda
+        - EWMA: smoothing factor lambda (param1), width of control limits L (threshold)
+    */
+    static ChangeDetector * Create(DetectorType type, double param1, double threshold);
+
+    //! Set target mean and standard deviation of signal in control
+    void SetTarget(double mean, double stdDev = 1.0);
+    //! Estimate target from first samples instead (no alarm until then)
+    void SetWarmUp(size_t samples);
+
+    //! Add sample and return alarm state
+    bool Push(double x);
+
+    //! Restart detection (target estimated again if warm-up is set)
+    void Reset(void);
+
+    inline DetectorType GetType(void) const { return Type; }
+    inline double GetThreshold(void) const  { return Threshold; }
+    inline double GetMean(void) const       { return Mean; }
+    inline double GetStdDev(void) const     { return StdDev; }
+    inline size_t GetWarmUp(void) const     { return WarmUp; }
+    inline size_t GetCount(void) const      { return Count; }
+    inline bool IsWarmingUp(void) const     { return (Count < WarmUp); }
+    inline double GetStatistic(void) const  { return Statistic; }
+    inline bool IsAlarm(void) const         { return Alarm; }
+
+    virtual void ToStream(std::ostream & os) const;
+
+    //! Convert detector type to string
+    static const std::string GetDetectorTypeString(DetectorType type);
+    //! Convert string to detector type
+    /*!
+        \return false if string is not a detector type
+    */
+    static bool GetDetectorTypeFromString(const std::string & str, DetectorType & type);
+};
+
+inline std::ostream & operator << (std::ostream & os, const ChangeDetector & detector)
+{
+    detector.ToStream(os);
+    return os;
+}
+
+//! Two-sided CUSUM
+/*!
+    S+ = max(0, S+ + x - mean - k), S- = max(0, S- + mean - x - k), and the
+    statistic is max(S+, S-).  Once the signal is back in control, the
+    statistic decreases by k per sample.
+*/
+class SCLIB_EXPORT CusumDetector: public ChangeDetector
+{
+protected:
+    double Drift;
+    double High;
+    double Low;
+
+    void ResetStatistic(void);
+    double UpdateStatistic(double x);
+
+public:
+    CusumDetector(double drift, double threshold);
+
+    inline double GetDrift(void) const { return Drift; }
+};
+
+//! Two-sided Page-Hinkley test
+/*!
+    With running mean m of all samples, m+ = sum(x - m - delta) and
+    m- = sum(m - x - delta); the statistic is the larger of the rises of m+
+    and m- above their minimums.
+*/
+class SCLIB_EXPORT PageHinkleyDetector: public ChangeDetector
+{
+protected:
+    double Delta;
+    double RunningMean;
+    size_t RunningCount;
+    double SumUp;
+    double SumDown;
+    double MinUp;
+    double MinDown;
+
+    void ResetStatistic(void);
+    double UpdateStatistic(double x);
+
+public:
+    PageHinkleyDetector(double delta, double threshold);
+
+    inline double GetDelta(void) const { return Delta; }
+};
+
+//! EWMA control chart
+/*!
+    z = lambda * x + (1 - lambda) * z, starting from the target mean.  The
+    statistic is |z - mean| in units of the standard deviation of z, which
+    converges to stddev * sqrt(lambda / (2 - lambda)).
+*/
+class SCLIB_EXPORT EwmaDetector: public ChangeDetector
+{
+protected:
+    double Lambda;
+    double Z;
+    //! (1 - lambda)^(2n) for standard deviation of z after n samples
+    double Decay;
+
+    void ResetStatistic(void);
+    double UpdateStatistic(double x);
+
+public:
+    EwmaDetector(double lambda, double width);
+
+    inline double GetLambda(void) const { return Lambda; }
+    inline double GetAverage(void) const { return Z; }
+};
+
+};
+
+#endif // _ChangeDetector_h
@@ -0,0 +1,238 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#include "safecass/changeDetector.h"
+#include "common/utils.h"
+
+#include <cmath>
+#include <limits>
+
+using namespace SC;
+
+//--------------------------------------------------
+//  ChangeDetector
+//--------------------------------------------------
+ChangeDetector::ChangeDetector(DetectorType type, double threshold)
+    : Type(type), Threshold(threshold), Mean(0.0), StdDev(1.0), WarmUp(0),
+      Count(0), WarmUpMean(0.0), WarmUpM2(0.0), Statistic(0.0), Alarm(false)
+{
+}
+
+ChangeDetector * ChangeDetector::Create(DetectorType type, double param1, double threshold)
+{
+    switch (type) {
+    case DETECTOR_CUSUM:
+        if (param1 < 0.0 || threshold <= 0.0) {
+            SCLOG_ERROR << "ChangeDetector: invalid CUSUM parameters: drift " << param1
+                        << ", threshold " << threshold << std::endl;
+            return 0;
+        }
+        return new CusumDetector(param1, threshold);
+    case DETECTOR_PAGE_HINKLEY:
+        if (param1 < 0.0 || threshold <= 0.0) {
+            SCLOG_ERROR << "ChangeDetector: invalid Page-Hinkley parameters: delta " << param1
+                        << ", threshold " << threshold << std::endl;
+            return 0;
+        }
+        return new PageHinkleyDetector(param1, threshold);
+    case DETECTOR_EWMA:
+        if (param1 <= 0.0 || param1 > 1.0 || threshold <= 0.0) {
+            SCLOG_ERROR << "ChangeDetector: invalid EWMA parameters: lambda " << param1
+                        << ", width " << threshold << std::endl;
+            return 0;
+        }
+        return new EwmaDetector(param1, threshold);
+    }
+
+    return 0;
+}
+
+void ChangeDetector::SetTarget(double mean, double stdDev)
+{
+    Mean = mean;
+    StdDev = stdDev;
+    WarmUp = 0;
+
+    Reset();
+}
+
+void ChangeDetector::SetWarmUp(size_t samples)
+{
+    WarmUp = samples;
+
+    Reset();
+}
+
+void ChangeDetector::Reset(void)
+{
+    Count = 0;
+    WarmUpMean = WarmUpM2 = 0.0;
+    Statistic = 0.0;
+    Alarm = false;
+
+    ResetStatistic();
+}
+
+bool ChangeDetector::Push(double x)
+{
+    if (Count < WarmUp) {
+        // Welford's update
+        ++Count;
+        const double delta = x - WarmUpMean;
+        WarmUpMean += delta / Count;
+        WarmUpM2 += delta * (x - WarmUpMean);
+
+        if (Count == WarmUp) {
+            Mean = WarmUpMean;
+            StdDev = std::sqrt(WarmUpM2 / Count);
+            ResetStatistic();
+        }
+        return false;
+    }
+
+    ++Count;
+    Statistic = UpdateStatistic(x);
+    Alarm = (Statistic > Threshold);
+
+    return Alarm;
+}
+
+void ChangeDetector::ToStream(std::ostream & os) const
+{
+    os << GetDetectorTypeString(Type) << ": threshold: " << Threshold
+       << ", mean: " << Mean << ", stddev: " << StdDev;
+    if (WarmUp)
+        os << ", warm-up: " << WarmUp << " samples";
+    os << ", samples: " << Count << ", statistic: " << Statistic
+       << ", alarm: " << (Alarm ? "on" : "off");
+}
+
+const std::string ChangeDetector::GetDetectorTypeString(DetectorType type)
+{
+    switch (type) {
+    case DETECTOR_CUSUM:        return "cusum";
+    case DETECTOR_PAGE_HINKLEY: return "page_hinkley";
+    case DETECTOR_EWMA:         return "ewma";
+    }
+
+    return "invalid";
+}
+
+bool ChangeDetector::GetDetectorTypeFromString(const std::string & str, DetectorType & type)
+{
+    const std::string _str = to_lowercase(str);
+
+    if (_str.compare("cusum") == 0)
+        type = DETECTOR_CUSUM;
+    else if (_str.compare("page_hinkley") == 0)
+        type = DETECTOR_PAGE_HINKLEY;
+    else if (_str.compare("ewma") == 0)
+        type = DETECTOR_EWMA;
+    else
+        return false;
+
+    return true;
+}
+
+//--------------------------------------------------
+//  CusumDetector
+//--------------------------------------------------
+CusumDetector::CusumDetector(double drift, double threshold)
+    : ChangeDetector(DETECTOR_CUSUM, threshold), Drift(drift), High(0.0), Low(0.0)
+{
+}
+
+void CusumDetector::ResetStatistic(void)
+{
+    High = Low = 0.0;
+}
+
+double CusumDetector::UpdateStatistic(double x)
+{
+    const double deviation = x - Mean;
+
+    High += deviation - Drift;
+    if (High < 0.0)
+        High = 0.0;
+    Low -= deviation + Drift;
+    if (Low < 0.0)
+        Low = 0.0;
+
+    return (High > Low ? High : Low);
+}
+
+//--------------------------------------------------
+//  PageHinkleyDetector
+//--------------------------------------------------
+PageHinkleyDetector::PageHinkleyDetector(double delta, double threshold)
+    : ChangeDetector(DETECTOR_PAGE_HINKLEY, threshold), Delta(delta)
+{
+    ResetStatistic();
+}
+
+void PageHinkleyDetector::ResetStatistic(void)
+{
+    RunningMean = 0.0;
+    RunningCount = 0;
+    SumUp = SumDown = 0.0;
+    MinUp = MinDown = 0.0;
+}
+
+double PageHinkleyDetector::UpdateStatistic(double x)
+{
+    ++RunningCount;
+    RunningMean += (x - RunningMean) / RunningCount;
+
+    const double deviation = x - RunningMean;
+
+    SumUp += deviation - Delta;
+    if (SumUp < MinUp)
+        MinUp = SumUp;
+    SumDown -= deviation + Delta;
+    if (SumDown < MinDown)
+        MinDown = SumDown;
+
+    const double up = SumUp - MinUp;
+    const double down = SumDown - MinDown;
+
+    return (up > down ? up : down);
+}
+
+//--------------------------------------------------
+//  EwmaDetector
+//--------------------------------------------------
+EwmaDetector::EwmaDetector(double lambda, double width)
+    : ChangeDetector(DETECTOR_EWMA, width), Lambda(lambda)
+{
+    ResetStatistic();
+}
+
+void EwmaDetector::ResetStatistic(void)
+{
+    Z = Mean;
+    Decay = 1.0;
+}
+
+double EwmaDetector::UpdateStatistic(double x)
+{
+    Z = Lambda * x + (1.0 - Lambda) * Z;
+    Decay *= (1.0 - Lambda) * (1.0 - Lambda);
+
+    const double deviation = std::fabs(Z - Mean);
+    const double sigma = StdDev * std::sqrt(Lambda / (2.0 - Lambda) * (1.0 - Decay));
+
+    // Constant signal in control (zero standard deviation)
+    if (sigma <= 0.0)
+        return (deviation > 0.0 ? std::numeric_limits<double>::infinity() : 0.0);
+
+    return deviation / sigma;
+}
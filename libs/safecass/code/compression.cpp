@@ -0,0 +1,178 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include "safecass/compression.h"
+
+using namespace SC;
+using namespace SC::Compression;
+
+namespace {
+
+//! Number of bits to represent x
+inline unsigned int BitWidth(boost::uint64_t x)
+{
+    unsigned int width = 0;
+    while (x) {
+        ++width;
+        x >>= 1;
+    }
+    return width;
+}
+
+//! Number of leading and trailing zeros (x must not be zero)
+#if defined(__GNUC__)
+inline unsigned int LeadingZeros(boost::uint64_t x)  { return (unsigned int) __builtin_clzll(x); }
+inline unsigned int TrailingZeros(boost::uint64_t x) { return (unsigned int) __builtin_ctzll(x); }
+#else
+inline unsigned int LeadingZeros(boost::uint64_t x)  { return 64 - BitWidth(x); }
+inline unsigned int TrailingZeros(boost::uint64_t x)
+{
+    unsigned int n = 0;
+    while ((x & 1) == 0) {
+        ++n;
+        x >>= 1;
+    }
+    return n;
+}
+#endif
+
+};
+
+//
+// Integers: first value, width of zigzag-encoded deltas (7 bits), and deltas
+//
+void Compression::EncodeIntegers(const boost::int64_t * x, size_t n, BitWriter & writer)
+{
+    if (n == 0)
+        return;
+    writer.Write((boost::uint64_t) x[0], 64);
+
+    boost::uint64_t deltas[BLOCK_SIZE];
+    boost::uint64_t all = 0;
+    for (size_t i = 1; i < n; ++i) {
+        deltas[i] = ZigZagEncode((boost::uint64_t) x[i] - (boost::uint64_t) x[i - 1]);
+        all |= deltas[i];
+    }
+
+    const unsigned int width = BitWidth(all);
+    writer.Write(width, 7);
+    for (size_t i = 1; i < n; ++i)
+        writer.Write(deltas[i], width);
+}
+
+void Compression::DecodeIntegers(BitReader & reader, size_t n, boost::int64_t * x)
+{
+    if (n == 0)
+        return;
+    x[0] = (boost::int64_t) reader.Read(64);
+
+    const unsigned int width = (unsigned int) reader.Read(7);
+    for (size_t i = 1; i < n; ++i)
+        x[i] = (boost::int64_t) ((boost::uint64_t) x[i - 1] + ZigZagDecode(reader.Read(width)));
+}
+
+//
+// Timestamps: first timestamp and deltas encoded as integers (i.e., first
+// delta and delta-of-deltas)
+//
+void Compression::EncodeTimestamps(const SC::TimestampType * t, size_t n, BitWriter & writer)
+{
+    if (n == 0)
+        return;
+    writer.Write((boost::uint64_t) t[0], 64);
+
+    boost::int64_t deltas[BLOCK_SIZE];
+    for (size_t i = 1; i < n; ++i)
+        deltas[i - 1] = (boost::int64_t) ((boost::uint64_t) t[i] - (boost::uint64_t) t[i - 1]);
+    EncodeIntegers(deltas, n - 1, writer);
+}
+
+void Compression::DecodeTimestamps(BitReader & reader, size_t n, SC::TimestampType * t)
+{
+    if (n == 0)
+        return;
+    t[0] = (SC::TimestampType) reader.Read(64);
+
+    boost::int64_t deltas[BLOCK_SIZE];
+    DecodeIntegers(reader, n - 1, deltas);
+    for (size_t i = 1; i < n; ++i)
+        t[i] = (SC::TimestampType) ((boost::uint64_t) t[i - 1] + (boost::uint64_t) deltas[i - 1]);
+}
+
+//
+// Floating-point numbers: first value, then for each value XOR'ed with the
+// previous one:
+//   '0'                          : same as previous value
+//   '10' + meaningful bits       : meaningful bits fit in those of previous XOR
+//   '11' + leading zeros (6 bits) + length - 1 (6 bits) + meaningful bits
+//
+void Compression::EncodeFloats(const boost::uint64_t * x, size_t n, unsigned int width, BitWriter & writer)
+{
+    if (n == 0)
+        return;
+    writer.Write(x[0], width);
+
+    // Leading zeros greater than width: no previous XOR
+    unsigned int prevLeading = width + 1, prevTrailing = 0;
+    for (size_t i = 1; i < n; ++i) {
+        const boost::uint64_t xored = x[i] ^ x[i - 1];
+        if (xored == 0) {
+            writer.WriteBit(false);
+            continue;
+        }
+        writer.WriteBit(true);
+
+        const unsigned int leading = LeadingZeros(xored) - (64 - width);
+        const unsigned int trailing = TrailingZeros(xored);
+        if (prevLeading <= width && leading >= prevLeading && trailing >= prevTrailing) {
+            writer.WriteBit(false);
+            writer.Write(xored >> prevTrailing, width - prevLeading - prevTrailing);
+        } else {
+            const unsigned int length = width - leading - trailing;
+            writer.WriteBit(true);
+            writer.Write(leading, 6);
+            writer.Write(length - 1, 6);
+            writer.Write(xored >> trailing, length);
+            prevLeading = leading;
+            prevTrailing = trailing;
+        }
+    }
+}
+
+void Compression::DecodeFloats(BitReader & reader, size_t n, unsigned int width, boost::uint64_t * x)
+{
+    if (n == 0)
+        return;
+    x[0] = reader.Read(width);
+
+    unsigned int prevLeading = width + 1, prevTrailing = 0;
+    for (size_t i = 1; i < n; ++i) {
+        if (!reader.ReadBit()) {
+            x[i] = x[i - 1];
+            continue;
+        }
+
+        boost::uint64_t xored;
+        if (!reader.ReadBit()) {
+            xored = reader.Read(width - prevLeading - prevTrailing) << prevTrailing;
+        } else {
+            const unsigned int leading = (unsigned int) reader.Read(6);
+            const unsigned int length = (unsigned int) reader.Read(6) + 1;
+            const unsigned int trailing = width - leading - length;
+            xored = reader.Read(length) << trailing;
+            prevLeading = leading;
+            prevTrailing = trailing;
+        }
+        x[i] = x[i - 1] ^ xored;
+    }
+}
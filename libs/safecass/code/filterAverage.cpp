@@ -0,0 +1,55 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#include "safecass/filterAverage.h"
+
+using namespace SC;
+
+SC_IMPLEMENT_FACTORY(FilterAverage);
+
+FilterAverage::FilterAverage(void)
+    : FilterSlidingWindow(FilterAverage::Name, FILTERING_INTERNAL, StateMachineInfo(), NONAME, 1),
+      Mean(0.0), Variance(0.0)
+{
+    Initialize();
+}
+
+FilterAverage::FilterAverage(FilteringType            filteringType,
+                             const StateMachineInfo & stateMachineInfo,
+                             const std::string &      inputSignalName,
+                             size_t                   windowSize,
+                             TimestampType            windowDuration)
+    : FilterSlidingWindow(FilterAverage::Name, filteringType, stateMachineInfo, inputSignalName, windowSize, windowDuration),
+      Mean(0.0), Variance(0.0)
+{
+    Initialize();
+}
+
+FilterAverage::FilterAverage(const Json::Value & jsonNode)
+    : FilterSlidingWindow(FilterAverage::Name, jsonNode),
+      Mean(0.0), Variance(0.0)
+{
+    Initialize();
+}
+
+void FilterAverage::Initialize(void)
+{
+    // Define outputs
+    SCASSERT(AddOutputSignal(Mean, GenerateOutputSignalName(NameOfInputSignal, Name, FilterID, 0)));
+    SCASSERT(AddOutputSignal(Variance, GenerateOutputSignalName(NameOfInputSignal, Name, FilterID, 1)));
+}
+
+void FilterAverage::UpdateOutputs(void)
+{
+    Mean.Val = Window->GetMean();
+    Variance.Val = Window->GetVariance();
+}
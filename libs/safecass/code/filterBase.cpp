@@ -7,7 +7,7 @@
 //-----------------------------------------------------------------------------------
 //
 // Created on   : Jan 7, 2012
-// Last revision: May 1, 2016
+// Last revision: Oct 17, 2026
 // Author       : Min Yang Jung <myj@jhu.edu>
 // Github       : https://github.com/safecass/safecass
 //
@@ -140,6 +140,9 @@ FilterBase::FilterBase(const std::string & filterName, const Json::Value & json)
       EventDetectionMode(GetEventDetectionTypeFromString(json["event_type"].asString()))
 {
     Initialize();
+
+    if (json.isMember("event_output") && !EventGate.Configure(json["event_output"]))
+        SCLOG_ERROR << "FilterBase: invalid event output: " << JsonWrapper::GetJsonString(json["event_output"]) << std::endl;
 }
 
 void FilterBase::Initialize(void)
@@ -152,10 +155,25 @@ void FilterBase::Initialize(void)
 
     // Initialize safety coordinator instance (used for event generation by derived filter classes)
     SafetyCoordinator = 0;
+
+    EventSink = 0;
+
+    StringTable * strings = StringTable::GetInstance();
+    TargetComponentID = strings->Intern(StateMachineRegistered.GetComponentName());
+    TargetInterfaceID = strings->Intern(StateMachineRegistered.GetInterfaceName());
+
+    Injection.Signal = 0;
+    Injection.Value = 0;
 }
 
 FilterBase::~FilterBase()
 {
+    ReleaseInjection();
+    while (!InjectionQueue.empty()) {
+        delete InjectionQueue.front().Value;
+        InjectionQueue.pop();
+    }
+
     for (size_t i = 0; i < InputSignals.size(); ++i)
         delete InputSignals[i];
     for (size_t i = 0; i < OutputSignals.size(); ++i)
@@ -165,14 +183,22 @@ FilterBase::~FilterBase()
     if (EventLocation) delete EventLocation;
 }
 
+SignalElement * FilterBase::FindSignalElement(const SignalElementsType & signals, StringIDType nameId)
+{
+    for (size_t i = 0; i < signals.size(); ++i) {
+        SCASSERT(signals[i]);
+        if (signals[i]->GetNameID() == nameId)
+            return signals[i];
+    }
+
+    return 0;
+}
+
 bool FilterBase::AddInputSignal(ParamBase & signalObject, const std::string & signalName)
 {
-    for (size_t i = 0; i < InputSignals.size(); ++i) {
-        SCASSERT(InputSignals[i]);
-        if (InputSignals[i]->GetName().compare(signalName) == 0) {
-            SCLOG_ERROR << "Failed to add input signal (duplicate name): \"" << signalName << "\"" << std::endl;
-            return false;
-        }
+    if (FindSignalElement(InputSignals, StringTable::GetInstance()->Intern(signalName))) {
+        SCLOG_ERROR << "Failed to add input signal (duplicate name): \"" << signalName << "\"" << std::endl;
+        return false;
     }
 
     // FIXME where to set history buffer instance???
@@ -186,12 +212,9 @@ bool FilterBase::AddInputSignal(ParamBase & signalObject, const std::string & si
 
 bool FilterBase::AddOutputSignal(ParamBase & signalObject, const std::string & signalName)
 {
-    for (size_t i = 0; i < OutputSignals.size(); ++i) {
-        SCASSERT(OutputSignals[i]);
-        if (OutputSignals[i]->GetName().compare(signalName) == 0) {
-            SCLOG_ERROR << "Failed to add output signal (duplicate name): \"" << signalName << "\"" << std::endl;
-            return false;
-        }
+    if (FindSignalElement(OutputSignals, StringTable::GetInstance()->Intern(signalName))) {
+        SCLOG_ERROR << "Failed to add output signal (duplicate name): \"" << signalName << "\"" << std::endl;
+        return false;
     }
 
     // FIXME where to set history buffer instance???
@@ -209,57 +232,99 @@ bool FilterBase::RefreshSamples(void)
         SCLOG_WARNING << "FilterBase: Filter is not properly initialized: " << *this << std::endl;
         return false;
     }
-    if (!IsEnabled())
+    // Filter that detected event keeps running to detect completion
+    if (IsDisabled())
         return false;
 
-    // If the input queue for fault injection is not emtpy, dequeue one element from the
-    // queue and use it as the next input.
-    // TODO: currently, this deals with only ONE input signal.  This should be extended to
-    // multiple input signals to support multiple inputs.
-
-    /*
-    // Scalar type signal
-    if (InputSignals[0]->GetSignalType() == SignalElement::SCALAR) {
-        if (InjectionQueue.size() > 0) {
-            SignalElement::ScalarType injectedInputScalar = InjectionQueue.front();
-            InjectionQueue.pop();
-            InputSignals[0]->SetPlaceholderScalar(injectedInputScalar);
-        } else {
-            // Fetch new value from history buffer
-            if (!InputSignals[0]->FetchNewValueScalar((FilterType == FilterBase::FILTERING_INTERNAL))) {
-                SCLOG_ERROR << "failed to read input from history buffer: filter => " << *this << std::endl;
-                this->Enable(false); // suppress further error messages due to the same issue
-                // TODO: RESOLVE THIS ISSUE: once Enable(false) is called, a filter is no longer
-                // is usable.  There should be another way(s) to enable this filter again.
-                return false;
-            }
-        }
+    // If the queue for shallow fault injection is not empty, dequeue one element
+    // and use it as the next value of its input signal, in place of the actual
+    // value (see SignalElement::GetValue()).  As the injected value is a copy of
+    // the signal object, this works for signals of any type, scalar or vector.
+    ReleaseInjection();
+    if (!InjectionQueue.empty()) {
+        Injection = InjectionQueue.front();
+        InjectionQueue.pop();
+        Injection.Signal->SetInjected(Injection.Value);
     }
-    // Vector type signal
-    else {
-        // FIXME
-#if 0
-        if (InputQueueVector.size() > 0) {
-            SignalElement::VectorType vec = InputQueueVector.front();
-            InputQueueVector.pop();
-            InputSignals[0]->SetPlaceholderVector(vec);
-        } else {
-            // Fetch new value from history buffer
-            if (!InputSignals[0]->FetchNewValueVector((FilterType == FilterBase::FILTERING_INTERNAL))) {
-                SCLOG_ERROR << "failed to read input from history buffer: filter => " << *this << std::endl;
-                this->Enable(false); // suppress further error messages due to the same issue
-                // TODO: RESOLVE THIS ISSUE: once Enable(false) is called, a filter is no longer
-                // is usable.  There should be another way(s) to enable this filter again.
-                return false;
-            }
+
+    if (EventGate.HasPendingEvent())
+        FlushEvents();
+
+    return true;
+}
+
+void FilterBase::FlushEvents(void)
+{
+    TimestampType now = 0;
+    for (size_t i = 0; i < InputSignals.size(); ++i) {
+        const TimestampType timestamp = InputSignals[i]->GetValue().GetTimestamp();
+        if (i == 0 || timestamp > now)
+            now = timestamp;
+    }
+
+    // One event per signal may be due
+    FilterEvent event;
+    while (EventGate.Flush(now, event)) {
+        if (!EventSink) {
+            SCLOG_WARNING << "FilterBase: no event sink, event dropped: filter \"" << Name << "\"" << std::endl;
+            continue;
         }
-#endif
+        EventSink->OnFilterEvent(this, event);
     }
-*/
+}
+
+void FilterBase::ReleaseInjection(void)
+{
+    if (!Injection.Signal)
+        return;
+
+    Injection.Signal->SetInjected(0);
+    delete Injection.Value;
+    Injection.Signal = 0;
+    Injection.Value = 0;
+}
+
+bool FilterBase::EmitEvent(TimestampType timestamp, const std::string & event)
+{
+    if (!EventSink) {
+        SCLOG_WARNING << "FilterBase: no event sink, event dropped: filter \"" << Name << "\"" << std::endl;
+        return false;
+    }
+    if (EventGate.IsEnabled() && !EventGate.Push(timestamp))
+        return true;
+
+    EventSink->OnFilterEvent(this, timestamp, event);
 
     return true;
 }
 
+bool FilterBase::EmitEvent(const FilterEvent & event)
+{
+    if (!EventSink) {
+        SCLOG_WARNING << "FilterBase: no event sink, event dropped: filter \"" << Name << "\"" << std::endl;
+        return false;
+    }
+    if (EventGate.IsEnabled() && !EventGate.Push(event))
+        return true;
+
+    EventSink->OnFilterEvent(this, event);
+
+    return true;
+}
+
+FilterEvent FilterBase::CreateEvent(StringIDType eventName, TimestampType timestamp) const
+{
+    FilterEvent event;
+    event.FilterUID       = FilterID;
+    event.Name            = eventName;
+    event.Timestamp       = timestamp;
+    event.TargetType      = StateMachineRegistered.GetStateMachineType();
+    event.TargetComponent = TargetComponentID;
+    event.TargetInterface = TargetInterfaceID;
+
+    return event;
+}
+
 std::string FilterBase::GenerateOutputSignalName(const std::string & prefix,
                                                  const std::string & root1,
                                                  const FilterIDType  root2,
@@ -388,11 +453,10 @@ const std::string FilterBase::GetFilteringTypeString(const FilteringType type)
 
 FilterBase::FilteringType FilterBase::GetFilteringTypeFromString(const std::string & str)
 {
-    std::string _str(str);
-    to_uppercase(_str);
+    std::string s = to_lowercase(str);
 
-    if (_str.compare(Dict::FILTERING_INTERNAL) == 0) return FILTERING_INTERNAL;
-    if (_str.compare(Dict::FILTERING_EXTERNAL) == 0) return FILTERING_EXTERNAL;
+    if (s.compare(Dict::FILTERING_INTERNAL) == 0) return FILTERING_INTERNAL;
+    if (s.compare(Dict::FILTERING_EXTERNAL) == 0) return FILTERING_EXTERNAL;
 
     return FILTERING_INTERNAL;
 }
@@ -433,7 +497,29 @@ FilterBase::EventDetectionModeType FilterBase::GetEventDetectionTypeFromString(c
 
 void FilterBase::InjectInput(const std::string & inputSignalName, const ParamBase & arg, bool deepInjection)
 {
-    // FIXME
+    SignalElement * signal = FindSignalElement(InputSignals, StringTable::GetInstance()->Find(inputSignalName));
+    if (!signal) {
+        SCLOG_ERROR << "InjectInput: input signal not found: \"" << inputSignalName << "\"" << std::endl;
+        return;
+    }
+
+    if (deepInjection) {
+        if (!signal->PushNewValue(arg))
+            SCLOG_ERROR << "InjectInput: failed to inject input: \"" << inputSignalName << "\"" << std::endl;
+        return;
+    }
+
+    // Copy of signal object, so that type of value is checked here
+    InjectionType injection;
+    injection.Signal = signal;
+    injection.Value = signal->GetParamPrototype();
+    if (!injection.Value->CopyFrom(arg)) {
+        SCLOG_ERROR << "InjectInput: type mismatch: \"" << inputSignalName << "\"" << std::endl;
+        delete injection.Value;
+        return;
+    }
+
+    InjectionQueue.push(injection);
 }
 
 /*
@@ -470,7 +556,7 @@ const std::string FilterBase::PrintInjectionQueue(void) const
     ss << std::setprecision(5);
     InjectionQueueType copy(InjectionQueue);
     while (!copy.empty()) {
-        ss << copy.front() << " ";
+        ss << "\"" << copy.front().Signal->GetName() << "\": " << *copy.front().Value << " ";
         copy.pop();
     }
 
@@ -485,8 +571,8 @@ void FilterBase::GenerateEventInfo(Json::Value & json) const
     // the sample retrieved from the history buffer.  
     // In case of cisst, note that the state table maintains elapsed time, rather 
     // than absolute time.
-    // FIXME
-    json["event"]["timestamp"] = GetCurrentTimestampString();//GetCurrentTimestamp();
+    // Timestamp is given in nanoseconds as in FilterEvent::ToJson().
+    json["event"]["timestamp"] = (Json::Int64) GetCurrentTimestamp();
 }
 
 // TODO: improve second parameter to handle other options (e.g., json, raw, 
@@ -525,13 +611,14 @@ void FilterBase::ToStream(std::ostream & out, bool verbose) const
         for (size_t i = 0; i < OutputSignals.size(); ++i) {
             out << "[" << i << "] " << (*OutputSignals[i]) << std::endl;
         }
+        // Execution time
+        out << "----- Execution: " << ExecutionStatistics << std::endl;
+        // Event output
+        out << "----- Event output: " << EventGate << std::endl;
         // Input queue
         out << "----- Input queue: ";
         if (InjectionQueue.size())
             out << PrintInjectionQueue() << std::endl;
-        // FIXME
-        // if (InputQueueVector.size())
-            // out << ShowInputQueueVector() << std::endl;
     } else {
         out << "[ " << FilterID << " ] ";
         switch (StateMachineRegistered.GetStateMachineType()) {
@@ -549,11 +636,11 @@ void FilterBase::ToStream(std::ostream & out, bool verbose) const
         // Input signals
         for (size_t i = 0; i < InputSignals.size(); ++i)
             out << "\"" << InputSignals[i]->GetName() << "\"  ";
+        // Events suppressed by event output stage
+        if (EventGate.GetSuppressed())
+            out << "(" << EventGate.GetSuppressed() << " events suppressed)  ";
         // Input queue
         if (InjectionQueue.size())
-            out << "scalar [ " << PrintInjectionQueue() << " ]";
-        // FIXME
-        // if (InputQueueVector.size())
-            // out << "vector [ " << ShowInputQueueVector() << " ]";
+            out << "[ " << PrintInjectionQueue() << " ]";
     }
 }
@@ -0,0 +1,183 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#include "safecass/filterDriftDetection.h"
+
+#include "common/jsonwrapper.h"
+
+using namespace SC;
+
+SC_IMPLEMENT_FACTORY(FilterDriftDetection);
+
+FilterDriftDetection::FilterDriftDetection(void)
+    : FilterBase(FilterDriftDetection::Name, FILTERING_INTERNAL, StateMachineInfo()),
+      NameOfInputSignal(NONAME),
+      Input(0.0), Statistic(0.0), Alarm(0.0),
+      Detector(new CusumDetector(0.5, 5.0))
+{
+    Initialize();
+}
+
+FilterDriftDetection::FilterDriftDetection(FilterBase::FilteringType          filteringType,
+                                           const StateMachineInfo &           stateMachineInfo,
+                                           const std::string &                inputSignalName,
+                                           ChangeDetector::DetectorType       detectorType,
+                                           double                             param1,
+                                           double                             threshold,
+                                           const std::string &                eventNameOnset,
+                                           const std::string &                eventNameCompletion,
+                                           FilterBase::EventDetectionModeType eventDetectionMode)
+    : FilterBase(FilterDriftDetection::Name, filteringType, stateMachineInfo, eventDetectionMode),
+      NameOfInputSignal(inputSignalName),
+      EventNameOnset(eventNameOnset),
+      EventNameCompletion(eventNameCompletion),
+      EventIDOnset(StringTable::GetInstance()->Intern(eventNameOnset)),
+      EventIDCompletion(StringTable::GetInstance()->Intern(eventNameCompletion)),
+      Input(0.0), Statistic(0.0), Alarm(0.0),
+      Detector(ChangeDetector::Create(detectorType, param1, threshold))
+{
+    SCASSERT(Detector);
+
+    Initialize();
+}
+
+FilterDriftDetection::FilterDriftDetection(const Json::Value & jsonNode)
+    : FilterBase(FilterDriftDetection::Name, jsonNode),
+      NameOfInputSignal(jsonNode["argument"].get("input_signal", NONAME).asString()),
+      EventIDOnset(INVALID_STRING_ID), EventIDCompletion(INVALID_STRING_ID),
+      Input(0.0), Statistic(0.0), Alarm(0.0),
+      Detector(new CusumDetector(0.5, 5.0))
+{
+    Initialize();
+
+    if (!ConfigureFilter(jsonNode))
+        SCLOG_ERROR << "FilterDriftDetection: invalid configuration: " << JsonWrapper::GetJsonString(jsonNode) << std::endl;
+}
+
+FilterDriftDetection::~FilterDriftDetection()
+{
+    delete Detector;
+}
+
+void FilterDriftDetection::Initialize(void)
+{
+    // Define inputs
+    SCASSERT(AddInputSignal(Input, NameOfInputSignal));
+
+    // Define outputs
+    SCASSERT(AddOutputSignal(Statistic, GenerateOutputSignalName(NameOfInputSignal, Name, FilterID, 0)));
+    SCASSERT(AddOutputSignal(Alarm, GenerateOutputSignalName(NameOfInputSignal, Name, FilterID, 1)));
+}
+
+bool FilterDriftDetection::ConfigureFilter(const Json::Value & jsonNode)
+{
+    const Json::Value & argument = jsonNode["argument"];
+
+    ChangeDetector::DetectorType type;
+    const std::string typeString = argument.get("detector", "cusum").asString();
+    if (!ChangeDetector::GetDetectorTypeFromString(typeString, type)) {
+        SCLOG_ERROR << "FilterDriftDetection: invalid detector: " << typeString << std::endl;
+        return false;
+    }
+
+    ChangeDetector * detector = ChangeDetector::Create(type,
+                                                       argument["drift"].asDouble(),
+                                                       argument["threshold"].asDouble());
+    if (!detector)
+        return false;
+
+    if (argument.isMember("mean")) {
+        detector->SetTarget(argument["mean"].asDouble(), argument.get("stddev", 1.0).asDouble());
+    } else {
+        const int warmUp = argument.get("warm_up", 0).asInt();
+        if (warmUp <= 0 && type != ChangeDetector::DETECTOR_PAGE_HINKLEY) {
+            SCLOG_ERROR << "FilterDriftDetection: neither mean nor warm_up is given" << std::endl;
+            delete detector;
+            return false;
+        }
+        if (warmUp > 0)
+            detector->SetWarmUp((size_t) warmUp);
+    }
+
+    delete Detector;
+    Detector = detector;
+
+    EventNameOnset = argument["event_onset"].asString();
+    EventNameCompletion = argument["event_completion"].asString();
+    EventIDOnset = StringTable::GetInstance()->Intern(EventNameOnset);
+    EventIDCompletion = StringTable::GetInstance()->Intern(EventNameCompletion);
+
+    return true;
+}
+
+bool FilterDriftDetection::InitFilter(void)
+{
+    Detector->Reset();
+    Statistic.Val = Alarm.Val = 0.0;
+
+    return true;
+}
+
+void FilterDriftDetection::CleanupFilter(void)
+{
+}
+
+void FilterDriftDetection::RunFilter(void)
+{
+    if (!FilterBase::RefreshSamples())
+        return;
+
+    const double x = GetInputValue<ParamType>(0).Val;
+    if (x != x)
+        return;
+
+    const bool wasAlarm = Detector->IsAlarm();
+    const bool alarm = Detector->Push(x);
+
+    Statistic.Val = Detector->GetStatistic();
+    Alarm.Val = (alarm ? 1.0 : 0.0);
+
+    FilterState = (alarm ? FilterBase::STATE_DETECTED : FilterBase::STATE_ENABLED);
+
+    const bool level = (EventDetectionMode == FilterBase::EVENT_DETECTION_LEVEL);
+    if (alarm && (level || !wasAlarm))
+        EmitEvent(GenerateEvent(DRIFT_ONSET));
+    else if (!alarm && wasAlarm)
+        EmitEvent(GenerateEvent(DRIFT_COMPLETION));
+}
+
+FilterEvent FilterDriftDetection::GenerateEvent(EVENT_TYPE eventType) const
+{
+    const ParamType & input = GetInputValue<ParamType>(0);
+
+    FilterEvent event = CreateEvent(eventType == DRIFT_ONSET ? EventIDOnset : EventIDCompletion, input.GetTimestamp());
+    event.Signal = InputSignals[0]->GetNameID();
+    event.AddPayload(input.Val);
+    event.AddPayload(Detector->GetStatistic());
+
+    return event;
+}
+
+void FilterDriftDetection::ToStream(std::ostream & outputStream, bool verbose) const
+{
+    BaseType::ToStream(outputStream, verbose);
+
+    if (!verbose) {
+        outputStream << *Detector;
+        return;
+    }
+
+    outputStream << "----- Filter-specifics: " << std::endl
+                 << "Detector   : " << *Detector << std::endl
+                 << "Onset      : " << EventNameOnset << std::endl
+                 << "Completion : " << EventNameCompletion << std::endl;
+}
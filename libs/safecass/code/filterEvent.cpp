@@ -0,0 +1,84 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#include "safecass/filterEvent.h"
+
+using namespace SC;
+
+FilterEvent::FilterEvent(void)
+    : FilterUID(0), Name(INVALID_STRING_ID), Timestamp(0),
+      TargetType(State::STATEMACHINE_INVALID), TargetComponent(INVALID_STRING_ID), TargetInterface(INVALID_STRING_ID),
+      Signal(INVALID_STRING_ID), Elements(0), PayloadSize(0)
+{
+}
+
+bool FilterEvent::AddPayload(double value)
+{
+    if (PayloadSize == PAYLOAD_SIZE)
+        return false;
+
+    Payload[PayloadSize++] = value;
+
+    return true;
+}
+
+void FilterEvent::ToJson(Json::Value & json) const
+{
+    const StringTable * strings = StringTable::GetInstance();
+
+    Json::Value & event = json["event"];
+    event["fuid"] = (unsigned int) FilterUID;
+    event["name"] = strings->GetString(Name);
+    event["timestamp"] = (Json::Int64) Timestamp;
+    if (Signal != INVALID_STRING_ID)
+        event["signal"] = strings->GetString(Signal);
+    if (PayloadSize > 0)
+        event["value"] = Payload[0];
+    if (PayloadSize > 1)
+        for (unsigned int i = 0; i < PayloadSize; ++i)
+            event["payload"].append(Payload[i]);
+    for (int i = 0; i < 64 && (Elements >> i); ++i)
+        if ((Elements >> i) & 1)
+            event["elements"].append(i);
+
+    Json::Value & target = json["target"];
+    target["type"]      = (int) TargetType;
+    target["component"] = strings->GetString(TargetComponent);
+    target["interface"] = strings->GetString(TargetInterface);
+}
+
+std::string FilterEvent::ToJsonString(void) const
+{
+    Json::Value json;
+    ToJson(json);
+
+    return JsonWrapper::GetJsonString(json);
+}
+
+void FilterEvent::ToStream(std::ostream & outputStream) const
+{
+    const StringTable * strings = StringTable::GetInstance();
+
+    outputStream << "[" << FilterUID << "] \"" << strings->GetString(Name) << "\" at " << Timestamp
+                 << ", target: " << State::GetString(TargetType)
+                 << " \"" << strings->GetString(TargetComponent) << "\""
+                 << " \"" << strings->GetString(TargetInterface) << "\"";
+    if (Signal != INVALID_STRING_ID)
+        outputStream << ", signal: \"" << strings->GetString(Signal) << "\"";
+    if (PayloadSize > 0) {
+        outputStream << ", payload:";
+        for (unsigned int i = 0; i < PayloadSize; ++i)
+            outputStream << " " << Payload[i];
+    }
+    if (Elements)
+        outputStream << ", elements: 0x" << std::hex << Elements << std::dec;
+}
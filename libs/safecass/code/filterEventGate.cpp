@@ -0,0 +1,252 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#include "safecass/filterEventGate.h"
+
+#include <cmath>
+
+using namespace SC;
+
+FilterEventGate::FilterEventGate(void)
+    : MinDwellTime(0), HysteresisBand(0.0), MaxRate(0.0), Interval(0), Burst(0)
+{
+    Reset();
+}
+
+bool FilterEventGate::Configure(TimestampType minDwellTime, double hysteresisBand, double maxRate)
+{
+    if (minDwellTime < 0 || hysteresisBand < 0.0 || maxRate < 0.0) {
+        SCLOG_ERROR << "FilterEventGate: negative argument: dwell time " << minDwellTime
+                    << ", hysteresis " << hysteresisBand << ", max rate " << maxRate << std::endl;
+        return false;
+    }
+    // Flips held by hysteresis are released after dwell time only
+    if (hysteresisBand > 0.0 && minDwellTime == 0) {
+        SCLOG_ERROR << "FilterEventGate: hysteresis " << hysteresisBand << " without dwell time" << std::endl;
+        return false;
+    }
+
+    MinDwellTime = minDwellTime;
+    HysteresisBand = hysteresisBand;
+    MaxRate = maxRate;
+
+    // Bursts of up to one second worth of events (at least one)
+    if (maxRate > 0.0) {
+        Interval = (TimestampType) (1e9 / maxRate);
+        const double burst = std::floor(maxRate);
+        Burst = (burst > 1.0 ? (TimestampType) (burst - 1.0) * Interval : 0);
+    } else
+        Interval = Burst = 0;
+
+    Reset();
+
+    return true;
+}
+
+bool FilterEventGate::Configure(const Json::Value & json)
+{
+    return Configure((TimestampType) (json.get("min_dwell_time", 0.0).asDouble() * 1e9),
+                     json.get("hysteresis", 0.0).asDouble(),
+                     json.get("max_rate", 0.0).asDouble());
+}
+
+void FilterEventGate::Reset(void)
+{
+    Channels.clear();
+    NumberOfPending = 0;
+
+    NextArrival = 0;
+    HasNextArrival = false;
+
+    Delivered = Released = 0;
+    for (size_t i = 0; i < NUMBER_OF_REASONS; ++i)
+        Suppressed[i] = 0;
+}
+
+bool FilterEventGate::AllowRate(TimestampType timestamp)
+{
+    if (MaxRate <= 0.0)
+        return true;
+
+    if (HasNextArrival && timestamp < NextArrival - Burst)
+        return false;
+
+    NextArrival = (HasNextArrival && NextArrival > timestamp ? NextArrival : timestamp) + Interval;
+    HasNextArrival = true;
+
+    return true;
+}
+
+FilterEventGate::ChannelType & FilterEventGate::GetChannel(StringIDType signal)
+{
+    // Filters monitor a few signals: linear search
+    for (size_t i = 0; i < Channels.size(); ++i)
+        if (Channels[i].Signal == signal)
+            return Channels[i];
+
+    ChannelType channel;
+    channel.Signal = signal;
+    channel.HasCurrent = false;
+    channel.CurrentName = INVALID_STRING_ID;
+    channel.CurrentTimestamp = 0;
+    channel.HasCurrentValue = false;
+    channel.CurrentValue = 0.0;
+    channel.HasPending = false;
+    channel.PendingReason = SUPPRESSED_DWELL;
+    Channels.push_back(channel);
+
+    return Channels.back();
+}
+
+void FilterEventGate::SetCurrent(ChannelType & channel, const FilterEvent & event)
+{
+    channel.HasCurrent = true;
+    channel.CurrentName = event.Name;
+    channel.CurrentTimestamp = event.Timestamp;
+    channel.HasCurrentValue = (event.PayloadSize > 0);
+    channel.CurrentValue = (channel.HasCurrentValue ? event.Payload[0] : 0.0);
+}
+
+bool FilterEventGate::Hold(ChannelType & channel, const FilterEvent & event, ReasonType reason)
+{
+    Drop(channel);
+
+    channel.HasPending = true;
+    channel.PendingReason = reason;
+    channel.Pending = event;
+    ++NumberOfPending;
+
+    return false;
+}
+
+void FilterEventGate::Drop(ChannelType & channel)
+{
+    if (!channel.HasPending)
+        return;
+
+    channel.HasPending = false;
+    --NumberOfPending;
+    ++Suppressed[channel.PendingReason];
+}
+
+bool FilterEventGate::Push(const FilterEvent & event)
+{
+    ChannelType & channel = GetChannel(event.Signal);
+
+    // Repeated event: the input went back if event is held
+    if (channel.HasCurrent && event.Name == channel.CurrentName) {
+        if (channel.HasPending) {
+            // Both events held and repeated are suppressed
+            ++Suppressed[channel.PendingReason];
+            Drop(channel);
+            return false;
+        }
+        if (!AllowRate(event.Timestamp)) {
+            ++Suppressed[SUPPRESSED_RATE];
+            return false;
+        }
+        ++Delivered;
+        return true;
+    }
+
+    // Flip (or first event)
+    if (channel.HasCurrent) {
+        if (MinDwellTime > 0 && event.Timestamp - channel.CurrentTimestamp < MinDwellTime)
+            return Hold(channel, event, SUPPRESSED_DWELL);
+        if (HysteresisBand > 0.0 && channel.HasCurrentValue && event.PayloadSize > 0 &&
+            std::abs(event.Payload[0] - channel.CurrentValue) < HysteresisBand)
+            return Hold(channel, event, SUPPRESSED_HYSTERESIS);
+    }
+    // Flip should not be lost: held until rate allows
+    if (!AllowRate(event.Timestamp))
+        return Hold(channel, event, SUPPRESSED_RATE);
+
+    Drop(channel);
+    SetCurrent(channel, event);
+    ++Delivered;
+
+    return true;
+}
+
+bool FilterEventGate::Push(TimestampType timestamp)
+{
+    if (!AllowRate(timestamp)) {
+        ++Suppressed[SUPPRESSED_RATE];
+        return false;
+    }
+    ++Delivered;
+
+    return true;
+}
+
+bool FilterEventGate::IsDue(const ChannelType & channel, TimestampType now) const
+{
+    switch (channel.PendingReason) {
+    case SUPPRESSED_DWELL:
+        return (now - channel.CurrentTimestamp >= MinDwellTime);
+    case SUPPRESSED_HYSTERESIS:
+        return (now - channel.Pending.Timestamp >= MinDwellTime);
+    default:
+        return true;
+    }
+}
+
+bool FilterEventGate::Flush(TimestampType now, FilterEvent & released)
+{
+    if (NumberOfPending == 0)
+        return false;
+
+    for (size_t i = 0; i < Channels.size(); ++i) {
+        ChannelType & channel = Channels[i];
+        if (!channel.HasPending || !IsDue(channel, now))
+            continue;
+        if (!AllowRate(now))
+            return false;
+
+        released = channel.Pending;
+        channel.HasPending = false;
+        --NumberOfPending;
+        SetCurrent(channel, released);
+        ++Released;
+
+        return true;
+    }
+
+    return false;
+}
+
+size_t FilterEventGate::GetSuppressed(void) const
+{
+    size_t sum = 0;
+    for (size_t i = 0; i < NUMBER_OF_REASONS; ++i)
+        sum += Suppressed[i];
+
+    return sum;
+}
+
+void FilterEventGate::ToStream(std::ostream & os) const
+{
+    if (!IsEnabled()) {
+        os << "not used";
+        return;
+    }
+
+    os << "dwell time: " << MinDwellTime / 1e6 << " ms, hysteresis: " << HysteresisBand
+       << ", max rate: " << MaxRate << "/s"
+       << ", delivered: " << Delivered
+       << ", suppressed (dwell: " << Suppressed[SUPPRESSED_DWELL]
+       << ", hysteresis: " << Suppressed[SUPPRESSED_HYSTERESIS]
+       << ", rate: " << Suppressed[SUPPRESSED_RATE] << ")"
+       << ", released: " << Released;
+    if (NumberOfPending)
+        os << ", " << NumberOfPending << " pending";
+}
@@ -0,0 +1,211 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#include "safecass/filterExecutionStatistics.h"
+
+#include <iomanip>
+
+using namespace SC;
+
+FilterExecutionStatistics::FilterExecutionStatistics(void)
+{
+    Reset();
+}
+
+FilterExecutionStatistics::FilterExecutionStatistics(const FilterExecutionStatistics & other)
+{
+    boost::mutex::scoped_lock lock(other.Mutex);
+    CopyFrom(other);
+}
+
+FilterExecutionStatistics & FilterExecutionStatistics::operator=(const FilterExecutionStatistics & other)
+{
+    if (this == &other)
+        return *this;
+
+    // Snapshot first so that two locks are never held at once
+    const FilterExecutionStatistics snapshot(other);
+    boost::mutex::scoped_lock lock(Mutex);
+    CopyFrom(snapshot);
+
+    return *this;
+}
+
+void FilterExecutionStatistics::CopyFrom(const FilterExecutionStatistics & other)
+{
+    for (size_t i = 0; i < NUMBER_OF_BINS; ++i)
+        Bins[i] = other.Bins[i];
+    Count = other.Count;
+    Total = other.Total;
+    Max = other.Max;
+    Deferred = other.Deferred;
+    Offloaded = other.Offloaded;
+    Skipped = other.Skipped;
+}
+
+void FilterExecutionStatistics::Reset(void)
+{
+    boost::mutex::scoped_lock lock(Mutex);
+    for (size_t i = 0; i < NUMBER_OF_BINS; ++i)
+        Bins[i] = 0;
+    Count = 0;
+    Total = Max = 0;
+    Deferred = Offloaded = Skipped = 0;
+}
+
+size_t FilterExecutionStatistics::GetBin(TimestampType elapsed)
+{
+    TimestampType us = elapsed / 1000;
+    size_t bin = 0;
+    while (us > 0 && bin < NUMBER_OF_BINS - 1) {
+        ++bin;
+        us >>= 1;
+    }
+    return bin;
+}
+
+TimestampType FilterExecutionStatistics::GetBinUpperBound(size_t bin)
+{
+    if (bin >= NUMBER_OF_BINS - 1)
+        return 0;
+    return ((TimestampType) 1) << bin;
+}
+
+void FilterExecutionStatistics::Record(TimestampType elapsed)
+{
+    boost::mutex::scoped_lock lock(Mutex);
+    ++Bins[GetBin(elapsed)];
+    ++Count;
+    Total += elapsed;
+    if (elapsed > Max)
+        Max = elapsed;
+}
+
+void FilterExecutionStatistics::RecordDeferred(void)
+{
+    boost::mutex::scoped_lock lock(Mutex);
+    ++Deferred;
+}
+
+void FilterExecutionStatistics::RecordOffloaded(void)
+{
+    boost::mutex::scoped_lock lock(Mutex);
+    ++Offloaded;
+}
+
+void FilterExecutionStatistics::RecordSkipped(void)
+{
+    boost::mutex::scoped_lock lock(Mutex);
+    ++Skipped;
+}
+
+size_t FilterExecutionStatistics::GetBinCount(size_t bin) const
+{
+    boost::mutex::scoped_lock lock(Mutex);
+    return (bin < NUMBER_OF_BINS ? Bins[bin] : 0);
+}
+
+size_t FilterExecutionStatistics::GetCount(void) const
+{
+    boost::mutex::scoped_lock lock(Mutex);
+    return Count;
+}
+
+TimestampType FilterExecutionStatistics::GetTotal(void) const
+{
+    boost::mutex::scoped_lock lock(Mutex);
+    return Total;
+}
+
+TimestampType FilterExecutionStatistics::GetMax(void) const
+{
+    boost::mutex::scoped_lock lock(Mutex);
+    return Max;
+}
+
+double FilterExecutionStatistics::GetMean(void) const
+{
+    boost::mutex::scoped_lock lock(Mutex);
+    return (Count == 0 ? 0.0 : (double) Total / (double) Count);
+}
+
+size_t FilterExecutionStatistics::GetDeferred(void) const
+{
+    boost::mutex::scoped_lock lock(Mutex);
+    return Deferred;
+}
+
+size_t FilterExecutionStatistics::GetOffloaded(void) const
+{
+    boost::mutex::scoped_lock lock(Mutex);
+    return Offloaded;
+}
+
+size_t FilterExecutionStatistics::GetSkipped(void) const
+{
+    boost::mutex::scoped_lock lock(Mutex);
+    return Skipped;
+}
+
+size_t FilterExecutionStatistics::GetPercentileBin(double percentile) const
+{
+    boost::mutex::scoped_lock lock(Mutex);
+    if (Count == 0)
+        return 0;
+
+    // Number of runs at or below the percentile (at least one)
+    size_t target = (size_t) (percentile * (double) Count + 0.5);
+    if (target == 0)
+        target = 1;
+
+    size_t sum = 0;
+    for (size_t i = 0; i < NUMBER_OF_BINS; ++i) {
+        sum += Bins[i];
+        if (sum >= target)
+            return i;
+    }
+    return NUMBER_OF_BINS - 1;
+}
+
+void FilterExecutionStatistics::ToStream(std::ostream & os) const
+{
+    const std::ios::fmtflags f(os.flags());
+    const std::streamsize precision = os.precision();
+
+    // Counters of snapshot are consistent with each other
+    const FilterExecutionStatistics s(*this);
+
+    os << "runs: " << s.Count << std::fixed << std::setprecision(1)
+       << ", mean: " << s.GetMean() / 1e3 << " us, max: " << s.Max / 1e3 << " us";
+    if (s.Count) {
+        const size_t p99 = s.GetPercentileBin(0.99);
+        if (GetBinUpperBound(p99))
+            os << ", p99 < " << GetBinUpperBound(p99) << " us";
+        else
+            os << ", p99 >= " << GetBinUpperBound(p99 - 1) << " us";
+    }
+    os << ", deferred: " << s.Deferred << ", offloaded: " << s.Offloaded << ", skipped: " << s.Skipped;
+
+    // Non-empty bins only
+    os << ", histogram (us):";
+    for (size_t i = 0; i < NUMBER_OF_BINS; ++i) {
+        if (s.Bins[i] == 0)
+            continue;
+        if (GetBinUpperBound(i))
+            os << " <" << GetBinUpperBound(i) << ":" << s.Bins[i];
+        else
+            os << " >=" << GetBinUpperBound(i - 1) << ":" << s.Bins[i];
+    }
+
+    os.flags(f);
+    os.precision(precision);
+}
@@ -0,0 +1,55 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#include "safecass/filterMinMax.h"
+
+using namespace SC;
+
+SC_IMPLEMENT_FACTORY(FilterMinMax);
+
+FilterMinMax::FilterMinMax(void)
+    : FilterSlidingWindow(FilterMinMax::Name, FILTERING_INTERNAL, StateMachineInfo(), NONAME, 1),
+      Min(0.0), Max(0.0)
+{
+    Initialize();
+}
+
+FilterMinMax::FilterMinMax(FilteringType            filteringType,
+                           const StateMachineInfo & stateMachineInfo,
+                           const std::string &      inputSignalName,
+                           size_t                   windowSize,
+                           TimestampType            windowDuration)
+    : FilterSlidingWindow(FilterMinMax::Name, filteringType, stateMachineInfo, inputSignalName, windowSize, windowDuration),
+      Min(0.0), Max(0.0)
+{
+    Initialize();
+}
+
+FilterMinMax::FilterMinMax(const Json::Value & jsonNode)
+    : FilterSlidingWindow(FilterMinMax::Name, jsonNode),
+      Min(0.0), Max(0.0)
+{
+    Initialize();
+}
+
+void FilterMinMax::Initialize(void)
+{
+    // Define outputs
+    SCASSERT(AddOutputSignal(Min, GenerateOutputSignalName(NameOfInputSignal, Name, FilterID, 0)));
+    SCASSERT(AddOutputSignal(Max, GenerateOutputSignalName(NameOfInputSignal, Name, FilterID, 1)));
+}
+
+void FilterMinMax::UpdateOutputs(void)
+{
+    Min.Val = Window->GetMin();
+    Max.Val = Window->GetMax();
+}
@@ -0,0 +1,471 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#include "safecass/filterPipeline.h"
+
+#include <map>
+#include <algorithm>
+#include <sstream>
+#include <set>
+#include <iomanip>
+#include <typeinfo>
+
+using namespace SC;
+
+//
+// FilterOffloadQueue
+//
+FilterOffloadQueue::FilterOffloadQueue(void): Busy(false), Running(false)
+{
+}
+
+bool FilterOffloadQueue::IsBusy(void) const
+{
+    boost::mutex::scoped_lock lock(Mutex);
+    return Busy;
+}
+
+void FilterOffloadQueue::Reserve(size_t size)
+{
+    boost::mutex::scoped_lock lock(Mutex);
+    Filters.reserve(size);
+}
+
+bool FilterOffloadQueue::Push(FilterBase * const * filters, size_t size)
+{
+    boost::mutex::scoped_lock lock(Mutex);
+    if (Busy)
+        return false;
+
+    Filters.assign(filters, filters + size);
+    Busy = true;
+
+    return true;
+}
+
+size_t FilterOffloadQueue::Run(void)
+{
+    {
+        boost::mutex::scoped_lock lock(Mutex);
+        if (!Busy)
+            return 0;
+        Running = true;
+    }
+
+    // The component thread does not touch Filters while Busy is true
+    TimestampType start = GetMonotonicTimestamp();
+    for (size_t i = 0; i < Filters.size(); ++i) {
+        Filters[i]->RunFilter();
+
+        const TimestampType end = GetMonotonicTimestamp();
+        Filters[i]->GetExecutionStatistics().Record(end - start);
+        start = end;
+    }
+
+    boost::mutex::scoped_lock lock(Mutex);
+    Busy = Running = false;
+    Completed.notify_all();
+
+    return Filters.size();
+}
+
+void FilterOffloadQueue::Cancel(FilterBase * const * filters)
+{
+    boost::mutex::scoped_lock lock(Mutex);
+    if (!Busy || Filters.empty() || Filters.front() != filters[0])
+        return;
+
+    if (!Running) {
+        Busy = false;
+        return;
+    }
+
+    while (Busy)
+        Completed.wait(lock);
+}
+
+//
+// FilterPipeline
+//
+FilterPipeline::FilterPipeline(void)
+    : Built(false), MeasureLatency(true), Budget(0), OverrunPolicy(OVERRUN_DEFER), OffloadQueue(0),
+      Cursor(0), OffloadedFrom(0), NumberOfOverruns(0)
+{
+}
+
+FilterPipeline::~FilterPipeline()
+{
+    Unbind();
+}
+
+bool FilterPipeline::AddFilter(FilterBase * filter)
+{
+    if (!filter) {
+        SCLOG_ERROR << "FilterPipeline: null filter" << std::endl;
+        return false;
+    }
+    for (size_t i = 0; i < Filters.size(); ++i) {
+        if (Filters[i] == filter) {
+            SCLOG_ERROR << "FilterPipeline: filter already in pipeline: \"" << filter->GetFilterName() << "\"" << std::endl;
+            return false;
+        }
+    }
+
+    Filters.push_back(filter);
+
+    Unbind();
+    Stages.clear();
+    SortedFilters.clear();
+    Built = false;
+
+    return true;
+}
+
+void FilterPipeline::Unbind(void)
+{
+    // Offloaded stages read the copies: no input signal is unbound or copy
+    // deleted until they complete
+    if (OffloadedFrom < Stages.size())
+        OffloadQueue->Cancel(&SortedFilters[OffloadedFrom]);
+
+    for (size_t i = 0; i < BoundInputs.size(); ++i) {
+        BoundInputs[i].Input->SetSource(0);
+        delete BoundInputs[i].Copy;
+    }
+    BoundInputs.clear();
+
+    Cursor = 0;
+    OffloadedFrom = Stages.size();
+}
+
+bool FilterPipeline::Build(void)
+{
+    Unbind();
+    Stages.clear();
+    SortedFilters.clear();
+    Built = false;
+
+    const size_t n = Filters.size();
+
+    // Producer of each output signal
+    typedef std::pair<size_t, const SignalElement *> ProducerType;
+    typedef std::map<StringIDType, ProducerType> ProducersType;
+    ProducersType producers;
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < Filters[i]->GetNumberOfOutputSignal(); ++j) {
+            const SignalElement * output = Filters[i]->GetOutputSignalElement(j);
+            const ProducerType producer(i, output);
+            if (!producers.insert(std::make_pair(output->GetNameID(), producer)).second) {
+                SCLOG_ERROR << "FilterPipeline: signal \"" << output->GetName() << "\" is written by filters \""
+                            << Filters[producers[output->GetNameID()].first]->GetFilterName() << "\" and \""
+                            << Filters[i]->GetFilterName() << "\"" << std::endl;
+                return false;
+            }
+        }
+    }
+
+    // Edges from producer to consumer, and input signals to bind
+    std::vector<std::vector<size_t> > consumers(n);
+    std::vector<size_t> numberOfProducers(n, 0);
+    std::vector<BindingType> bindings;
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < Filters[i]->GetNumberOfInputSignal(); ++j) {
+            SignalElement * input = Filters[i]->GetInputSignalElement(j);
+            ProducersType::const_iterator it = producers.find(input->GetNameID());
+            if (it == producers.end())
+                continue;
+
+            const size_t producer = it->second.first;
+            const ParamBase & output = it->second.second->GetParam();
+            if (typeid(output) != typeid(input->GetParam())) {
+                SCLOG_ERROR << "FilterPipeline: type mismatch of signal \"" << input->GetName() << "\" between filters \""
+                            << Filters[producer]->GetFilterName() << "\" and \"" << Filters[i]->GetFilterName()
+                            << "\"" << std::endl;
+                return false;
+            }
+            BindingType binding;
+            binding.Input = input;
+            binding.Source = &output;
+            binding.Producer = producer; // index of filter until sorted
+            binding.Consumer = i;
+            binding.Copy = 0;
+            bindings.push_back(binding);
+
+            // A filter may read more than one output of the same upstream filter
+            std::vector<size_t> & edges = consumers[producer];
+            if (std::find(edges.begin(), edges.end(), i) == edges.end()) {
+                edges.push_back(i);
+                ++numberOfProducers[i];
+            }
+        }
+    }
+
+    // Topological sort (Kahn's algorithm); independent filters run in the order added
+    std::set<size_t> ready;
+    for (size_t i = 0; i < n; ++i)
+        if (numberOfProducers[i] == 0)
+            ready.insert(i);
+
+    StagesType stages;
+    stages.reserve(n);
+    std::vector<size_t> stageOfFilter(n);
+    while (!ready.empty()) {
+        const size_t i = *ready.begin();
+        ready.erase(ready.begin());
+        stageOfFilter[i] = stages.size();
+
+        StageType stage;
+        stage.Filter = Filters[i];
+        stage.LastFilterOfPipeline = consumers[i].empty();
+        ResetLatency(stage.Latency);
+        stages.push_back(stage);
+
+        for (size_t j = 0; j < consumers[i].size(); ++j)
+            if (--numberOfProducers[consumers[i][j]] == 0)
+                ready.insert(consumers[i][j]);
+    }
+
+    if (stages.size() != n) {
+        std::stringstream ss;
+        for (size_t i = 0; i < n; ++i)
+            if (numberOfProducers[i] != 0)
+                ss << " \"" << Filters[i]->GetFilterName() << "\"";
+        SCLOG_ERROR << "FilterPipeline: circular dependency among filters:" << ss.str() << std::endl;
+        return false;
+    }
+
+    // Copies for offloaded stages are allocated here, not when overrun
+    for (size_t i = 0; i < bindings.size(); ++i) {
+        BindingType & binding = bindings[i];
+        binding.Producer = stageOfFilter[binding.Producer];
+        binding.Consumer = stageOfFilter[binding.Consumer];
+        if (OffloadQueue)
+            binding.Copy = binding.Source->Clone();
+        binding.Input->SetSource(binding.Source);
+    }
+    BoundInputs.swap(bindings);
+    Stages.swap(stages);
+    for (size_t i = 0; i < Stages.size(); ++i)
+        SortedFilters.push_back(Stages[i].Filter);
+    if (OffloadQueue)
+        OffloadQueue->Reserve(Stages.size());
+    OffloadedFrom = Stages.size();
+    Built = true;
+
+    SCLOG_DEBUG << "FilterPipeline: built " << Stages.size() << " stages, "
+                << BoundInputs.size() << " signals bound" << std::endl;
+
+    return true;
+}
+
+bool FilterPipeline::Run(void)
+{
+    if (!Built && !Build())
+        return false;
+
+    // Offloaded stages completed: run them by this thread again
+    if (OffloadedFrom < Stages.size() && !OffloadQueue->IsBusy())
+        RestoreOffloaded();
+
+    // Offloaded stages that have not completed yet are skipped
+    const size_t end = OffloadedFrom;
+    for (size_t i = end; i < Stages.size(); ++i)
+        Stages[i].Filter->GetExecutionStatistics().RecordSkipped();
+
+    const size_t first = Cursor;
+    if (!MeasureLatency && Budget == 0) {
+        for (size_t i = first; i < end; ++i)
+            Stages[i].Filter->RunFilter();
+        Cursor = 0;
+        return true;
+    }
+
+    const TimestampType tickStart = GetMonotonicTimestamp();
+    TimestampType start = tickStart;
+    for (size_t i = first; i < end; ++i) {
+        // At least one stage runs per tick
+        if (Budget && i > first && start - tickStart >= Budget) {
+            Overrun(i, end);
+            return true;
+        }
+
+        StageType & stage = Stages[i];
+        stage.Filter->RunFilter();
+
+        // End of this stage is start of the next stage: one clock read per stage
+        const TimestampType now = GetMonotonicTimestamp();
+        const TimestampType elapsed = now - start;
+        start = now;
+
+        LatencyType & latency = stage.Latency;
+        latency.Last = elapsed;
+        if (latency.Count == 0 || elapsed < latency.Min)
+            latency.Min = elapsed;
+        if (elapsed > latency.Max)
+            latency.Max = elapsed;
+        latency.Total += elapsed;
+        ++latency.Count;
+
+        stage.Filter->GetExecutionStatistics().Record(elapsed);
+    }
+    Cursor = 0;
+
+    return true;
+}
+
+void FilterPipeline::Overrun(size_t stage, size_t end)
+{
+    ++NumberOfOverruns;
+
+    if (OverrunPolicy == OVERRUN_OFFLOAD && OffloadQueue && end == Stages.size()) {
+        // Offloaded stages read copies of outputs of the stages that already
+        // ran, and read outputs of each other in place
+        for (size_t i = 0; i < BoundInputs.size(); ++i) {
+            BindingType & binding = BoundInputs[i];
+            if (binding.Consumer >= stage && binding.Producer < stage) {
+                binding.Copy->CopyFrom(*binding.Source);
+                binding.Input->SetSource(binding.Copy);
+            }
+        }
+        OffloadedFrom = stage;
+
+        if (OffloadQueue->Push(&SortedFilters[stage], end - stage)) {
+            for (size_t i = stage; i < end; ++i)
+                Stages[i].Filter->GetExecutionStatistics().RecordOffloaded();
+            Cursor = 0;
+            return;
+        }
+
+        // Queue is used by another pipeline
+        RestoreOffloaded();
+    }
+
+    Cursor = stage;
+    for (size_t i = stage; i < end; ++i)
+        Stages[i].Filter->GetExecutionStatistics().RecordDeferred();
+}
+
+void FilterPipeline::RestoreOffloaded(void)
+{
+    for (size_t i = 0; i < BoundInputs.size(); ++i) {
+        BindingType & binding = BoundInputs[i];
+        if (binding.Consumer >= OffloadedFrom && binding.Producer < OffloadedFrom)
+            binding.Input->SetSource(binding.Source);
+    }
+    OffloadedFrom = Stages.size();
+}
+
+void FilterPipeline::SetBudget(TimestampType microseconds, OverrunPolicyType policy)
+{
+    Budget = (microseconds > 0 ? microseconds * 1000 : 0);
+    OverrunPolicy = policy;
+
+    if (Budget && policy == OVERRUN_OFFLOAD && !OffloadQueue)
+        SCLOG_WARNING << "FilterPipeline: no offload queue, stages will be deferred on overrun" << std::endl;
+}
+
+void FilterPipeline::SetOffloadQueue(FilterOffloadQueue * queue)
+{
+    Unbind();
+    Stages.clear();
+    SortedFilters.clear();
+    Built = false;
+
+    OffloadQueue = queue;
+}
+
+FilterBase * FilterPipeline::GetStage(size_t stage) const
+{
+    if (stage >= Stages.size())
+        return 0;
+
+    return Stages[stage].Filter;
+}
+
+bool FilterPipeline::IsLastFilterOfPipeline(size_t stage) const
+{
+    if (stage >= Stages.size())
+        return false;
+
+    return Stages[stage].LastFilterOfPipeline;
+}
+
+const FilterPipeline::LatencyType * FilterPipeline::GetLatency(size_t stage) const
+{
+    if (stage >= Stages.size())
+        return 0;
+
+    return &Stages[stage].Latency;
+}
+
+void FilterPipeline::ResetLatency(LatencyType & latency)
+{
+    latency.Count = 0;
+    latency.Last = latency.Min = latency.Max = latency.Total = 0;
+}
+
+void FilterPipeline::ResetLatency(void)
+{
+    for (size_t i = 0; i < Stages.size(); ++i)
+        ResetLatency(Stages[i].Latency);
+    NumberOfOverruns = 0;
+}
+
+void FilterPipeline::ReportLatency(std::ostream & os) const
+{
+    const std::ios::fmtflags f(os.flags());
+    const std::streamsize precision = os.precision();
+
+    os << "FilterPipeline latency: " << Stages.size() << " stages (us)";
+    if (Budget)
+        os << ", budget: " << Budget / 1000 << " us, overruns: " << NumberOfOverruns;
+    os << std::endl;
+    os << std::left << std::setw(32) << "  filter" << std::right
+       << std::setw(10) << "runs" << std::setw(10) << "last" << std::setw(10) << "min"
+       << std::setw(10) << "mean" << std::setw(10) << "max"
+       << std::setw(10) << "deferred" << std::setw(10) << "offloaded" << std::setw(10) << "skipped" << std::endl;
+    os << std::fixed << std::setprecision(2);
+    for (size_t i = 0; i < Stages.size(); ++i) {
+        const LatencyType & latency = Stages[i].Latency;
+        os << "  " << std::left << std::setw(30) << Stages[i].Filter->GetFilterName() << std::right
+           << std::setw(10) << latency.Count
+           << std::setw(10) << latency.Last / 1e3
+           << std::setw(10) << latency.Min / 1e3
+           << std::setw(10) << latency.GetMean() / 1e3
+           << std::setw(10) << latency.Max / 1e3;
+        const FilterExecutionStatistics & statistics = Stages[i].Filter->GetExecutionStatistics();
+        os << std::setw(10) << statistics.GetDeferred()
+           << std::setw(10) << statistics.GetOffloaded()
+           << std::setw(10) << statistics.GetSkipped() << std::endl;
+    }
+
+    os.flags(f);
+    os.precision(precision);
+}
+
+void FilterPipeline::ToStream(std::ostream & os) const
+{
+    os << "FilterPipeline: " << Filters.size() << " filters, ";
+    if (!Built) {
+        os << "not built";
+        return;
+    }
+    os << BoundInputs.size() << " signals bound, stages:";
+    for (size_t i = 0; i < Stages.size(); ++i) {
+        os << " [" << i << "] \"" << Stages[i].Filter->GetFilterName() << "\"";
+        if (Stages[i].LastFilterOfPipeline)
+            os << " (last)";
+    }
+    if (Budget)
+        os << ", budget: " << Budget / 1000 << " us ("
+           << (OverrunPolicy == OVERRUN_DEFER ? "defer" : "offload") << "), overruns: " << NumberOfOverruns;
+}
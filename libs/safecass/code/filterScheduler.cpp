@@ -0,0 +1,410 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#include "safecass/filterScheduler.h"
+
+#include <map>
+#include <algorithm>
+#include <iomanip>
+
+#include <boost/bind.hpp>
+
+using namespace SC;
+
+namespace {
+
+//! Orders tasks by cost (the largest first)
+struct CostGreater {
+    const std::vector<TimestampType> & Costs;
+    CostGreater(const std::vector<TimestampType> & costs): Costs(costs) {}
+    bool operator()(size_t a, size_t b) const { return Costs[a] > Costs[b]; }
+};
+
+//! Orders events by timestamp, then by filter ID
+template<class _eventType>
+struct EventEarlier {
+    bool operator()(const _eventType & a, const _eventType & b) const {
+        if (a.Timestamp != b.Timestamp)
+            return a.Timestamp < b.Timestamp;
+        return a.Filter->GetFilterID() < b.Filter->GetFilterID();
+    }
+};
+
+//! Returns root of union-find tree
+size_t FindRoot(std::vector<size_t> & parents, size_t i)
+{
+    while (parents[i] != i) {
+        parents[i] = parents[parents[i]];
+        i = parents[i];
+    }
+    return i;
+}
+
+};
+
+void FilterScheduler::EventBufferType::OnFilterEvent(const FilterBase * filter,
+                                                     TimestampType timestamp,
+                                                     const std::string & event)
+{
+    EventType e;
+    e.Timestamp = timestamp;
+    e.Filter = filter;
+    e.Typed = false;
+    e.Json = event;
+    Events.push_back(e);
+}
+
+void FilterScheduler::EventBufferType::OnFilterEvent(const FilterBase * filter, const FilterEvent & event)
+{
+    EventType e;
+    e.Timestamp = event.Timestamp;
+    e.Filter = filter;
+    e.Typed = true;
+    e.Event = event;
+    Events.push_back(e);
+}
+
+FilterScheduler::FilterScheduler(size_t numberOfThreads)
+    : Built(false), EventSink(0), Tick(0), NumberOfRemainingTasks(0), Stop(false),
+      TotalTime(0), NumberOfEvents(0)
+{
+    if (numberOfThreads == 0) {
+        SCLOG_WARNING << "FilterScheduler: number of threads must be at least one, using one thread" << std::endl;
+        numberOfThreads = 1;
+    }
+
+    for (size_t i = 0; i < numberOfThreads; ++i) {
+        WorkerType * worker = new WorkerType;
+        worker->Thread = 0;
+        Workers.push_back(worker);
+    }
+    ResetStatistics();
+
+    // Start threads after all workers are created (workers steal from each other)
+    for (size_t i = 0; i < Workers.size(); ++i)
+        Workers[i]->Thread = new boost::thread(boost::bind(&FilterScheduler::RunWorker, this, i));
+}
+
+FilterScheduler::~FilterScheduler()
+{
+    {
+        boost::mutex::scoped_lock lock(Mutex);
+        Stop = true;
+    }
+    TickStarted.notify_all();
+
+    // Workers may still look into queues of the others until they stop
+    for (size_t i = 0; i < Workers.size(); ++i)
+        Workers[i]->Thread->join();
+    for (size_t i = 0; i < Workers.size(); ++i) {
+        delete Workers[i]->Thread;
+        delete Workers[i];
+    }
+
+    ClearTasks();
+
+    for (size_t i = 0; i < Filters.size(); ++i)
+        Filters[i]->SetEventSink(PreviousEventSinks[i]);
+}
+
+bool FilterScheduler::AddFilter(FilterBase * filter)
+{
+    if (!filter) {
+        SCLOG_ERROR << "FilterScheduler: null filter" << std::endl;
+        return false;
+    }
+    if (filter->GetFilteringType() != FilterBase::FILTERING_EXTERNAL) {
+        SCLOG_ERROR << "FilterScheduler: not external filter: \"" << filter->GetFilterName() << "\"" << std::endl;
+        return false;
+    }
+    if (std::find(Filters.begin(), Filters.end(), filter) != Filters.end()) {
+        SCLOG_ERROR << "FilterScheduler: filter already added: \"" << filter->GetFilterName() << "\"" << std::endl;
+        return false;
+    }
+
+    Filters.push_back(filter);
+    PreviousEventSinks.push_back(filter->GetEventSink());
+
+    ClearTasks();
+
+    return true;
+}
+
+void FilterScheduler::ClearTasks(void)
+{
+    for (size_t i = 0; i < Tasks.size(); ++i) {
+        delete Tasks[i].Pipeline;
+        delete Tasks[i].Events;
+    }
+    Tasks.clear();
+    Built = false;
+}
+
+bool FilterScheduler::Build(void)
+{
+    ClearTasks();
+
+    const size_t n = Filters.size();
+
+    // Filters connected by signals belong to the same task
+    std::vector<size_t> parents(n);
+    for (size_t i = 0; i < n; ++i)
+        parents[i] = i;
+
+    std::map<StringIDType, size_t> producers;
+    for (size_t i = 0; i < n; ++i)
+        for (size_t j = 0; j < Filters[i]->GetNumberOfOutputSignal(); ++j)
+            producers.insert(std::make_pair(Filters[i]->GetOutputSignalElement(j)->GetNameID(), i));
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < Filters[i]->GetNumberOfInputSignal(); ++j) {
+            std::map<StringIDType, size_t>::const_iterator it =
+                producers.find(Filters[i]->GetInputSignalElement(j)->GetNameID());
+            if (it != producers.end())
+                parents[FindRoot(parents, i)] = FindRoot(parents, it->second);
+        }
+    }
+
+    // Tasks in order of their first filter added
+    std::map<size_t, size_t> taskOfRoot;
+    for (size_t i = 0; i < n; ++i) {
+        const size_t root = FindRoot(parents, i);
+        std::map<size_t, size_t>::const_iterator it = taskOfRoot.find(root);
+        size_t task;
+        if (it == taskOfRoot.end()) {
+            task = Tasks.size();
+            taskOfRoot[root] = task;
+
+            TaskType t;
+            t.Pipeline = new FilterPipeline;
+            t.Pipeline->EnableLatencyMeasurement(false);
+            t.Events = new EventBufferType;
+            t.Cost = 0;
+            Tasks.push_back(t);
+        } else
+            task = it->second;
+
+        Tasks[task].Pipeline->AddFilter(Filters[i]);
+        Filters[i]->SetEventSink(Tasks[task].Events);
+    }
+
+    for (size_t i = 0; i < Tasks.size(); ++i) {
+        if (!Tasks[i].Pipeline->Build()) {
+            SCLOG_ERROR << "FilterScheduler: failed to build task " << i << ": " << *Tasks[i].Pipeline << std::endl;
+            ClearTasks();
+            for (size_t j = 0; j < n; ++j)
+                Filters[j]->SetEventSink(PreviousEventSinks[j]);
+            return false;
+        }
+    }
+    Built = true;
+
+    SCLOG_DEBUG << "FilterScheduler: " << n << " filters, " << Tasks.size() << " tasks, "
+                << Workers.size() << " workers" << std::endl;
+
+    return true;
+}
+
+bool FilterScheduler::Run(void)
+{
+    if (!Built && !Build())
+        return false;
+    if (Tasks.empty())
+        return true;
+
+    const TimestampType start = GetMonotonicTimestamp();
+
+    // Number of tasks must be set before any task is queued: a worker may
+    // still be looking for tasks of the previous tick
+    {
+        boost::mutex::scoped_lock lock(Mutex);
+        NumberOfRemainingTasks = Tasks.size();
+    }
+
+    // The most costly task first, to the least loaded worker
+    std::vector<TimestampType> costs(Tasks.size());
+    std::vector<size_t> order(Tasks.size());
+    for (size_t i = 0; i < Tasks.size(); ++i) {
+        costs[i] = Tasks[i].Cost;
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), CostGreater(costs));
+
+    std::vector<TimestampType> loads(Workers.size(), 0);
+    for (size_t i = 0; i < order.size(); ++i) {
+        const size_t worker = std::min_element(loads.begin(), loads.end()) - loads.begin();
+        // Tasks of no cost measured yet are spread evenly
+        loads[worker] += costs[order[i]] + 1;
+
+        boost::mutex::scoped_lock lock(Workers[worker]->QueueMutex);
+        Workers[worker]->Queue.push_back(order[i]);
+    }
+
+    {
+        boost::mutex::scoped_lock lock(Mutex);
+        ++Tick;
+    }
+    TickStarted.notify_all();
+
+    {
+        boost::mutex::scoped_lock lock(Mutex);
+        while (NumberOfRemainingTasks != 0)
+            TickCompleted.wait(lock);
+    }
+
+    DeliverEvents();
+
+    TotalTime += GetMonotonicTimestamp() - start;
+
+    return true;
+}
+
+void FilterScheduler::RunWorker(size_t worker)
+{
+    WorkerType & self = *Workers[worker];
+    size_t tick = 0;
+
+    while (true) {
+        {
+            boost::mutex::scoped_lock lock(Mutex);
+            while (!Stop && Tick == tick)
+                TickStarted.wait(lock);
+            if (Stop)
+                return;
+            tick = Tick;
+        }
+
+        size_t task;
+        bool stolen;
+        while (PopTask(worker, task, stolen)) {
+            const TimestampType start = GetMonotonicTimestamp();
+            Tasks[task].Pipeline->Run();
+            const TimestampType elapsed = GetMonotonicTimestamp() - start;
+
+            // Only this worker runs this task in this tick
+            Tasks[task].Cost = elapsed;
+            self.Statistics.BusyTime += elapsed;
+            ++self.Statistics.Tasks;
+            if (stolen)
+                ++self.Statistics.Steals;
+
+            boost::mutex::scoped_lock lock(Mutex);
+            if (--NumberOfRemainingTasks == 0)
+                TickCompleted.notify_one();
+        }
+    }
+}
+
+bool FilterScheduler::PopTask(size_t worker, size_t & task, bool & stolen)
+{
+    {
+        WorkerType & self = *Workers[worker];
+        boost::mutex::scoped_lock lock(self.QueueMutex);
+        if (!self.Queue.empty()) {
+            task = self.Queue.front();
+            self.Queue.pop_front();
+            stolen = false;
+            return true;
+        }
+    }
+
+    for (size_t i = 1; i < Workers.size(); ++i) {
+        WorkerType & victim = *Workers[(worker + i) % Workers.size()];
+        boost::mutex::scoped_lock lock(victim.QueueMutex);
+        if (!victim.Queue.empty()) {
+            task = victim.Queue.back();
+            victim.Queue.pop_back();
+            stolen = true;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void FilterScheduler::DeliverEvents(void)
+{
+    typedef EventBufferType::EventType EventType;
+
+    std::vector<EventType> events;
+    for (size_t i = 0; i < Tasks.size(); ++i) {
+        std::vector<EventType> & buffered = Tasks[i].Events->Events;
+        events.insert(events.end(), buffered.begin(), buffered.end());
+        buffered.clear();
+    }
+    if (events.empty())
+        return;
+
+    // Stable: events of the same filter at the same timestamp stay in order emitted
+    std::stable_sort(events.begin(), events.end(), EventEarlier<EventType>());
+
+    if (!EventSink) {
+        SCLOG_WARNING << "FilterScheduler: no event sink, " << events.size() << " events dropped" << std::endl;
+        return;
+    }
+    for (size_t i = 0; i < events.size(); ++i) {
+        if (events[i].Typed)
+            EventSink->OnFilterEvent(events[i].Filter, events[i].Event);
+        else
+            EventSink->OnFilterEvent(events[i].Filter, events[i].Timestamp, events[i].Json);
+    }
+    NumberOfEvents += events.size();
+}
+
+const FilterScheduler::WorkerStatisticsType * FilterScheduler::GetWorkerStatistics(size_t worker) const
+{
+    if (worker >= Workers.size())
+        return 0;
+
+    return &Workers[worker]->Statistics;
+}
+
+double FilterScheduler::GetUtilization(size_t worker) const
+{
+    if (worker >= Workers.size() || TotalTime == 0)
+        return 0.0;
+
+    return (double) Workers[worker]->Statistics.BusyTime / (double) TotalTime;
+}
+
+void FilterScheduler::ResetStatistics(void)
+{
+    for (size_t i = 0; i < Workers.size(); ++i) {
+        WorkerStatisticsType & stats = Workers[i]->Statistics;
+        stats.Tasks = 0;
+        stats.Steals = 0;
+        stats.BusyTime = 0;
+    }
+    TotalTime = 0;
+}
+
+void FilterScheduler::ReportUtilization(std::ostream & os) const
+{
+    const std::ios::fmtflags f(os.flags());
+    const std::streamsize precision = os.precision();
+
+    os << "FilterScheduler utilization: " << Workers.size() << " workers, " << Tasks.size()
+       << " tasks, " << Filters.size() << " filters" << std::endl;
+    os << std::left << std::setw(12) << "  worker" << std::right
+       << std::setw(12) << "tasks" << std::setw(12) << "steals" << std::setw(14) << "busy (us)"
+       << std::setw(14) << "utilization" << std::endl;
+    for (size_t i = 0; i < Workers.size(); ++i) {
+        const WorkerStatisticsType & stats = Workers[i]->Statistics;
+        os << "  " << std::left << std::setw(10) << i << std::right
+           << std::setw(12) << stats.Tasks
+           << std::setw(12) << stats.Steals
+           << std::setw(14) << std::fixed << std::setprecision(1) << stats.BusyTime / 1e3
+           << std::setw(13) << std::setprecision(1) << GetUtilization(i) * 100.0 << "%" << std::endl;
+    }
+
+    os.flags(f);
+    os.precision(precision);
+}
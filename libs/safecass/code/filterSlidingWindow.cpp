@@ -0,0 +1,118 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#include "safecass/filterSlidingWindow.h"
+
+#include "common/jsonwrapper.h"
+
+using namespace SC;
+
+FilterSlidingWindow::FilterSlidingWindow(const std::string &      filterName,
+                                         FilteringType            filteringType,
+                                         const StateMachineInfo & stateMachineInfo,
+                                         const std::string &      inputSignalName,
+                                         size_t                   windowSize,
+                                         TimestampType            windowDuration)
+    : FilterBase(filterName, filteringType, stateMachineInfo),
+      NameOfInputSignal(inputSignalName),
+      Input(0.0),
+      Window(0)
+{
+    SCASSERT(AddInputSignal(Input, NameOfInputSignal));
+    CreateWindow(windowSize, windowDuration);
+}
+
+FilterSlidingWindow::FilterSlidingWindow(const std::string & filterName, const Json::Value & jsonNode)
+    : FilterBase(filterName, jsonNode),
+      NameOfInputSignal(jsonNode["argument"].get("input_signal", NONAME).asString()),
+      Input(0.0),
+      Window(0)
+{
+    SCASSERT(AddInputSignal(Input, NameOfInputSignal));
+    CreateWindow(1, 0);
+
+    if (!ConfigureFilter(jsonNode))
+        SCLOG_ERROR << "FilterSlidingWindow: invalid configuration: " << JsonWrapper::GetJsonString(jsonNode) << std::endl;
+}
+
+FilterSlidingWindow::~FilterSlidingWindow()
+{
+    delete Window;
+}
+
+void FilterSlidingWindow::CreateWindow(size_t size, TimestampType duration)
+{
+    if (size == 0) {
+        SCLOG_WARNING << "FilterSlidingWindow: window size 0, using window of 1 sample: filter \"" << Name << "\"" << std::endl;
+        size = 1;
+    }
+
+    delete Window;
+    if (duration > 0)
+        Window = new SlidingWindowStatistics(duration, size);
+    else
+        Window = new SlidingWindowStatistics(size);
+}
+
+bool FilterSlidingWindow::ConfigureFilter(const Json::Value & jsonNode)
+{
+    const Json::Value & argument = jsonNode["argument"];
+
+    const int size = argument.get("window_samples", 0).asInt();
+    if (size <= 0) {
+        SCLOG_ERROR << "FilterSlidingWindow: invalid window size: " << size << std::endl;
+        return false;
+    }
+    // Duration in seconds
+    const double duration = argument.get("window_time", 0.0).asDouble();
+    if (duration < 0.0) {
+        SCLOG_ERROR << "FilterSlidingWindow: invalid window time: " << duration << std::endl;
+        return false;
+    }
+
+    CreateWindow((size_t) size, (TimestampType) (duration * 1e9));
+
+    return true;
+}
+
+bool FilterSlidingWindow::InitFilter(void)
+{
+    Window->Reset();
+
+    return true;
+}
+
+void FilterSlidingWindow::CleanupFilter(void)
+{
+}
+
+void FilterSlidingWindow::RunFilter(void)
+{
+    if (!FilterBase::RefreshSamples())
+        return;
+
+    const ParamType & input = GetInputValue<ParamType>(0);
+    Window->Push(input.Val, input.GetTimestamp());
+
+    UpdateOutputs();
+}
+
+void FilterSlidingWindow::ToStream(std::ostream & outputStream, bool verbose) const
+{
+    BaseType::ToStream(outputStream, verbose);
+
+    if (!verbose)
+        outputStream << *Window;
+    else
+        outputStream << "----- Filter-specifics: " << std::endl
+                     << "Window: " << *Window << std::endl;
+}
@@ -0,0 +1,276 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#include "safecass/filterThresholdBank.h"
+
+#include "common/jsonwrapper.h"
+
+#include <algorithm>
+#include <iomanip>
+
+// Instruction set is selected at compile time, as for reductions (see
+// safecass/reduction.h).
+#if defined(__AVX__)
+  #include <immintrin.h>
+  #define SC_THRESHOLD_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>
+  #define SC_THRESHOLD_SSE2
+#endif
+
+using namespace SC;
+
+namespace {
+
+const size_t BITS = 64;
+
+//! Sets bit (i % 64) of above[i / 64] if x[i] > limit[i], for i in [0, n)
+void CompareGreater(const double * x, const double * limit, size_t n, boost::uint64_t * above)
+{
+    size_t i = 0;
+    for (size_t word = 0; i < n; ++word) {
+        const size_t end = std::min(n, (word + 1) * BITS);
+        boost::uint64_t bits = 0;
+#if defined(SC_THRESHOLD_AVX)
+        for (; i + 4 <= end; i += 4) {
+            const __m256d gt = _mm256_cmp_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(limit + i), _CMP_GT_OQ);
+            bits |= static_cast<boost::uint64_t>(_mm256_movemask_pd(gt)) << (i % BITS);
+        }
+#elif defined(SC_THRESHOLD_SSE2)
+        for (; i + 2 <= end; i += 2) {
+            const __m128d gt = _mm_cmpgt_pd(_mm_loadu_pd(x + i), _mm_loadu_pd(limit + i));
+            bits |= static_cast<boost::uint64_t>(_mm_movemask_pd(gt)) << (i % BITS);
+        }
+#endif
+        for (; i < end; ++i)
+            if (x[i] > limit[i])
+                bits |= static_cast<boost::uint64_t>(1) << (i % BITS);
+        above[word] = bits;
+    }
+}
+
+//! Returns index of lowest bit set (bits must not be zero)
+inline size_t LowestBit(boost::uint64_t bits)
+{
+#if defined(__GNUC__)
+    return static_cast<size_t>(__builtin_ctzll(bits));
+#else
+    size_t i = 0;
+    while (!(bits & 1)) {
+        bits >>= 1;
+        ++i;
+    }
+    return i;
+#endif
+}
+
+};
+
+SC_IMPLEMENT_FACTORY(FilterThresholdBank);
+
+FilterThresholdBank::FilterThresholdBank(void)
+    : FilterBase(FilterThresholdBank::Name, FILTERING_INTERNAL, StateMachineInfo()),
+      OutputAbove(1.0),
+      OutputBelow(0.0),
+      Output(Eigen::VectorXd())
+{
+    Initialize();
+}
+
+FilterThresholdBank::FilterThresholdBank(FilterBase::FilteringType          filteringType,
+                                         const StateMachineInfo &           stateMachineInfo,
+                                         double                             outputBelow,
+                                         double                             outputAbove,
+                                         FilterBase::EventDetectionModeType eventDetectionMode)
+    : FilterBase(FilterThresholdBank::Name, filteringType, stateMachineInfo, eventDetectionMode),
+      OutputAbove(outputAbove),
+      OutputBelow(outputBelow),
+      Output(Eigen::VectorXd())
+{
+    Initialize();
+}
+
+FilterThresholdBank::FilterThresholdBank(const Json::Value & jsonNode)
+    : FilterBase(FilterThresholdBank::Name, jsonNode),
+      OutputAbove(1.0),
+      OutputBelow(0.0),
+      Output(Eigen::VectorXd())
+{
+    Initialize();
+
+    if (!ConfigureFilter(jsonNode))
+        SCLOG_ERROR << "FilterThresholdBank: invalid configuration: " << JsonWrapper::GetJsonString(jsonNode) << std::endl;
+}
+
+FilterThresholdBank::~FilterThresholdBank()
+{
+    for (size_t i = 0; i < Inputs.size(); ++i)
+        delete Inputs[i];
+}
+
+void FilterThresholdBank::Initialize(void)
+{
+    NumberOfCrossings = 0;
+
+    // Define outputs
+    const std::string outputSignalName(GenerateOutputSignalName(Name, "Output", FilterID, 0));
+    SCASSERT(AddOutputSignal(Output, outputSignalName));
+}
+
+bool FilterThresholdBank::AddSignal(const std::string & inputSignalName,
+                                    double              threshold,
+                                    double              tolerance,
+                                    const std::string & eventNameAbove,
+                                    const std::string & eventNameBelow)
+{
+    ParamType * input = new ParamType(0.0);
+    if (!AddInputSignal(*input, inputSignalName)) {
+        delete input;
+        return false;
+    }
+
+    Inputs.push_back(input);
+    Thresholds.push_back(threshold);
+    Tolerances.push_back(tolerance);
+    Limits.push_back(threshold + tolerance);
+    EventNamesAbove.push_back(eventNameAbove);
+    EventNamesBelow.push_back(eventNameBelow);
+    EventIDsAbove.push_back(StringTable::GetInstance()->Intern(eventNameAbove));
+    EventIDsBelow.push_back(StringTable::GetInstance()->Intern(eventNameBelow));
+
+    // Run-time state is sized here so that RunFilter() does not allocate
+    const size_t n = Inputs.size();
+    Values.resize(n);
+    Above.resize((n + BITS - 1) / BITS, 0);
+    Current.resize(Above.size(), 0);
+    Output.Val.conservativeResize(n);
+    Output.Val(n - 1) = OutputBelow;
+
+    return true;
+}
+
+bool FilterThresholdBank::ConfigureFilter(const Json::Value & jsonNode)
+{
+    const Json::Value & argument = jsonNode["argument"];
+
+    OutputAbove = argument.get("output_above", OutputAbove).asDouble();
+    OutputBelow = argument.get("output_below", OutputBelow).asDouble();
+
+    const Json::Value & signals = argument["signals"];
+    if (!signals.isArray() || signals.size() == 0) {
+        SCLOG_ERROR << "FilterThresholdBank: no signals defined" << std::endl;
+        return false;
+    }
+
+    for (Json::ArrayIndex i = 0; i < signals.size(); ++i) {
+        const Json::Value & signal = signals[i];
+        const std::string name = signal["input_signal"].asString();
+        if (name.empty()) {
+            SCLOG_ERROR << "FilterThresholdBank: no input signal name: signal " << i << std::endl;
+            return false;
+        }
+        if (!AddSignal(name,
+                       signal["threshold"].asDouble(),
+                       signal["tolerance"].asDouble(),
+                       signal["event_onset"].asString(),
+                       signal["event_completion"].asString()))
+            return false;
+    }
+
+    // Outputs defined before output values were configured
+    Output.Val.setConstant(OutputBelow);
+
+    return true;
+}
+
+bool FilterThresholdBank::InitFilter(void)
+{
+    return true;
+}
+
+void FilterThresholdBank::CleanupFilter(void)
+{
+}
+
+void FilterThresholdBank::RunFilter(void)
+{
+    if (!FilterBase::RefreshSamples())
+        return;
+
+    const size_t n = Inputs.size();
+    if (n == 0)
+        return;
+
+    for (size_t i = 0; i < n; ++i)
+        Values[i] = GetInputValue<ParamType>(i).Val;
+
+    CompareGreater(&Values[0], &Limits[0], n, &Current[0]);
+
+    const bool level = (EventDetectionMode == FilterBase::EVENT_DETECTION_LEVEL);
+    bool detected = false;
+    for (size_t word = 0; word < Current.size(); ++word) {
+        const boost::uint64_t changed = Current[word] ^ Above[word];
+        // Level-triggered: onset event at every run above threshold
+        boost::uint64_t report = (level ? (Current[word] | changed) : changed);
+        Above[word] = Current[word];
+        if (Current[word])
+            detected = true;
+
+        while (report) {
+            const size_t bit = LowestBit(report);
+            report &= report - 1;
+            if ((changed >> bit) & 1)
+                ++NumberOfCrossings;
+            OnCrossing(word * BITS + bit, ((Current[word] >> bit) & 1) != 0);
+        }
+    }
+
+    FilterState = (detected ? FilterBase::STATE_DETECTED : FilterBase::STATE_ENABLED);
+}
+
+void FilterThresholdBank::OnCrossing(size_t index, bool above)
+{
+    Output.Val(index) = (above ? OutputAbove : OutputBelow);
+
+    EmitEvent(GenerateEvent(index, above ? ABOVE_THRESHOLD : BELOW_THRESHOLD));
+}
+
+FilterEvent FilterThresholdBank::GenerateEvent(size_t index, EVENT_TYPE eventType) const
+{
+    FilterEvent event = CreateEvent(eventType == ABOVE_THRESHOLD ? EventIDsAbove[index] : EventIDsBelow[index],
+                                    GetInputValue<ParamType>(index).GetTimestamp());
+    event.Signal = InputSignals[index]->GetNameID();
+    event.AddPayload(Values[index]);
+
+    return event;
+}
+
+void FilterThresholdBank::ToStream(std::ostream & outputStream, bool verbose) const
+{
+    BaseType::ToStream(outputStream, verbose);
+
+    if (!verbose) {
+        outputStream << Inputs.size() << " signals";
+        return;
+    }
+
+    outputStream << "----- Filter-specifics: " << std::endl
+                 << "OutputAbove: " << OutputAbove << std::endl
+                 << "OutputBelow: " << OutputBelow << std::endl
+                 << "Crossings  : " << NumberOfCrossings << std::endl;
+    for (size_t i = 0; i < Inputs.size(); ++i) {
+        outputStream << "[" << i << "] \"" << InputSignals[i]->GetName() << "\""
+                     << ", threshold: " << Thresholds[i] << ", tolerance: " << Tolerances[i]
+                     << ", events: " << EventNamesAbove[i] << ", " << EventNamesBelow[i]
+                     << (IsAbove(i) ? " (above)" : "") << std::endl;
+    }
+}
@@ -7,20 +7,115 @@
 //-----------------------------------------------------------------------------------
 //
 // Created on   : Mar 15, 2016
-// Last revision: Apr 26, 2016
+// Last revision: Oct 17, 2026
 // Author       : Min Yang Jung <myj@jhu.edu>
 // Github       : https://github.com/safecass/safecass
 //
 
 #include <iomanip>
+#include <algorithm>
+#include <boost/static_assert.hpp>
 
 #include "safecass/historyBuffer.h"
 
 using namespace SC;
 
+namespace {
+
+//! Magic number of binary format
+const char BinaryMagic[8] = { 'S', 'C', 'H', 'B', 'B', 'I', 'N', '\0' };
+//! Version of binary format
+const boost::uint32_t BinaryVersion = 1;
+//! Output is flushed whenever buffered output exceeds this size
+const size_t FlushSize = 64 * 1024;
+
+BOOST_STATIC_ASSERT(sizeof(SC::TimestampType) == sizeof(boost::int64_t));
+
+//! Typedef of field in line of CSV: [first, second)
+typedef std::pair<const char *, const char *> FieldType;
+typedef std::vector<FieldType> FieldsType;
+
+inline void Flush(std::ostream & os, std::string & buffer)
+{
+    os.write(buffer.data(), buffer.size());
+    buffer.clear();
+}
+
+template <typename T>
+bool ReadValue(std::istream & is, T & value)
+{
+    is.read(reinterpret_cast<char *>(&value), sizeof(T));
+    return ((size_t) is.gcount() == sizeof(T));
+}
+
+bool ReadBlock(std::istream & is, size_t size, std::string & buffer)
+{
+    buffer.resize(size);
+    if (size == 0)
+        return true;
+    is.read(&buffer[0], size);
+    return ((size_t) is.gcount() == size);
+}
+
+bool ReadString(std::istream & is, std::string & str)
+{
+    boost::uint32_t length;
+    if (!ReadValue(is, length) || length > 64 * 1024)
+        return false;
+    return ReadBlock(is, length, str);
+}
+
+void AppendString(std::string & buffer, const std::string & str)
+{
+    ParamCodecDetail::AppendRaw(buffer, (boost::uint32_t) str.size());
+    buffer += str;
+}
+
+//! Splits line into comma-separated fields (trailing CR is ignored)
+void SplitFields(const std::string & line, FieldsType & fields)
+{
+    fields.clear();
+
+    const char * p = line.data();
+    const char * end = p + line.size();
+    if (p != end && *(end - 1) == '\r')
+        --end;
+
+    const char * begin = p;
+    for (; p != end; ++p) {
+        if (*p == ',') {
+            fields.push_back(FieldType(begin, p));
+            begin = p + 1;
+        }
+    }
+    fields.push_back(FieldType(begin, end));
+}
+
+inline bool IsEmpty(const FieldType & field)
+{
+    return (field.first == field.second);
+}
+
+inline bool Equals(const FieldType & field, const std::string & str)
+{
+    return (str.size() == (size_t)(field.second - field.first) &&
+            str.compare(0, str.size(), field.first, str.size()) == 0);
+}
+
+bool ParseInteger(const FieldType & field, long long & value)
+{
+    const char * p = field.first;
+    if (!ParamCodecDetail::ScalarText<long long>::Read(p, field.second, value))
+        return false;
+    return !ParamCodecDetail::SkipSpaces(p, field.second);
+}
+
+};
+
 HistoryBuffer::HistoryBuffer(size_t bufferSize)
     : BufferSize(bufferSize),
-      SnapshotIndex(HistoryBuffer::BaseType::INVALID_SIGNAL_INDEX)
+      SnapshotIndex(HistoryBuffer::BaseType::INVALID_SIGNAL_INDEX),
+      SnapshotTimestamps(bufferSize)
 {
 }
 
@@ -30,6 +125,9 @@ HistoryBuffer::~HistoryBuffer()
     SignalAccessorsType::iterator itEnd = SignalAccessors.end();
     for (; it != itEnd; ++it)
         delete *it;
+
+    for (size_t i = 0; i < SignalAccessorGroups.size(); ++i)
+        delete SignalAccessorGroups[i];
 }
 
 bool HistoryBuffer::GetNewValue(const BaseType::IDType & id, ParamBase & arg) const
@@ -61,9 +159,51 @@ bool HistoryBuffer::GetNewValue(const BaseType::IndexType & index, ParamBase & a
 
 bool HistoryBuffer::PushNewValue(const IndexType & index, const ParamBase & arg)
 {
-    // FIXME
+    if (index == BaseType::INVALID_SIGNAL_INDEX || index >= (BaseType::IndexType) SignalAccessors.size()) {
+        SCLOG_WARNING << "PushNewValue: invalid signal index: " << index << std::endl;
+        return false;
+    }
+
+    SignalAccessorBase * accessor = SignalAccessors[index];
+    const size_t n = accessor->GetNumberOfSamples();
+    if (n == 0) {
+        SCLOG_WARNING << "PushNewValue: no sample available: \"" << accessor->GetSignalName() << "\"" << std::endl;
+        return false;
+    }
+
+    if (!accessor->SetValue(n - 1, arg)) {
+        SCLOG_WARNING << "PushNewValue: type mismatch: \"" << accessor->GetSignalName() << "\"" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool HistoryBuffer::PushNewValue(const IndexType & index, const ParamBase & arg, SC::TimestampType timestamp)
+{
+    if (index == BaseType::INVALID_SIGNAL_INDEX || index >= (BaseType::IndexType) SignalAccessors.size()) {
+        SCLOG_WARNING << "PushNewValue: invalid signal index: " << index << std::endl;
+        return false;
+    }
+
+    SignalAccessorBase * accessor = SignalAccessors[index];
+    size_t i;
+    if (!FindPrevious(accessor->GetNumberOfSamples(), timestamp, i)) {
+        SCLOG_WARNING << "PushNewValue: no sample of signal \"" << accessor->GetSignalName()
+                      << "\" at or before timestamp " << timestamp << std::endl;
+        return false;
+    }
+
+    ParamBase * value = arg.Clone();
+    value->SetValid(arg.IsValid());
+    value->SetTimestamp(timestamp);
+    const bool ret = accessor->SetValue(i, *value);
+    delete value;
+
+    if (!ret)
+        SCLOG_WARNING << "PushNewValue: type mismatch: \"" << accessor->GetSignalName() << "\"" << std::endl;
 
-    return false;
+    return ret;
 }
 
 void HistoryBuffer::ToStream(std::ostream & os) const
@@ -71,14 +211,20 @@ void HistoryBuffer::ToStream(std::ostream & os) const
     Serialize(os);
 }
 
-void HistoryBuffer::Serialize(std::ostream & os) const
+bool HistoryBuffer::Serialize(std::ostream & os, FormatType format) const
 {
+    switch (format) {
+    case FORMAT_BINARY: return SerializeBinary(os);
+    case FORMAT_CSV:    return SerializeCsv(os);
+    case FORMAT_TEXT:   break;
+    }
+
     os << "HistoryBuffer: Snapshot index (" << SnapshotIndex << "), "
        << "Number of signals (" << SignalAccessors.size() << "): ";
 
     if (SignalAccessors.empty()) {
         os << "No signal accessor" << std::endl;
-        return;
+        return true;
     } else {
         os << std::endl;
     }
@@ -93,6 +239,442 @@ void HistoryBuffer::Serialize(std::ostream & os) const
         os << (*SignalAccessors[i]) << std::endl;
     }
 
+    return true;
+}
+
+bool HistoryBuffer::SerializeBinary(std::ostream & os) const
+{
+    std::string buffer;
+    buffer.reserve(FlushSize);
+
+    // Header
+    buffer.append(BinaryMagic, sizeof(BinaryMagic));
+    ParamCodecDetail::AppendRaw(buffer, BinaryVersion);
+    ParamCodecDetail::AppendRaw(buffer, (boost::uint32_t) BufferSize);
+    ParamCodecDetail::AppendRaw(buffer, (boost::int64_t) SnapshotIndex);
+    ParamCodecDetail::AppendRaw(buffer, (boost::uint32_t) SnapshotTimestamps.size());
+    ParamCodecDetail::AppendRaw(buffer, (boost::uint32_t) SignalAccessors.size());
+
+    // Snapshot timestamps (at most two contiguous spans)
+    TimestampsType::const_array_range one = SnapshotTimestamps.array_one();
+    TimestampsType::const_array_range two = SnapshotTimestamps.array_two();
+    buffer.append(reinterpret_cast<const char *>(one.first), one.second * sizeof(SC::TimestampType));
+    buffer.append(reinterpret_cast<const char *>(two.first), two.second * sizeof(SC::TimestampType));
+
+    // Schema
+    for (size_t i = 0; i < SignalAccessors.size(); ++i) {
+        const std::string type = SignalAccessors[i]->GetTypeDescriptor();
+        if (type.empty()) {
+            SCLOG_ERROR << "Serialize: signal \"" << SignalAccessors[i]->GetSignalName()
+                        << "\" does not support binary format" << std::endl;
+            return false;
+        }
+        AppendString(buffer, SignalAccessors[i]->GetSignalName());
+        AppendString(buffer, type);
+    }
+    Flush(os, buffer);
+
+    // One block per signal, prefixed with its size
+    for (size_t i = 0; i < SignalAccessors.size(); ++i) {
+        ParamCodecDetail::AppendRaw(buffer, (boost::uint64_t) 0);
+        if (!SignalAccessors[i]->WriteBinary(buffer)) {
+            SCLOG_ERROR << "Serialize: failed to write signal \"" << SignalAccessors[i]->GetSignalName()
+                        << "\"" << std::endl;
+            return false;
+        }
+        const boost::uint64_t size = buffer.size() - sizeof(boost::uint64_t);
+        memcpy(&buffer[0], &size, sizeof(size));
+        Flush(os, buffer);
+    }
+
+    return os.good();
+}
+
+bool HistoryBuffer::SerializeCsv(std::ostream & os) const
+{
+    typedef ParamCodecDetail::ScalarText<long long> IntegerText;
+
+    std::string buffer;
+    buffer.reserve(FlushSize * 2);
+
+    buffer = "snapshot,timestamp";
+    for (size_t i = 0; i < SignalAccessors.size(); ++i) {
+        const std::string & name = SignalAccessors[i]->GetSignalName();
+        buffer += ',';
+        buffer += name;
+        buffer += ',';
+        buffer += name;
+        buffer += ".valid,";
+        buffer += name;
+        buffer += ".timestamp";
+    }
+    buffer += '\n';
+
+    // Signal accessors may have fewer samples than snapshots; align them from
+    // the latest snapshot.
+    const size_t rows = SnapshotTimestamps.size();
+    std::vector<size_t> offsets(SignalAccessors.size());
+    for (size_t i = 0; i < SignalAccessors.size(); ++i)
+        offsets[i] = rows - std::min(rows, SignalAccessors[i]->GetNumberOfSamples());
+
+    bool valid;
+    SC::TimestampType timestamp;
+    for (size_t r = 0; r < rows; ++r) {
+        IntegerText::Write(SnapshotIndex - (BaseType::IndexType)(rows - 1 - r), buffer);
+        buffer += ',';
+        IntegerText::Write(SnapshotTimestamps[r], buffer);
+
+        for (size_t i = 0; i < SignalAccessors.size(); ++i) {
+            buffer += ',';
+            if (r < offsets[i]) {
+                buffer += ",,";
+                continue;
+            }
+            if (!SignalAccessors[i]->WriteText(r - offsets[i], buffer, valid, timestamp)) {
+                SCLOG_ERROR << "Serialize: signal \"" << SignalAccessors[i]->GetSignalName()
+                            << "\" does not support CSV format" << std::endl;
+                return false;
+            }
+            buffer += (valid ? ",1," : ",0,");
+            IntegerText::Write(timestamp, buffer);
+        }
+        buffer += '\n';
+
+        if (buffer.size() >= FlushSize)
+            Flush(os, buffer);
+    }
+    Flush(os, buffer);
+
+    return os.good();
+}
+
+bool HistoryBuffer::Deserialize(std::istream & is, FormatType format)
+{
+    bool ret = false;
+    switch (format) {
+    case FORMAT_BINARY: ret = DeserializeBinary(is); break;
+    case FORMAT_CSV:    ret = DeserializeCsv(is);    break;
+    case FORMAT_TEXT:
+        SCLOG_ERROR << "Deserialize: text format is not supported" << std::endl;
+        break;
+    }
+
+    if (!ret)
+        ClearSamples();
+
+    return ret;
+}
+
+bool HistoryBuffer::DeserializeBinary(std::istream & is)
+{
+    char magic[sizeof(BinaryMagic)];
+    boost::uint32_t version, bufferSize, numberOfSnapshots, numberOfSignals;
+    boost::int64_t snapshotIndex;
+
+    is.read(magic, sizeof(magic));
+    if ((size_t) is.gcount() != sizeof(magic) || memcmp(magic, BinaryMagic, sizeof(magic)) != 0) {
+        SCLOG_ERROR << "Deserialize: invalid magic number" << std::endl;
+        return false;
+    }
+    if (!ReadValue(is, version) || version != BinaryVersion) {
+        SCLOG_ERROR << "Deserialize: unsupported version" << std::endl;
+        return false;
+    }
+    if (!ReadValue(is, bufferSize) || !ReadValue(is, snapshotIndex) ||
+        !ReadValue(is, numberOfSnapshots) || !ReadValue(is, numberOfSignals))
+    {
+        SCLOG_ERROR << "Deserialize: truncated header" << std::endl;
+        return false;
+    }
+
+    ClearSamples();
+
+    std::string block;
+    if (!ReadBlock(is, numberOfSnapshots * sizeof(SC::TimestampType), block)) {
+        SCLOG_ERROR << "Deserialize: truncated snapshot timestamps" << std::endl;
+        return false;
+    }
+    // Oldest snapshots are dropped if the input has more snapshots than BufferSize
+    SC::TimestampType timestamp;
+    for (boost::uint32_t i = 0; i < numberOfSnapshots; ++i) {
+        memcpy(&timestamp, block.data() + i * sizeof(timestamp), sizeof(timestamp));
+        PushSnapshotTimestamp(timestamp);
+    }
+
+    // Schema: map signals in the input to signal accessors
+    std::vector<SignalAccessorBase *> targets(numberOfSignals, 0);
+    std::string name, type;
+    for (boost::uint32_t i = 0; i < numberOfSignals; ++i) {
+        if (!ReadString(is, name) || !ReadString(is, type)) {
+            SCLOG_ERROR << "Deserialize: truncated schema" << std::endl;
+            return false;
+        }
+        const BaseType::IndexType index = GetSignalIndex(name);
+        if (index == BaseType::INVALID_SIGNAL_INDEX) {
+            SCLOG_WARNING << "Deserialize: signal \"" << name << "\" not found (skipped)" << std::endl;
+            continue;
+        }
+        if (SignalAccessors[index]->GetTypeDescriptor() != type) {
+            SCLOG_ERROR << "Deserialize: type mismatch of signal \"" << name << "\": "
+                        << type << " (expected " << SignalAccessors[index]->GetTypeDescriptor()
+                        << ")" << std::endl;
+            return false;
+        }
+        targets[i] = SignalAccessors[index];
+    }
+
+    boost::uint64_t size;
+    boost::uint32_t numberOfSamples;
+    for (boost::uint32_t i = 0; i < numberOfSignals; ++i) {
+        if (!ReadValue(is, size) || !ReadBlock(is, size, block)) {
+            SCLOG_ERROR << "Deserialize: truncated block of signal " << i << std::endl;
+            return false;
+        }
+        if (!targets[i])
+            continue;
+
+        const char * p = block.data();
+        const char * end = p + block.size();
+        // Samples must be aligned with the latest snapshots
+        if (!ParamCodecDetail::ReadRaw(p, end, numberOfSamples) || numberOfSamples > numberOfSnapshots) {
+            SCLOG_ERROR << "Deserialize: invalid number of samples of signal \""
+                        << targets[i]->GetSignalName() << "\"" << std::endl;
+            return false;
+        }
+        p = block.data();
+        if (!targets[i]->ReadBinary(p, end) || p != end) {
+            SCLOG_ERROR << "Deserialize: invalid block of signal \"" << targets[i]->GetSignalName()
+                        << "\"" << std::endl;
+            return false;
+        }
+    }
+
+    SnapshotIndex = (BaseType::IndexType) snapshotIndex;
+
+    return true;
+}
+
+bool HistoryBuffer::DeserializeCsv(std::istream & is)
+{
+    std::string line;
+    FieldsType fields;
+
+    if (!std::getline(is, line)) {
+        SCLOG_ERROR << "Deserialize: header row not found" << std::endl;
+        return false;
+    }
+    SplitFields(line, fields);
+    if (fields.size() < 2 || (fields.size() - 2) % 3 != 0 ||
+        !Equals(fields[0], "snapshot") || !Equals(fields[1], "timestamp"))
+    {
+        SCLOG_ERROR << "Deserialize: invalid header row: " << line << std::endl;
+        return false;
+    }
+
+    // Map columns to signal accessors
+    const size_t numberOfFields = fields.size();
+    const size_t numberOfSignals = (numberOfFields - 2) / 3;
+    std::vector<SignalAccessorBase *> targets(numberOfSignals, 0);
+    for (size_t i = 0; i < numberOfSignals; ++i) {
+        const FieldType & field = fields[2 + i * 3];
+        const std::string name(field.first, field.second);
+        if (!Equals(fields[3 + i * 3], name + ".valid") || !Equals(fields[4 + i * 3], name + ".timestamp")) {
+            SCLOG_ERROR << "Deserialize: invalid header of signal \"" << name << "\"" << std::endl;
+            return false;
+        }
+        const BaseType::IndexType index = GetSignalIndex(name);
+        if (index == BaseType::INVALID_SIGNAL_INDEX) {
+            SCLOG_WARNING << "Deserialize: signal \"" << name << "\" not found (skipped)" << std::endl;
+            continue;
+        }
+        targets[i] = SignalAccessors[index];
+    }
+
+    ClearSamples();
+
+    std::vector<bool> started(numberOfSignals, false);
+    long long snapshotIndex = BaseType::INVALID_SIGNAL_INDEX, timestamp, valid;
+    size_t row = 1;
+    while (std::getline(is, line)) {
+        ++row;
+        SplitFields(line, fields);
+        if (fields.size() == 1 && IsEmpty(fields[0]))
+            continue;
+        if (fields.size() != numberOfFields ||
+            !ParseInteger(fields[0], snapshotIndex) || !ParseInteger(fields[1], timestamp))
+        {
+            SCLOG_ERROR << "Deserialize: invalid row " << row << std::endl;
+            return false;
+        }
+        PushSnapshotTimestamp(timestamp);
+
+        for (size_t i = 0; i < numberOfSignals; ++i) {
+            if (!targets[i])
+                continue;
+
+            const FieldType * f = &fields[2 + i * 3];
+            if (IsEmpty(f[1]) && IsEmpty(f[2])) {
+                // Samples must be aligned with the latest snapshots
+                if (started[i]) {
+                    SCLOG_ERROR << "Deserialize: missing sample of signal \"" << targets[i]->GetSignalName()
+                                << "\" in row " << row << std::endl;
+                    return false;
+                }
+                continue;
+            }
+            started[i] = true;
+
+            if (!ParseInteger(f[1], valid) || !ParseInteger(f[2], timestamp) ||
+                !targets[i]->PushText(f[0].first, f[0].second, (valid != 0), timestamp))
+            {
+                SCLOG_ERROR << "Deserialize: invalid sample of signal \"" << targets[i]->GetSignalName()
+                            << "\" in row " << row << std::endl;
+                return false;
+            }
+        }
+    }
+
+    SnapshotIndex = (BaseType::IndexType) snapshotIndex;
+
+    return true;
+}
+
+HistoryBuffer::BaseType::IndexType HistoryBuffer::RegisterSignalAccessor(SignalAccessorBase * accessor,
+                                                                        StringIDType nameId)
+{
+    const BaseType::IndexType accessorId = (BaseType::IndexType) SignalAccessors.size();
+
+    SignalAccessors.push_back(accessor);
+    SignalAccessorsMap.Insert(nameId, accessorId);
+
+    if (accessor->GetCapacity() > SnapshotTimestamps.capacity())
+        UpdateTimestampsCapacity();
+
+    SCLOG_INFO << "Created accessor (id=" << accessorId << "): " << *accessor << std::endl;
+
+    return accessorId;
+}
+
+void HistoryBuffer::UpdateTimestampsCapacity(void)
+{
+    size_t capacity = (SignalAccessors.empty() ? BufferSize : 1);
+    for (size_t i = 0; i < SignalAccessors.size(); ++i)
+        capacity = std::max(capacity, SignalAccessors[i]->GetCapacity());
+
+    // rset_capacity() removes oldest timestamps when shrinking
+    if (capacity != SnapshotTimestamps.capacity())
+        SnapshotTimestamps.rset_capacity(capacity);
+}
+
+void HistoryBuffer::PushSnapshotTimestamp(SC::TimestampType timestamp)
+{
+    if (!SnapshotTimestamps.empty() && timestamp < SnapshotTimestamps.back())
+        timestamp = SnapshotTimestamps.back();
+
+    SnapshotTimestamps.push_back(timestamp);
+}
+
+bool HistoryBuffer::SetSignalDepth(const BaseType::IndexType & index, size_t depth)
+{
+    if (index == BaseType::INVALID_SIGNAL_INDEX || index >= (BaseType::IndexType) SignalAccessors.size()) {
+        SCLOG_WARNING << "Invalid signal index: " << index << std::endl;
+        return false;
+    }
+    if (depth == 0) {
+        SCLOG_ERROR << "SetSignalDepth: invalid depth for signal \""
+                    << SignalAccessors[index]->GetSignalName() << "\"" << std::endl;
+        return false;
+    }
+
+    if (!SignalAccessors[index]->SetCapacity(depth))
+        return false;
+    UpdateTimestampsCapacity();
+
+    return true;
+}
+
+bool HistoryBuffer::SetBufferSize(size_t bufferSize)
+{
+    if (bufferSize == 0) {
+        SCLOG_ERROR << "SetBufferSize: invalid buffer size" << std::endl;
+        return false;
+    }
+
+    BufferSize = bufferSize;
+    for (size_t i = 0; i < SignalAccessors.size(); ++i)
+        SignalAccessors[i]->SetCapacity(bufferSize);
+    UpdateTimestampsCapacity();
+
+    return true;
+}
+
+size_t HistoryBuffer::GetSignalDepth(const BaseType::IndexType & index) const
+{
+    if (index == BaseType::INVALID_SIGNAL_INDEX || index >= (BaseType::IndexType) SignalAccessors.size())
+        return 0;
+
+    return SignalAccessors[index]->GetCapacity();
+}
+
+size_t HistoryBuffer::GetMemoryUsage(void) const
+{
+    size_t bytes = sizeof(*this) + SnapshotTimestamps.capacity() * sizeof(SC::TimestampType);
+    for (size_t i = 0; i < SignalAccessors.size(); ++i)
+        bytes += SignalAccessors[i]->GetMemoryUsage();
+
+    return bytes;
+}
+
+double HistoryBuffer::GetCompressionRatio(const BaseType::IndexType & index) const
+{
+    if (index == BaseType::INVALID_SIGNAL_INDEX || index >= (BaseType::IndexType) SignalAccessors.size())
+        return 0.0;
+
+    return SignalAccessors[index]->GetCompressionRatio();
+}
+
+bool HistoryBuffer::ReportMemoryUsage(std::ostream & os, size_t budget) const
+{
+    const std::ios::fmtflags f(os.flags());
+    const std::streamsize precision = os.precision();
+
+    os << "HistoryBuffer memory usage: " << SignalAccessors.size() << " signals" << std::endl;
+    os << std::left << std::setw(32) << "  signal" << std::right
+       << std::setw(10) << "depth" << std::setw(10) << "samples" << std::setw(14) << "bytes"
+       << std::setw(10) << "ratio" << std::endl;
+    for (size_t i = 0; i < SignalAccessors.size(); ++i) {
+        const SignalAccessorBase * accessor = SignalAccessors[i];
+        os << "  " << std::left << std::setw(30) << accessor->GetSignalName() << std::right
+           << std::setw(10) << accessor->GetCapacity()
+           << std::setw(10) << accessor->GetNumberOfSamples()
+           << std::setw(14) << accessor->GetMemoryUsage()
+           << std::setw(10) << std::fixed << std::setprecision(2) << accessor->GetCompressionRatio()
+           << std::endl;
+    }
+    os << "  " << std::left << std::setw(30) << "(snapshot timestamps)" << std::right
+       << std::setw(10) << SnapshotTimestamps.capacity()
+       << std::setw(10) << SnapshotTimestamps.size()
+       << std::setw(14) << SnapshotTimestamps.capacity() * sizeof(SC::TimestampType) << std::endl;
+
+    const size_t total = GetMemoryUsage();
+    os << "  Total: " << total << " bytes";
+    const bool withinBudget = (budget == 0 || total <= budget);
+    if (budget != 0)
+        os << " (budget: " << budget << " bytes" << (withinBudget ? ")" : ", EXCEEDED)");
+    os << std::endl;
+
+    os.flags(f);
+    os.precision(precision);
+
+    return withinBudget;
+}
+
+void HistoryBuffer::ClearSamples(void)
+{
+    for (size_t i = 0; i < SignalAccessors.size(); ++i)
+        SignalAccessors[i]->Clear();
+    SnapshotTimestamps.clear();
+    SnapshotIndex = BaseType::INVALID_SIGNAL_INDEX;
 }
 
 bool HistoryBuffer::FindSignal(const HistoryBuffer::BaseType::IDType & id) const
@@ -100,24 +682,109 @@ bool HistoryBuffer::FindSignal(const HistoryBuffer::BaseType::IDType & id) const
     return (GetSignalIndex(id) != HistoryBuffer::BaseType::INVALID_SIGNAL_INDEX);
 }
 
-HistoryBuffer::BaseType::IndexType HistoryBuffer::GetSignalIndex(const BaseType::IDType & id) const
+bool HistoryBuffer::FindSignal(StringIDType nameId) const
 {
-    SignalAccessorsMapType::const_iterator it = SignalAccessorsMap.find(id);
+    return (GetSignalIndex(nameId) != HistoryBuffer::BaseType::INVALID_SIGNAL_INDEX);
+}
 
-    if (it == SignalAccessorsMap.end())
+HistoryBuffer::BaseType::IndexType HistoryBuffer::GetSignalIndex(const BaseType::IDType & id) const
+{
+    const StringIDType nameId = StringTable::GetInstance()->Find(id);
+    if (nameId == INVALID_STRING_ID)
         return HistoryBuffer::BaseType::INVALID_SIGNAL_INDEX;
-    else
-        return it->second;
+
+    return GetSignalIndex(nameId);
+}
+
+HistoryBuffer::BaseType::IndexType HistoryBuffer::GetSignalIndex(StringIDType nameId) const
+{
+    const BaseType::IndexType * index = SignalAccessorsMap.Find(nameId);
+
+    return (index ? *index : HistoryBuffer::BaseType::INVALID_SIGNAL_INDEX);
+}
+
+void HistoryBuffer::FindTimeRange(size_t accessorSize, SC::TimestampType t0, SC::TimestampType t1,
+                                  size_t & begin, size_t & count) const
+{
+    begin = count = 0;
+    if (t0 > t1 || accessorSize == 0)
+        return;
+
+    // Signal accessors may have fewer samples than SnapshotTimestamps if they
+    // were added after the first snapshot; align them from the latest sample.
+    SCASSERT(accessorSize <= SnapshotTimestamps.size());
+    TimestampsType::const_iterator itBegin = SnapshotTimestamps.end() - accessorSize;
+    TimestampsType::const_iterator itEnd   = SnapshotTimestamps.end();
+
+    // Timestamps are monotonic, and circular_buffer iterators hide wrap-around
+    TimestampsType::const_iterator first = std::lower_bound(itBegin, itEnd, t0);
+    TimestampsType::const_iterator last  = std::upper_bound(first, itEnd, t1);
+
+    begin = first - itBegin;
+    count = last - first;
+}
+
+bool HistoryBuffer::FindPrevious(size_t accessorSize, SC::TimestampType t, size_t & index) const
+{
+    if (accessorSize == 0)
+        return false;
+
+    SCASSERT(accessorSize <= SnapshotTimestamps.size());
+    // Samples of the accessor are aligned with the latest snapshots.  Note that
+    // circular_buffer::operator[] hides wrap-around.
+    const size_t offset = SnapshotTimestamps.size() - accessorSize;
+    const TimestampsType & ts = SnapshotTimestamps;
+
+    size_t lo = 0, hi = accessorSize - 1;
+    if (ts[offset + lo] > t)
+        return false;
+    if (ts[offset + hi] <= t) {
+        index = hi;
+        return true;
+    }
+
+    // Invariant: ts[offset + lo] <= t < ts[offset + hi]
+    bool bisect = false;
+    while (hi - lo > 1) {
+        size_t mid;
+        if (bisect) {
+            mid = lo + (hi - lo) / 2;
+        } else {
+            const double ratio = (double)(t - ts[offset + lo]) / (double)(ts[offset + hi] - ts[offset + lo]);
+            mid = lo + (size_t)(ratio * (hi - lo));
+            if (mid <= lo)      mid = lo + 1;
+            else if (mid >= hi) mid = hi - 1;
+        }
+
+        const size_t range = hi - lo;
+        if (ts[offset + mid] <= t)
+            lo = mid;
+        else
+            hi = mid;
+
+        // Fall back to bisection if interpolation did not halve the range
+        bisect = (!bisect && (hi - lo) * 2 > range);
+    }
+
+    index = lo;
+    return true;
 }
 
 void HistoryBuffer::Snapshot(void)
 {
-    // Iterating signal accessors, copy current parameter and push to circular buffer
-    SignalAccessorsType::iterator it = SignalAccessors.begin();
-    const SignalAccessorsType::iterator itEnd = SignalAccessors.end();
+    Snapshot(GetCurrentTimestamp());
+}
+
+void HistoryBuffer::Snapshot(SC::TimestampType timestamp)
+{
+    // Iterating signal accessor groups, copy current parameter and push to circular buffer
+    SignalAccessorGroupsType::iterator it = SignalAccessorGroups.begin();
+    const SignalAccessorGroupsType::iterator itEnd = SignalAccessorGroups.end();
     for (; it != itEnd; ++it)
         (*it)->Push();
 
+    PushSnapshotTimestamp(timestamp);
+
     // Update snapshot index
     // In case of the very first snapshot, manually set it to 1
     if (SnapshotIndex == HistoryBuffer::BaseType::INVALID_SIGNAL_INDEX)
@@ -0,0 +1,191 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include <iomanip>
+#include <algorithm>
+
+#include "safecass/historyBufferColumnar.h"
+
+using namespace SC;
+
+HistoryBufferColumnar::HistoryBufferColumnar(size_t bufferSize)
+    : BufferSize(bufferSize),
+      SnapshotIndex(HistoryBufferColumnar::BaseType::INVALID_SIGNAL_INDEX),
+      LatestRow(bufferSize - 1),
+      Timestamps(bufferSize, 0)
+{
+    SCASSERT(BufferSize > 0);
+}
+
+HistoryBufferColumnar::~HistoryBufferColumnar()
+{
+    ColumnsType::iterator it = Columns.begin();
+    ColumnsType::iterator itEnd = Columns.end();
+    for (; it != itEnd; ++it)
+        delete *it;
+}
+
+bool HistoryBufferColumnar::CheckReadable(BaseType::IndexType index) const
+{
+    if (index == HistoryBufferColumnar::BaseType::INVALID_SIGNAL_INDEX || index >= (BaseType::IndexType) Columns.size()) {
+        SCLOG_WARNING << "Invalid signal index: " << index << std::endl;
+        return false;
+    }
+
+    if (Columns[index]->GetNumberOfSamples() == 0) {
+        SCLOG_WARNING << "No sample available: \"" << Columns[index]->GetSignalName() << "\"" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool HistoryBufferColumnar::GetNewValue(const BaseType::IDType & id, ParamBase & arg) const
+{
+    HistoryBufferColumnar::BaseType::IndexType index = GetSignalIndex(id);
+    if (index == HistoryBufferColumnar::BaseType::INVALID_SIGNAL_INDEX) {
+        SCLOG_WARNING << "Signal \"" << id << "\" not found" << std::endl;
+        return false;
+    }
+
+    return GetNewValue(index, arg);
+}
+
+bool HistoryBufferColumnar::GetNewValue(const BaseType::IndexType & index, ParamBase & arg) const
+{
+    if (!CheckReadable(index))
+        return false;
+
+    Columns[index]->GetValue(LatestRow, arg);
+    arg.SetTimestamp(Timestamps[LatestRow]);
+
+    return true;
+}
+
+void HistoryBufferColumnar::ToStream(std::ostream & os) const
+{
+    Serialize(os);
+}
+
+void HistoryBufferColumnar::Serialize(std::ostream & os) const
+{
+    os << "HistoryBufferColumnar: Snapshot index (" << SnapshotIndex << "), "
+       << "Number of signals (" << Columns.size() << "): ";
+
+    if (Columns.empty()) {
+        os << "No column" << std::endl;
+        return;
+    } else {
+        os << std::endl;
+    }
+
+    const size_t digit = log10(BufferSize) + 1;
+    const std::ios::fmtflags f(os.flags());
+    for (size_t i = 0; i < Columns.size(); ++i) {
+        const char prevFiller = os.fill('0');
+        os << std::setw(digit) << i << ": ";
+        os.flags(f);
+        os.fill(prevFiller);
+        Columns[i]->ToStream(os, Timestamps, LatestRow);
+        os << std::endl;
+    }
+}
+
+bool HistoryBufferColumnar::FindSignal(const HistoryBufferColumnar::BaseType::IDType & id) const
+{
+    return (GetSignalIndex(id) != HistoryBufferColumnar::BaseType::INVALID_SIGNAL_INDEX);
+}
+
+HistoryBufferColumnar::BaseType::IndexType HistoryBufferColumnar::GetSignalIndex(const BaseType::IDType & id) const
+{
+    ColumnsMapType::const_iterator it = ColumnsMap.find(id);
+
+    if (it == ColumnsMap.end())
+        return HistoryBufferColumnar::BaseType::INVALID_SIGNAL_INDEX;
+    else
+        return it->second;
+}
+
+void HistoryBufferColumnar::FindTimeRange(size_t n, SC::TimestampType t0, SC::TimestampType t1,
+                                          size_t & begin, size_t & count) const
+{
+    begin = count = 0;
+    if (t0 > t1 || n == 0)
+        return;
+
+    // Timestamps of the samples are monotonic from the oldest to the latest
+    size_t lo = 0, hi = n;
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        if (Timestamps[GetRow(n, mid)] < t0) lo = mid + 1;
+        else                                 hi = mid;
+    }
+    begin = lo;
+
+    hi = n;
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        if (Timestamps[GetRow(n, mid)] <= t1) lo = mid + 1;
+        else                                  hi = mid;
+    }
+    count = lo - begin;
+}
+
+bool HistoryBufferColumnar::ReduceLastN(const BaseType::IndexType & index, size_t n,
+                                        ReductionType type, double & result) const
+{
+    if (!CheckReadable(index))
+        return false;
+
+    const size_t samples = Columns[index]->GetNumberOfSamples();
+    n = std::min(n, samples);
+    if (n == 0)
+        return false;
+
+    return Columns[index]->Reduce(GetRow(samples, samples - n), n, type, result);
+}
+
+bool HistoryBufferColumnar::ReduceRange(const BaseType::IndexType & index, SC::TimestampType t0, SC::TimestampType t1,
+                                        ReductionType type, double & result) const
+{
+    if (!CheckReadable(index))
+        return false;
+
+    const size_t samples = Columns[index]->GetNumberOfSamples();
+    size_t begin, count;
+    FindTimeRange(samples, t0, t1, begin, count);
+    if (count == 0)
+        return false;
+
+    return Columns[index]->Reduce(GetRow(samples, begin), count, type, result);
+}
+
+void HistoryBufferColumnar::Snapshot(void)
+{
+    // All columns share the same row, so the row and the timestamp are computed
+    // only once per snapshot.
+    LatestRow = (LatestRow + 1) % BufferSize;
+    Timestamps[LatestRow] = GetCurrentTimestamp();
+
+    ColumnsType::iterator it = Columns.begin();
+    const ColumnsType::iterator itEnd = Columns.end();
+    for (; it != itEnd; ++it)
+        (*it)->Capture(LatestRow);
+
+    // Update snapshot index
+    // In case of the very first snapshot, manually set it to 1
+    if (SnapshotIndex == HistoryBufferColumnar::BaseType::INVALID_SIGNAL_INDEX)
+        SnapshotIndex = 1;
+    else
+        ++SnapshotIndex;
+}
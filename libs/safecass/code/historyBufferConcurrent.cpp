@@ -0,0 +1,173 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+// References:
+//
+//   * Hans-J. Boehm, "Can Seqlocks Get Along With Programming Language Memory
+//     Models?", MSPC 2012
+//
+
+#include "safecass/historyBufferConcurrent.h"
+
+using namespace SC;
+
+HistoryBufferConcurrent::HistoryBufferConcurrent(size_t bufferSize)
+    : BufferSize(bufferSize),
+      WriteCount(0),
+      PublishedCount(0),
+      Timestamps(bufferSize, 0)
+{
+    SCASSERT(BufferSize > 0);
+
+    Sequences = new boost::atomic<SequenceType>[BufferSize];
+    for (size_t i = 0; i < BufferSize; ++i)
+        Sequences[i].store(0, boost::memory_order_relaxed);
+}
+
+HistoryBufferConcurrent::~HistoryBufferConcurrent()
+{
+    ColumnsType::iterator it = Columns.begin();
+    ColumnsType::iterator itEnd = Columns.end();
+    for (; it != itEnd; ++it)
+        delete *it;
+
+    delete [] Sequences;
+}
+
+bool HistoryBufferConcurrent::GetNewValue(const BaseType::IDType & id, ParamBase & arg) const
+{
+    HistoryBufferConcurrent::BaseType::IndexType index = GetSignalIndex(id);
+    if (index == HistoryBufferConcurrent::BaseType::INVALID_SIGNAL_INDEX) {
+        SCLOG_WARNING << "Signal \"" << id << "\" not found" << std::endl;
+        return false;
+    }
+
+    return GetNewValue(index, arg);
+}
+
+bool HistoryBufferConcurrent::GetNewValue(const BaseType::IndexType & index, ParamBase & arg) const
+{
+    ParamBase * args[1] = { &arg };
+    return ReadLatest(&index, args, 1);
+}
+
+bool HistoryBufferConcurrent::GetNewValues(const std::vector<BaseType::IndexType> & indices,
+                                           const std::vector<ParamBase *> & args) const
+{
+    if (indices.size() != args.size()) {
+        SCLOG_WARNING << "GetNewValues: size mismatch: " << indices.size() << " indices, "
+                      << args.size() << " arguments" << std::endl;
+        return false;
+    }
+    if (indices.empty())
+        return true;
+
+    return ReadLatest(&indices[0], &args[0], indices.size());
+}
+
+bool HistoryBufferConcurrent::ReadLatest(const BaseType::IndexType * indices,
+                                         ParamBase * const * args, size_t n) const
+{
+    // Validate arguments before entering the read loop
+    for (size_t i = 0; i < n; ++i) {
+        if (indices[i] == HistoryBufferConcurrent::BaseType::INVALID_SIGNAL_INDEX ||
+            indices[i] >= (BaseType::IndexType) Columns.size())
+        {
+            SCLOG_WARNING << "Invalid signal index: " << indices[i] << std::endl;
+            return false;
+        }
+        if (!Columns[indices[i]]->CheckType(*args[i])) {
+            SCLOG_WARNING << "Type mismatch: \"" << Columns[indices[i]]->GetSignalName() << "\"" << std::endl;
+            return false;
+        }
+    }
+
+    while (true) {
+        const SequenceType count = PublishedCount.load(boost::memory_order_acquire);
+        if (count == 0) {
+            SCLOG_WARNING << "No snapshot available" << std::endl;
+            return false;
+        }
+
+        const size_t row = (count - 1) % BufferSize;
+
+        const SequenceType seqBegin = Sequences[row].load(boost::memory_order_acquire);
+        if (seqBegin & 1)
+            continue; // writer is updating this row
+
+        for (size_t i = 0; i < n; ++i) {
+            Columns[indices[i]]->Read(row, *args[i]);
+            args[i]->SetTimestamp(Timestamps[row]);
+        }
+
+        // Make sure reads above are not reordered with the sequence check below
+        boost::atomic_thread_fence(boost::memory_order_acquire);
+
+        if (Sequences[row].load(boost::memory_order_relaxed) == seqBegin)
+            return true;
+    }
+}
+
+void HistoryBufferConcurrent::ToStream(std::ostream & os) const
+{
+    os << "HistoryBufferConcurrent: Snapshot index (" << GetSnapshotIndex() << "), "
+       << "Number of signals (" << Columns.size() << ")";
+
+    if (Columns.empty())
+        return;
+
+    os << ": ";
+    for (size_t i = 0; i < Columns.size(); ++i) {
+        os << "\"" << Columns[i]->GetSignalName() << "\"";
+        if (i + 1 != Columns.size())
+            os << ", ";
+    }
+}
+
+bool HistoryBufferConcurrent::FindSignal(const HistoryBufferConcurrent::BaseType::IDType & id) const
+{
+    return (GetSignalIndex(id) != HistoryBufferConcurrent::BaseType::INVALID_SIGNAL_INDEX);
+}
+
+HistoryBufferConcurrent::BaseType::IndexType HistoryBufferConcurrent::GetSignalIndex(const BaseType::IDType & id) const
+{
+    ColumnsMapType::const_iterator it = ColumnsMap.find(id);
+
+    if (it == ColumnsMap.end())
+        return HistoryBufferConcurrent::BaseType::INVALID_SIGNAL_INDEX;
+    else
+        return it->second;
+}
+
+void HistoryBufferConcurrent::Snapshot(void)
+{
+    const size_t row = WriteCount % BufferSize;
+    const SequenceType seq = Sequences[row].load(boost::memory_order_relaxed);
+
+    // Mark the row as being written.  The release fence keeps the writes below
+    // from being reordered before the odd sequence number becomes visible.
+    Sequences[row].store(seq + 1, boost::memory_order_relaxed);
+    boost::atomic_thread_fence(boost::memory_order_release);
+
+    Timestamps[row] = GetCurrentTimestamp();
+
+    ColumnsType::iterator it = Columns.begin();
+    const ColumnsType::iterator itEnd = Columns.end();
+    for (; it != itEnd; ++it)
+        (*it)->Capture(row);
+
+    // Mark the row as complete and publish it to readers
+    Sequences[row].store(seq + 2, boost::memory_order_release);
+
+    ++WriteCount;
+    PublishedCount.store(WriteCount, boost::memory_order_release);
+}
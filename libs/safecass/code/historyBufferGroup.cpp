@@ -0,0 +1,102 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#include "safecass/historyBufferGroup.h"
+
+using namespace SC;
+
+const HistoryBufferGroup::IndexType HistoryBufferGroup::INVALID_BUFFER_INDEX = -1;
+const HistoryBufferGroup::TickType HistoryBufferGroup::INVALID_TICK = -1;
+
+HistoryBufferGroup::HistoryBufferGroup(void): NumberOfTicks(0)
+{
+}
+
+HistoryBufferGroup::IndexType HistoryBufferGroup::AddBuffer(HistoryBuffer * buffer)
+{
+    if (!buffer) {
+        SCLOG_ERROR << "HistoryBufferGroup: null history buffer" << std::endl;
+        return INVALID_BUFFER_INDEX;
+    }
+    for (size_t i = 0; i < Members.size(); ++i) {
+        if (Members[i].Buffer == buffer) {
+            SCLOG_ERROR << "HistoryBufferGroup: history buffer already in group" << std::endl;
+            return INVALID_BUFFER_INDEX;
+        }
+    }
+
+    MemberType member;
+    member.Buffer = buffer;
+    member.SnapshotIndex = buffer->GetSnapshotIndex();
+    member.AlignedSince = NumberOfTicks;
+    Members.push_back(member);
+
+    return (IndexType) (Members.size() - 1);
+}
+
+HistoryBuffer * HistoryBufferGroup::GetBuffer(IndexType buffer) const
+{
+    if (buffer < 0 || buffer >= (IndexType) Members.size())
+        return 0;
+
+    return Members[buffer].Buffer;
+}
+
+void HistoryBufferGroup::Snapshot(void)
+{
+    Snapshot(GetCurrentTimestamp());
+}
+
+void HistoryBufferGroup::Snapshot(SC::TimestampType timestamp)
+{
+    MembersType::iterator it = Members.begin();
+    const MembersType::iterator itEnd = Members.end();
+    for (; it != itEnd; ++it) {
+        // Snapshotted or cleared outside group: earlier samples are not aligned
+        if (it->Buffer->GetSnapshotIndex() != it->SnapshotIndex) {
+            SCLOG_WARNING << "HistoryBufferGroup: history buffer snapshotted outside group, "
+                          << "realigned at tick " << NumberOfTicks << std::endl;
+            it->AlignedSince = NumberOfTicks;
+        }
+        it->Buffer->Snapshot(timestamp);
+        it->SnapshotIndex = it->Buffer->GetSnapshotIndex();
+    }
+
+    ++NumberOfTicks;
+}
+
+bool HistoryBufferGroup::IsAligned(IndexType buffer, TickType tick) const
+{
+    if (buffer < 0 || buffer >= (IndexType) Members.size())
+        return false;
+    if (tick < 0 || tick >= NumberOfTicks)
+        return false;
+
+    const MemberType & member = Members[buffer];
+    return (tick >= member.AlignedSince && member.Buffer->GetSnapshotIndex() == member.SnapshotIndex);
+}
+
+bool HistoryBufferGroup::GetTimestamp(TickType tick, SC::TimestampType & timestamp) const
+{
+    for (size_t i = 0; i < Members.size(); ++i) {
+        if (!IsAligned((IndexType) i, tick))
+            continue;
+        const HistoryBuffer::TimestampsType & timestamps = Members[i].Buffer->GetSnapshotTimestamps();
+        const TickType age = NumberOfTicks - 1 - tick;
+        if (age < (TickType) timestamps.size()) {
+            timestamp = timestamps[timestamps.size() - 1 - (size_t) age];
+            return true;
+        }
+    }
+
+    return false;
+}
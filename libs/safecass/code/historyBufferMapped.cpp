@@ -0,0 +1,517 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include <iomanip>
+#include <algorithm>
+#include <cerrno>
+
+#include <boost/atomic.hpp>
+
+#include "safecass/historyBufferMapped.h"
+
+#if (SAFECASS_ON_LINUX || SAFECASS_ON_MAC)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace SC;
+
+namespace {
+
+//! Alignment of columns in file
+const size_t COLUMN_ALIGNMENT = 64;
+
+inline size_t Align(size_t offset) {
+    return (offset + COLUMN_ALIGNMENT - 1) / COLUMN_ALIGNMENT * COLUMN_ALIGNMENT;
+}
+
+//! Returns true if [offset, offset + size) lies within file (no overflow)
+inline bool FitsInFile(boost::uint64_t offset, boost::uint64_t size, boost::uint64_t fileSize) {
+    return (size <= fileSize && offset <= fileSize - size);
+}
+
+//! Multiplies a and b; returns false on overflow
+inline bool Multiply(boost::uint64_t a, boost::uint64_t b, boost::uint64_t & result) {
+    if (a != 0 && b > (boost::uint64_t) -1 / a)
+        return false;
+    result = a * b;
+    return true;
+}
+
+//! Prints a sample stored in file as ParamEigen
+template<typename _scalar>
+void PrintSample(std::ostream & os, const MappedSignalHeader & header,
+                 const char * value, bool valid, SC::TimestampType timestamp)
+{
+    if (header.Kind == MappedSignalHeader::KIND_SCALAR) {
+        _scalar v;
+        memcpy(&v, value, sizeof(_scalar));
+        ParamEigen<_scalar> param(v);
+        param.SetValid(valid);
+        param.SetTimestamp(timestamp);
+        os << param;
+    } else {
+        typedef Eigen::Matrix<_scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor> ColMajorType;
+        typedef Eigen::Matrix<_scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> RowMajorType;
+        ColMajorType m(header.Rows, header.Cols);
+        if (header.Kind == MappedSignalHeader::KIND_EIGEN_ROW_MAJOR) {
+            RowMajorType r(header.Rows, header.Cols);
+            memcpy(r.data(), value, header.GetValueSize());
+            m = r;
+        } else {
+            memcpy(m.data(), value, header.GetValueSize());
+        }
+        ParamEigen<ColMajorType> param(m);
+        param.SetValid(valid);
+        param.SetTimestamp(timestamp);
+        os << param;
+    }
+}
+
+//! Prints a sample of any type supported
+void PrintSample(std::ostream & os, const MappedSignalHeader & header,
+                 const char * value, bool valid, SC::TimestampType timestamp)
+{
+#define PRINT_SAMPLE(_scalar) PrintSample<_scalar>(os, header, value, valid, timestamp); return;
+    switch (header.ScalarKind) {
+    case MappedSignalHeader::SCALAR_BOOL:
+        PRINT_SAMPLE(bool);
+    case MappedSignalHeader::SCALAR_SIGNED:
+        switch (header.ScalarSize) {
+        case 1: PRINT_SAMPLE(boost::int8_t);
+        case 2: PRINT_SAMPLE(boost::int16_t);
+        case 4: PRINT_SAMPLE(boost::int32_t);
+        case 8: PRINT_SAMPLE(boost::int64_t);
+        }
+        break;
+    case MappedSignalHeader::SCALAR_UNSIGNED:
+        switch (header.ScalarSize) {
+        case 1: PRINT_SAMPLE(boost::uint8_t);
+        case 2: PRINT_SAMPLE(boost::uint16_t);
+        case 4: PRINT_SAMPLE(boost::uint32_t);
+        case 8: PRINT_SAMPLE(boost::uint64_t);
+        }
+        break;
+    case MappedSignalHeader::SCALAR_FLOAT:
+        switch (header.ScalarSize) {
+        case 4: PRINT_SAMPLE(float);
+        case 8: PRINT_SAMPLE(double);
+        }
+        break;
+    }
+#undef PRINT_SAMPLE
+
+    os << "(unknown type)";
+}
+
+};
+
+HistoryBufferMapped::HistoryBufferMapped(void)
+    : FileDescriptor(-1), Base(0), MappedSize(0), ReadOnly(false)
+{
+}
+
+HistoryBufferMapped::~HistoryBufferMapped()
+{
+    Close();
+}
+
+void HistoryBufferMapped::Close(void)
+{
+    ColumnsType::iterator it = Columns.begin();
+    ColumnsType::iterator itEnd = Columns.end();
+    for (; it != itEnd; ++it)
+        delete *it;
+    Columns.clear();
+    ColumnsMap.clear();
+
+#if (SAFECASS_ON_LINUX || SAFECASS_ON_MAC)
+    if (Base)
+        munmap(Base, MappedSize);
+    if (FileDescriptor != -1)
+        close(FileDescriptor);
+#endif
+
+    Base = 0;
+    MappedSize = 0;
+    FileDescriptor = -1;
+    ReadOnly = false;
+}
+
+bool HistoryBufferMapped::Remap(size_t fileSize)
+{
+#if (SAFECASS_ON_LINUX || SAFECASS_ON_MAC)
+    if (Base) {
+        munmap(Base, MappedSize);
+        Base = 0;
+        MappedSize = 0;
+    }
+
+    if (!ReadOnly && ftruncate(FileDescriptor, fileSize) != 0) {
+        SCLOG_ERROR << "Failed to resize file " << FileName << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+
+    void * base = mmap(0, fileSize, (ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE),
+                       MAP_SHARED, FileDescriptor, 0);
+    if (base == MAP_FAILED) {
+        SCLOG_ERROR << "Failed to map file " << FileName << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+
+    Base = static_cast<char *>(base);
+    MappedSize = fileSize;
+    if (!ReadOnly)
+        GetFileHeader()->FileSize = fileSize;
+
+    return true;
+#else
+    SCLOG_ERROR << "Memory-mapped history buffer is not supported on this platform" << std::endl;
+    return false;
+#endif
+}
+
+bool HistoryBufferMapped::Create(const std::string & fileName, size_t bufferSize, size_t maxSignals)
+{
+    Close();
+
+    SCASSERT(bufferSize > 0);
+
+    // One spare row for the snapshot being written (see layout of file)
+    const size_t rows = bufferSize + 1;
+
+#if (SAFECASS_ON_LINUX || SAFECASS_ON_MAC)
+    FileName = fileName;
+    FileDescriptor = open(fileName.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (FileDescriptor == -1) {
+        SCLOG_ERROR << "Failed to create file " << fileName << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+
+    const size_t timestampOffset =
+        Align(sizeof(MappedFileHeader) + maxSignals * sizeof(MappedSignalHeader));
+    const size_t fileSize = Align(timestampOffset + rows * sizeof(SC::TimestampType));
+
+    if (!Remap(fileSize)) {
+        Close();
+        return false;
+    }
+
+    // New file is zero-filled
+    MappedFileHeader * header = GetFileHeader();
+    strncpy(header->Magic, SC_HISTORY_BUFFER_FILE_MAGIC, sizeof(header->Magic));
+    header->Version         = SC_HISTORY_BUFFER_FILE_VERSION;
+    header->BufferSize      = rows;
+    header->MaxSignals      = maxSignals;
+    header->NumberOfSignals = 0;
+    header->SnapshotCount   = 0;
+    header->TimestampOffset = timestampOffset;
+
+    SCLOG_INFO << "Created history buffer file " << fileName << " (" << fileSize << " bytes)" << std::endl;
+
+    return true;
+#else
+    SCLOG_ERROR << "Memory-mapped history buffer is not supported on this platform" << std::endl;
+    return false;
+#endif
+}
+
+bool HistoryBufferMapped::Open(const std::string & fileName)
+{
+    Close();
+
+#if (SAFECASS_ON_LINUX || SAFECASS_ON_MAC)
+    FileName = fileName;
+    FileDescriptor = open(fileName.c_str(), O_RDONLY);
+    if (FileDescriptor == -1) {
+        SCLOG_ERROR << "Failed to open file " << fileName << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(FileDescriptor, &st) != 0 || (size_t) st.st_size < sizeof(MappedFileHeader)) {
+        SCLOG_ERROR << "Invalid history buffer file: " << fileName << std::endl;
+        Close();
+        return false;
+    }
+
+    ReadOnly = true;
+    if (!Remap(st.st_size)) {
+        Close();
+        return false;
+    }
+
+    // Header area, i.e., file header and signal headers, must end before the
+    // timestamp column, and all columns must lie within the file
+    const MappedFileHeader * header = GetFileHeader();
+    const boost::uint64_t headerSize =
+        sizeof(MappedFileHeader) + (boost::uint64_t) header->MaxSignals * sizeof(MappedSignalHeader);
+    if (strncmp(header->Magic, SC_HISTORY_BUFFER_FILE_MAGIC, sizeof(header->Magic)) != 0 ||
+        header->Version != SC_HISTORY_BUFFER_FILE_VERSION ||
+        header->FileSize > (boost::uint64_t) st.st_size ||
+        header->BufferSize < 2 ||
+        header->NumberOfSignals > header->MaxSignals ||
+        headerSize > header->TimestampOffset ||
+        !FitsInFile(header->TimestampOffset,
+                    (boost::uint64_t) header->BufferSize * sizeof(SC::TimestampType), header->FileSize))
+    {
+        SCLOG_ERROR << "Invalid history buffer file: " << fileName << std::endl;
+        Close();
+        return false;
+    }
+
+    for (size_t i = 0; i < header->NumberOfSignals; ++i) {
+        const MappedSignalHeader * signal = GetSignalHeader(i);
+        boost::uint64_t valueSize, valueColumnSize;
+        if (signal->Name[SC_HISTORY_BUFFER_FILE_NAME_LENGTH - 1] != '\0' ||
+            !Multiply((boost::uint64_t) signal->ScalarSize * signal->Rows, signal->Cols, valueSize) ||
+            !Multiply(valueSize, header->BufferSize, valueColumnSize) ||
+            signal->ValueOffset < header->TimestampOffset ||
+            signal->ValidOffset < header->TimestampOffset ||
+            !FitsInFile(signal->ValueOffset, valueColumnSize, header->FileSize) ||
+            !FitsInFile(signal->ValidOffset, header->BufferSize, header->FileSize) ||
+            signal->FirstSnapshot > header->SnapshotCount)
+        {
+            SCLOG_ERROR << "Invalid history buffer file: " << fileName << " (signal " << i << ")" << std::endl;
+            Close();
+            return false;
+        }
+        ColumnsMap.insert(std::make_pair(std::string(signal->Name), (BaseType::IndexType) i));
+    }
+
+    return true;
+#else
+    SCLOG_ERROR << "Memory-mapped history buffer is not supported on this platform" << std::endl;
+    return false;
+#endif
+}
+
+bool HistoryBufferMapped::Flush(void)
+{
+#if (SAFECASS_ON_LINUX || SAFECASS_ON_MAC)
+    if (!Base || ReadOnly)
+        return false;
+
+    return (msync(Base, MappedSize, MS_SYNC) == 0);
+#else
+    return false;
+#endif
+}
+
+MappedSignalHeader * HistoryBufferMapped::AddSignalHeader(const BaseType::IDType & name, int kind,
+                                                          int scalarKind, size_t scalarSize,
+                                                          size_t rows, size_t cols)
+{
+    if (!Base || ReadOnly) {
+        SCLOG_ERROR << "AddSignal() failed: no file created" << std::endl;
+        return 0;
+    }
+
+    // Check duplicate name
+    if (FindSignal(name)) {
+        SCLOG_ERROR << "AddSignal() failed: duplicate name \"" << name << "\"" << std::endl;
+        return 0;
+    }
+
+    if (name.size() >= SC_HISTORY_BUFFER_FILE_NAME_LENGTH) {
+        SCLOG_ERROR << "AddSignal() failed: name too long \"" << name << "\"" << std::endl;
+        return 0;
+    }
+
+    MappedFileHeader * header = GetFileHeader();
+    if (header->NumberOfSignals == header->MaxSignals) {
+        SCLOG_ERROR << "AddSignal() failed: max number of signals reached (" << header->MaxSignals << ")" << std::endl;
+        return 0;
+    }
+
+    // Append value and valid columns at the end of file
+    const size_t bufferSize  = header->BufferSize;
+    const size_t valueOffset = header->FileSize;
+    const size_t validOffset = Align(valueOffset + scalarSize * rows * cols * bufferSize);
+    if (!Remap(Align(validOffset + bufferSize)))
+        return 0;
+
+    header = GetFileHeader();
+    MappedSignalHeader * signal = GetSignalHeader(header->NumberOfSignals);
+    memset(signal, 0, sizeof(MappedSignalHeader));
+    strncpy(signal->Name, name.c_str(), SC_HISTORY_BUFFER_FILE_NAME_LENGTH - 1);
+    signal->Kind          = kind;
+    signal->ScalarKind    = scalarKind;
+    signal->ScalarSize    = scalarSize;
+    signal->Rows          = rows;
+    signal->Cols          = cols;
+    signal->FirstSnapshot = header->SnapshotCount;
+    signal->ValueOffset   = valueOffset;
+    signal->ValidOffset   = validOffset;
+
+    // Signal becomes visible to readers only after its header is complete
+    boost::atomic_thread_fence(boost::memory_order_release);
+    ++header->NumberOfSignals;
+
+    return signal;
+}
+
+bool HistoryBufferMapped::GetNewValue(const BaseType::IDType & id, ParamBase & arg) const
+{
+    HistoryBufferMapped::BaseType::IndexType index = GetSignalIndex(id);
+    if (index == HistoryBufferMapped::BaseType::INVALID_SIGNAL_INDEX) {
+        SCLOG_WARNING << "Signal \"" << id << "\" not found" << std::endl;
+        return false;
+    }
+
+    return GetNewValue(index, arg);
+}
+
+bool HistoryBufferMapped::GetNewValue(const BaseType::IndexType & index, ParamBase & arg) const
+{
+    if (index == HistoryBufferMapped::BaseType::INVALID_SIGNAL_INDEX || index >= (BaseType::IndexType) Columns.size()) {
+        SCLOG_WARNING << "Invalid signal index: " << index << std::endl;
+        return false;
+    }
+
+    const MappedFileHeader * header = GetFileHeader();
+    const MappedSignalHeader * signal = GetSignalHeader(index);
+    if (header->SnapshotCount == signal->FirstSnapshot) {
+        SCLOG_WARNING << "No sample available: \"" << signal->Name << "\"" << std::endl;
+        return false;
+    }
+
+    const size_t row = (header->SnapshotCount - 1) % header->BufferSize;
+    if (!Columns[index]->Read(Base, *signal, row, arg)) {
+        SCLOG_WARNING << "Type mismatch: \"" << signal->Name << "\"" << std::endl;
+        return false;
+    }
+    arg.SetTimestamp(GetTimestampColumn()[row]);
+
+    return true;
+}
+
+size_t HistoryBufferMapped::GetBufferSize(void) const
+{
+    return (Base ? GetFileHeader()->BufferSize - 1 : 0);
+}
+
+size_t HistoryBufferMapped::GetNumberOfSamples(const MappedSignalHeader & signal) const
+{
+    // Row of the oldest snapshot may be torn if the writer crashed while
+    // overwriting it, and thus is excluded
+    const MappedFileHeader * header = GetFileHeader();
+    return std::min((size_t) (header->SnapshotCount - signal.FirstSnapshot),
+                    (size_t) header->BufferSize - 1);
+}
+
+size_t HistoryBufferMapped::GetNumberOfSignals(void) const
+{
+    return (Base ? GetFileHeader()->NumberOfSignals : 0);
+}
+
+HistoryBufferMapped::BaseType::IndexType HistoryBufferMapped::GetSnapshotIndex(void) const
+{
+    if (!Base || GetFileHeader()->SnapshotCount == 0)
+        return HistoryBufferMapped::BaseType::INVALID_SIGNAL_INDEX;
+
+    return (BaseType::IndexType) GetFileHeader()->SnapshotCount;
+}
+
+void HistoryBufferMapped::ToStream(std::ostream & os) const
+{
+    Serialize(os);
+}
+
+void HistoryBufferMapped::Serialize(std::ostream & os) const
+{
+    const size_t numberOfSignals = GetNumberOfSignals();
+
+    os << "HistoryBuffer: Snapshot index (" << GetSnapshotIndex() << "), "
+       << "Number of signals (" << numberOfSignals << "): ";
+
+    if (numberOfSignals == 0) {
+        os << "No signal accessor" << std::endl;
+        return;
+    } else {
+        os << std::endl;
+    }
+
+    const MappedFileHeader * header = GetFileHeader();
+    const SC::TimestampType * timestamps = GetTimestampColumn();
+    const size_t bufferSize = header->BufferSize;
+    const size_t count = header->SnapshotCount;
+
+    const size_t digit = log10(GetBufferSize()) + 1;
+    const std::ios::fmtflags f(os.flags());
+    for (size_t i = 0; i < numberOfSignals; ++i) {
+        const char prevFiller = os.fill('0');
+        os << std::setw(digit) << i << ": ";
+        os.flags(f);
+        os.fill(prevFiller);
+
+        const MappedSignalHeader * signal = GetSignalHeader(i);
+        const size_t n = GetNumberOfSamples(*signal);
+        const size_t valueSize = signal->GetValueSize();
+
+        // Latest sample stands for the signal object of HistoryBuffer
+        os << "Signal accessor \"" << signal->Name << "\": ";
+        if (n == 0) {
+            os << "(no sample), container: empty" << std::endl;
+            continue;
+        }
+        size_t row = (count - 1) % bufferSize;
+        PrintSample(os, *signal, Base + signal->ValueOffset + row * valueSize,
+                    Base[signal->ValidOffset + row] != 0, timestamps[row]);
+        os << ", container: ";
+
+        for (size_t k = count - n; k < count; ++k) {
+            row = k % bufferSize;
+            PrintSample(os, *signal, Base + signal->ValueOffset + row * valueSize,
+                        Base[signal->ValidOffset + row] != 0, timestamps[row]);
+            if (k + 1 != count)
+                os << ", ";
+        }
+        os << std::endl;
+    }
+}
+
+bool HistoryBufferMapped::FindSignal(const HistoryBufferMapped::BaseType::IDType & id) const
+{
+    return (GetSignalIndex(id) != HistoryBufferMapped::BaseType::INVALID_SIGNAL_INDEX);
+}
+
+HistoryBufferMapped::BaseType::IndexType HistoryBufferMapped::GetSignalIndex(const BaseType::IDType & id) const
+{
+    ColumnsMapType::const_iterator it = ColumnsMap.find(id);
+
+    if (it == ColumnsMap.end())
+        return HistoryBufferMapped::BaseType::INVALID_SIGNAL_INDEX;
+    else
+        return it->second;
+}
+
+void HistoryBufferMapped::Snapshot(void)
+{
+    if (!Base || ReadOnly)
+        return;
+
+    MappedFileHeader * header = GetFileHeader();
+    const size_t row = header->SnapshotCount % header->BufferSize;
+
+    GetTimestampColumn()[row] = GetCurrentTimestamp();
+
+    for (size_t i = 0; i < Columns.size(); ++i)
+        Columns[i]->Capture(Base, *GetSignalHeader(i), row);
+
+    // Commit snapshot only after all columns are written
+    boost::atomic_thread_fence(boost::memory_order_release);
+    ++header->SnapshotCount;
+}
@@ -0,0 +1,441 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include "safecass/reduction.h"
+
+// Instruction set is selected at compile time (see SAFECASS_ENABLE_AVX in
+// libs/CMakeLists.txt).  SSE2 is part of the x86-64 baseline.
+#if defined(__AVX__)
+  #include <immintrin.h>
+  #define SC_REDUCTION_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>
+  #define SC_REDUCTION_SSE2
+#endif
+
+using namespace SC;
+
+namespace {
+
+using Reduction::MaskWordType;
+using Reduction::MASK_WORD_BITS;
+
+//
+// Primitives on vectors of doubles.  Floats are converted to doubles on load,
+// so that the same kernels serve both types.  The scalar backend is a vector
+// of width one.
+//
+#if defined(SC_REDUCTION_AVX)
+
+typedef __m256d VectorType;
+const size_t WIDTH = 4;
+const char * BackendName = "AVX";
+
+inline VectorType Set1(double v)                          { return _mm256_set1_pd(v); }
+inline VectorType Load(const double * x)                  { return _mm256_loadu_pd(x); }
+inline VectorType Load(const float * x)                   { return _mm256_cvtps_pd(_mm_loadu_ps(x)); }
+inline VectorType Add(VectorType a, VectorType b)         { return _mm256_add_pd(a, b); }
+inline VectorType Sub(VectorType a, VectorType b)         { return _mm256_sub_pd(a, b); }
+inline VectorType Mul(VectorType a, VectorType b)         { return _mm256_mul_pd(a, b); }
+inline VectorType Min(VectorType a, VectorType b)         { return _mm256_min_pd(a, b); }
+inline VectorType Max(VectorType a, VectorType b)         { return _mm256_max_pd(a, b); }
+
+// Lanes of mask are all ones (valid) or all zeros (invalid)
+typedef __m256d MaskType;
+const boost::int64_t MaskTable[16][4] = {
+    {  0,  0,  0,  0 }, { -1,  0,  0,  0 }, {  0, -1,  0,  0 }, { -1, -1,  0,  0 },
+    {  0,  0, -1,  0 }, { -1,  0, -1,  0 }, {  0, -1, -1,  0 }, { -1, -1, -1,  0 },
+    {  0,  0,  0, -1 }, { -1,  0,  0, -1 }, {  0, -1,  0, -1 }, { -1, -1,  0, -1 },
+    {  0,  0, -1, -1 }, { -1,  0, -1, -1 }, {  0, -1, -1, -1 }, { -1, -1, -1, -1 }
+};
+inline MaskType LoadMask(unsigned int bits) {
+    return _mm256_castsi256_pd(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(MaskTable[bits])));
+}
+inline VectorType And(VectorType a, MaskType m)           { return _mm256_and_pd(a, m); }
+inline VectorType Select(MaskType m, VectorType a, VectorType b) { return _mm256_blendv_pd(b, a, m); }
+
+inline double HorizontalSum(VectorType v) {
+    __m128d x = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(x, _mm_unpackhi_pd(x, x)));
+}
+inline double HorizontalMin(VectorType v) {
+    __m128d x = _mm_min_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_min_sd(x, _mm_unpackhi_pd(x, x)));
+}
+inline double HorizontalMax(VectorType v) {
+    __m128d x = _mm_max_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_max_sd(x, _mm_unpackhi_pd(x, x)));
+}
+
+#elif defined(SC_REDUCTION_SSE2)
+
+typedef __m128d VectorType;
+const size_t WIDTH = 2;
+const char * BackendName = "SSE2";
+
+inline VectorType Set1(double v)                          { return _mm_set1_pd(v); }
+inline VectorType Load(const double * x)                  { return _mm_loadu_pd(x); }
+inline VectorType Load(const float * x) {
+    // Loads two floats (64 bits) and converts them to doubles
+    return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(x))));
+}
+inline VectorType Add(VectorType a, VectorType b)         { return _mm_add_pd(a, b); }
+inline VectorType Sub(VectorType a, VectorType b)         { return _mm_sub_pd(a, b); }
+inline VectorType Mul(VectorType a, VectorType b)         { return _mm_mul_pd(a, b); }
+inline VectorType Min(VectorType a, VectorType b)         { return _mm_min_pd(a, b); }
+inline VectorType Max(VectorType a, VectorType b)         { return _mm_max_pd(a, b); }
+
+// Lanes of mask are all ones (valid) or all zeros (invalid)
+typedef __m128d MaskType;
+const boost::int64_t MaskTable[4][2] = { { 0, 0 }, { -1, 0 }, { 0, -1 }, { -1, -1 } };
+inline MaskType LoadMask(unsigned int bits) {
+    return _mm_castsi128_pd(_mm_loadu_si128(reinterpret_cast<const __m128i *>(MaskTable[bits])));
+}
+inline VectorType And(VectorType a, MaskType m)           { return _mm_and_pd(a, m); }
+inline VectorType Select(MaskType m, VectorType a, VectorType b) {
+    return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b));
+}
+
+inline double HorizontalSum(VectorType v) { return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v))); }
+inline double HorizontalMin(VectorType v) { return _mm_cvtsd_f64(_mm_min_sd(v, _mm_unpackhi_pd(v, v))); }
+inline double HorizontalMax(VectorType v) { return _mm_cvtsd_f64(_mm_max_sd(v, _mm_unpackhi_pd(v, v))); }
+
+#else
+
+typedef double VectorType;
+const size_t WIDTH = 1;
+const char * BackendName = "scalar";
+
+inline VectorType Set1(double v)                          { return v; }
+inline VectorType Load(const double * x)                  { return *x; }
+inline VectorType Load(const float * x)                   { return static_cast<double>(*x); }
+inline VectorType Add(VectorType a, VectorType b)         { return a + b; }
+inline VectorType Sub(VectorType a, VectorType b)         { return a - b; }
+inline VectorType Mul(VectorType a, VectorType b)         { return a * b; }
+inline VectorType Min(VectorType a, VectorType b)         { return (b < a ? b : a); }
+inline VectorType Max(VectorType a, VectorType b)         { return (b > a ? b : a); }
+
+typedef bool MaskType;
+inline MaskType LoadMask(unsigned int bits)               { return (bits != 0); }
+inline VectorType And(VectorType a, MaskType m)           { return (m ? a : 0.0); }
+inline VectorType Select(MaskType m, VectorType a, VectorType b) { return (m ? a : b); }
+
+inline double HorizontalSum(VectorType v) { return v; }
+inline double HorizontalMin(VectorType v) { return v; }
+inline double HorizontalMax(VectorType v) { return v; }
+
+#endif
+
+//
+// Kernels.  Main loops use two accumulators to hide latency of additions;
+// remaining elements are processed by scalar code.
+//
+template <typename T>
+double SumKernel(const T * x, size_t n)
+{
+    VectorType a0 = Set1(0.0), a1 = Set1(0.0);
+    size_t i = 0;
+    for (; i + 2 * WIDTH <= n; i += 2 * WIDTH) {
+        a0 = Add(a0, Load(x + i));
+        a1 = Add(a1, Load(x + i + WIDTH));
+    }
+    if (i + WIDTH <= n) {
+        a0 = Add(a0, Load(x + i));
+        i += WIDTH;
+    }
+    double sum = HorizontalSum(Add(a0, a1));
+    for (; i < n; ++i)
+        sum += static_cast<double>(x[i]);
+    return sum;
+}
+
+template <typename T>
+double SumSquaredDeviationsKernel(const T * x, size_t n, double mean)
+{
+    const VectorType m = Set1(mean);
+    VectorType a0 = Set1(0.0), a1 = Set1(0.0);
+    size_t i = 0;
+    for (; i + 2 * WIDTH <= n; i += 2 * WIDTH) {
+        const VectorType d0 = Sub(Load(x + i), m);
+        const VectorType d1 = Sub(Load(x + i + WIDTH), m);
+        a0 = Add(a0, Mul(d0, d0));
+        a1 = Add(a1, Mul(d1, d1));
+    }
+    if (i + WIDTH <= n) {
+        const VectorType d0 = Sub(Load(x + i), m);
+        a0 = Add(a0, Mul(d0, d0));
+        i += WIDTH;
+    }
+    double sum = HorizontalSum(Add(a0, a1));
+    for (; i < n; ++i) {
+        const double d = static_cast<double>(x[i]) - mean;
+        sum += d * d;
+    }
+    return sum;
+}
+
+template <typename T>
+void MinMaxKernel(const T * x, size_t n, double & min, double & max)
+{
+    size_t i = 0;
+    if (n >= WIDTH) {
+        VectorType min0 = Set1(min), max0 = Set1(max), min1 = min0, max1 = max0;
+        for (; i + 2 * WIDTH <= n; i += 2 * WIDTH) {
+            const VectorType v0 = Load(x + i);
+            const VectorType v1 = Load(x + i + WIDTH);
+            min0 = Min(min0, v0);
+            max0 = Max(max0, v0);
+            min1 = Min(min1, v1);
+            max1 = Max(max1, v1);
+        }
+        if (i + WIDTH <= n) {
+            const VectorType v0 = Load(x + i);
+            min0 = Min(min0, v0);
+            max0 = Max(max0, v0);
+            i += WIDTH;
+        }
+        min = HorizontalMin(Min(min0, min1));
+        max = HorizontalMax(Max(max0, max1));
+    }
+    for (; i < n; ++i) {
+        const double v = static_cast<double>(x[i]);
+        if (v < min) min = v;
+        if (v > max) max = v;
+    }
+}
+
+//
+// Kernels over valid elements.  ForEachValid() walks [begin, end) and passes
+// elements to an operation: words of the mask whose elements are all valid
+// go through unmasked vector code with four accumulators, words without a
+// valid element are skipped, and the other words go through masked vector
+// code.  Elements before the first multiple of WIDTH and after the last one
+// are processed by scalar code, so that the bits of each vector are in one
+// word of the mask.
+//
+//! Returns bits of x[i..i + WIDTH) (i is a multiple of WIDTH)
+inline unsigned int GetBits(const MaskWordType * mask, size_t i)
+{
+    return (unsigned int) ((mask[i / MASK_WORD_BITS] >> (i % MASK_WORD_BITS)) & ((1u << WIDTH) - 1));
+}
+
+template <typename T, class _operation>
+void ForEachValid(const T * x, const MaskWordType * mask, size_t begin, size_t end, _operation & op)
+{
+    size_t i = begin;
+    for (; i < end && i % WIDTH != 0; ++i)
+        if (Reduction::IsValid(mask, i))
+            op.Scalar(static_cast<double>(x[i]));
+
+    while (i + WIDTH <= end) {
+        if (i % MASK_WORD_BITS == 0 && i + MASK_WORD_BITS <= end) {
+            const MaskWordType word = mask[i / MASK_WORD_BITS];
+            if (word == ~(MaskWordType) 0) {
+                for (const size_t wordEnd = i + MASK_WORD_BITS; i < wordEnd; i += 4 * WIDTH)
+                    op.Vectors(Load(x + i), Load(x + i + WIDTH), Load(x + i + 2 * WIDTH), Load(x + i + 3 * WIDTH));
+                continue;
+            }
+            if (word == 0) {
+                i += MASK_WORD_BITS;
+                continue;
+            }
+        }
+        op.Masked(Load(x + i), LoadMask(GetBits(mask, i)));
+        i += WIDTH;
+    }
+
+    for (; i < end; ++i)
+        if (Reduction::IsValid(mask, i))
+            op.Scalar(static_cast<double>(x[i]));
+}
+
+//! Sum of squared deviations from center (or sum if not squared)
+template <bool squared>
+struct SumOperation {
+    const VectorType Center;
+    const double ScalarCenter;
+    VectorType A0, A1, A2, A3;
+    double Sum;
+
+    SumOperation(double center)
+        : Center(Set1(center)), ScalarCenter(center),
+          A0(Set1(0.0)), A1(Set1(0.0)), A2(Set1(0.0)), A3(Set1(0.0)), Sum(0.0)
+    {}
+
+    inline VectorType Term(VectorType v) const {
+        const VectorType d = Sub(v, Center);
+        return (squared ? Mul(d, d) : d);
+    }
+    inline void Scalar(double v) {
+        const double d = v - ScalarCenter;
+        Sum += (squared ? d * d : d);
+    }
+    inline void Vectors(VectorType v0, VectorType v1, VectorType v2, VectorType v3) {
+        A0 = Add(A0, Term(v0));
+        A1 = Add(A1, Term(v1));
+        A2 = Add(A2, Term(v2));
+        A3 = Add(A3, Term(v3));
+    }
+    inline void Masked(VectorType v, MaskType m) {
+        // Invalid lanes are zeroed after subtraction of center
+        const VectorType d = And(Sub(v, Center), m);
+        A0 = Add(A0, (squared ? Mul(d, d) : d));
+    }
+    inline double GetResult(void) const {
+        return Sum + HorizontalSum(Add(Add(A0, A1), Add(A2, A3)));
+    }
+};
+
+//! Min and max
+struct MinMaxOperation {
+    VectorType Min0, Max0, Min1, Max1;
+    double ScalarMin, ScalarMax;
+
+    MinMaxOperation(double min, double max)
+        : Min0(Set1(min)), Max0(Set1(max)), Min1(Min0), Max1(Max0), ScalarMin(min), ScalarMax(max)
+    {}
+
+    inline void Scalar(double v) {
+        if (v < ScalarMin) ScalarMin = v;
+        if (v > ScalarMax) ScalarMax = v;
+    }
+    inline void Vectors(VectorType v0, VectorType v1, VectorType v2, VectorType v3) {
+        Min0 = Min(Min0, Min(v0, v2));
+        Max0 = Max(Max0, Max(v0, v2));
+        Min1 = Min(Min1, Min(v1, v3));
+        Max1 = Max(Max1, Max(v1, v3));
+    }
+    inline void Masked(VectorType v, MaskType m) {
+        // Invalid lanes are replaced with current min and max
+        Min0 = Min(Min0, Select(m, v, Min0));
+        Max0 = Max(Max0, Select(m, v, Max0));
+    }
+    inline void GetResult(double & min, double & max) const {
+        min = std::min(ScalarMin, HorizontalMin(Min(Min0, Min1)));
+        max = std::max(ScalarMax, HorizontalMax(Max(Max0, Max1)));
+    }
+};
+
+template <typename T>
+double SumValidKernel(const T * x, const MaskWordType * mask, size_t begin, size_t end)
+{
+    SumOperation<false> op(0.0);
+    ForEachValid(x, mask, begin, end, op);
+    return op.GetResult();
+}
+
+template <typename T>
+double SumSquaredDeviationsValidKernel(const T * x, const MaskWordType * mask, size_t begin, size_t end,
+                                       double mean)
+{
+    SumOperation<true> op(mean);
+    ForEachValid(x, mask, begin, end, op);
+    return op.GetResult();
+}
+
+template <typename T>
+void MinMaxValidKernel(const T * x, const MaskWordType * mask, size_t begin, size_t end,
+                       double & min, double & max)
+{
+    MinMaxOperation op(min, max);
+    ForEachValid(x, mask, begin, end, op);
+    op.GetResult(min, max);
+}
+
+//! Returns number of bits set in word
+inline size_t CountBits(MaskWordType w)
+{
+    w = w - ((w >> 1) & 0x5555555555555555ULL);
+    w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+    w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (size_t) ((w * 0x0101010101010101ULL) >> 56);
+}
+
+};
+
+namespace SC {
+namespace Reduction {
+
+template <> double Sum<double>(const double * x, size_t n) { return SumKernel(x, n); }
+template <> double Sum<float>(const float * x, size_t n)   { return SumKernel(x, n); }
+
+// Sum of squares is the sum of squared deviations from zero
+template <> double SumSquares<double>(const double * x, size_t n) { return SumSquaredDeviationsKernel(x, n, 0.0); }
+template <> double SumSquares<float>(const float * x, size_t n)   { return SumSquaredDeviationsKernel(x, n, 0.0); }
+
+template <> double SumSquaredDeviations<double>(const double * x, size_t n, double mean) {
+    return SumSquaredDeviationsKernel(x, n, mean);
+}
+template <> double SumSquaredDeviations<float>(const float * x, size_t n, double mean) {
+    return SumSquaredDeviationsKernel(x, n, mean);
+}
+
+template <> void MinMax<double>(const double * x, size_t n, double & min, double & max) {
+    MinMaxKernel(x, n, min, max);
+}
+template <> void MinMax<float>(const float * x, size_t n, double & min, double & max) {
+    MinMaxKernel(x, n, min, max);
+}
+
+template <> double SumValid<double>(const double * x, const MaskWordType * mask, size_t begin, size_t end) {
+    return SumValidKernel(x, mask, begin, end);
+}
+template <> double SumValid<float>(const float * x, const MaskWordType * mask, size_t begin, size_t end) {
+    return SumValidKernel(x, mask, begin, end);
+}
+
+template <> double SumSquaredDeviationsValid<double>(const double * x, const MaskWordType * mask,
+                                                     size_t begin, size_t end, double mean) {
+    return SumSquaredDeviationsValidKernel(x, mask, begin, end, mean);
+}
+template <> double SumSquaredDeviationsValid<float>(const float * x, const MaskWordType * mask,
+                                                    size_t begin, size_t end, double mean) {
+    return SumSquaredDeviationsValidKernel(x, mask, begin, end, mean);
+}
+
+template <> void MinMaxValid<double>(const double * x, const MaskWordType * mask,
+                                     size_t begin, size_t end, double & min, double & max) {
+    MinMaxValidKernel(x, mask, begin, end, min, max);
+}
+template <> void MinMaxValid<float>(const float * x, const MaskWordType * mask,
+                                    size_t begin, size_t end, double & min, double & max) {
+    MinMaxValidKernel(x, mask, begin, end, min, max);
+}
+
+size_t CountValid(const MaskWordType * mask, size_t begin, size_t end)
+{
+    if (begin >= end)
+        return 0;
+
+    // Bits below begin in the first word and at or above end in the last word
+    // are excluded
+    const size_t first = begin / MASK_WORD_BITS, last = (end - 1) / MASK_WORD_BITS;
+    const MaskWordType head = ~(MaskWordType) 0 << (begin % MASK_WORD_BITS);
+    const MaskWordType tail = ~(MaskWordType) 0 >> (MASK_WORD_BITS - 1 - (end - 1) % MASK_WORD_BITS);
+
+    if (first == last)
+        return CountBits(mask[first] & head & tail);
+
+    size_t count = CountBits(mask[first] & head) + CountBits(mask[last] & tail);
+    for (size_t w = first + 1; w < last; ++w)
+        count += CountBits(mask[w]);
+    return count;
+}
+
+const char * GetBackendName(void)
+{
+    return BackendName;
+}
+
+} // Reduction
+}; // SC
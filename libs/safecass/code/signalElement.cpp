@@ -7,7 +7,7 @@
 //-----------------------------------------------------------------------------------
 //
 // Created on   : Jan 7, 2012
-// Last revision: Mar 31, 2016
+// Last revision: Oct 17, 2026
 // Author       : Min Yang Jung <myj@jhu.edu>
 // Github       : https://github.com/safecass/safecass
 //
@@ -18,7 +18,10 @@ using namespace SC;
 
 SignalElement::SignalElement(void)
     : Name("UNNAMED"),
+      NameID(StringTable::GetInstance()->Intern(Name)),
       ParamPrototype(_ParamPrototypeDummy),
+      Source(0),
+      Injected(0),
       HistoryBufferInstance(0),
       SignalIndex(HistoryBufferBase::INVALID_SIGNAL_INDEX),
       TimeLastSampleFetched(0.0)
@@ -29,7 +32,10 @@ SignalElement::SignalElement(const std::string & signalName,
                              ParamBase & paramType,
                              HistoryBufferBase * historyBuffer)
     : Name(signalName),
+      NameID(StringTable::GetInstance()->Intern(signalName)),
       ParamPrototype(paramType),
+      Source(0),
+      Injected(0),
       HistoryBufferInstance(historyBuffer),
       SignalIndex(HistoryBufferBase::INVALID_SIGNAL_INDEX),
       TimeLastSampleFetched(0.0)
@@ -92,15 +98,18 @@ void SignalElement::ToStream(std::ostream & os) const
        << "history buffer: " << (HistoryBufferInstance == 0 ? "n/a" : "OK") << ", "
        << "signal index: " << SignalIndex << ", "
        << "last sample time: " << TimeLastSampleFetched << ", "
+       << "bound: " << (Source == 0 ? "no" : "yes") << ", "
        << "parameter prototype: " << ParamPrototype;
 }
 
-void SignalElement::PushNewValue(const ParamBase & paramType)
+bool SignalElement::PushNewValue(const ParamBase & paramType)
 {
-    //
-    // FIXME
-    //
-    std::cout << paramType << std::endl;
+    if (!HistoryBufferInstance || SignalIndex == HistoryBufferBase::INVALID_SIGNAL_INDEX) {
+        SCLOG_ERROR << "PushNewValue: history buffer is not set: \"" << Name << "\"" << std::endl;
+        return false;
+    }
+
+    return HistoryBufferInstance->PushNewValue(SignalIndex, paramType);
 }
 
 /*
@@ -0,0 +1,147 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#include "safecass/slidingWindow.h"
+
+using namespace SC;
+
+SlidingWindowStatistics::SampleType SlidingWindowStatistics::Prototype(void)
+{
+    SampleType sample;
+    sample.Value = 0.0;
+    sample.Timestamp = 0;
+    sample.Sequence = 0;
+    return sample;
+}
+
+// Each deque holds at most as many samples as the window
+SlidingWindowStatistics::SlidingWindowStatistics(size_t size)
+    : Type(WINDOW_COUNT), Duration(0),
+      Samples(size, Prototype()), MinDeque(size, Prototype()), MaxDeque(size, Prototype())
+{
+    SCASSERT(size > 0);
+    Reset();
+}
+
+SlidingWindowStatistics::SlidingWindowStatistics(TimestampType duration, size_t maxSize)
+    : Type(WINDOW_TIME), Duration(duration),
+      Samples(maxSize, Prototype()), MinDeque(maxSize, Prototype()), MaxDeque(maxSize, Prototype())
+{
+    SCASSERT(maxSize > 0);
+    Reset();
+}
+
+void SlidingWindowStatistics::Reset(void)
+{
+    Samples.Clear();
+    MinDeque.Clear();
+    MaxDeque.Clear();
+    Sequence = 0;
+    Mean = M2 = 0.0;
+    Removals = 0;
+}
+
+void SlidingWindowStatistics::PopOldest(void)
+{
+    const SampleType & oldest = Samples.Front();
+
+    if (MinDeque.Front().Sequence == oldest.Sequence)
+        MinDeque.PopFront();
+    if (MaxDeque.Front().Sequence == oldest.Sequence)
+        MaxDeque.PopFront();
+
+    // Welford's update in reverse
+    const size_t n = Samples.GetSize() - 1;
+    if (n == 0) {
+        Mean = M2 = 0.0;
+    } else {
+        const double delta = oldest.Value - Mean;
+        Mean -= delta / n;
+        M2 -= delta * (oldest.Value - Mean);
+    }
+
+    Samples.PopFront();
+    ++Removals;
+}
+
+void SlidingWindowStatistics::Recompute(void)
+{
+    const size_t n = Samples.GetSize();
+
+    double sum = 0.0;
+    for (size_t i = 0; i < n; ++i)
+        sum += Samples[i].Value;
+    Mean = (n ? sum / n : 0.0);
+
+    M2 = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        const double delta = Samples[i].Value - Mean;
+        M2 += delta * delta;
+    }
+
+    Removals = 0;
+}
+
+void SlidingWindowStatistics::Push(double value, TimestampType timestamp)
+{
+    if (Type == WINDOW_TIME) {
+        while (!Samples.IsEmpty() && Samples.Front().Timestamp <= timestamp - Duration)
+            PopOldest();
+    }
+    if (Samples.IsFull())
+        PopOldest();
+
+    SampleType sample;
+    sample.Value = value;
+    sample.Timestamp = timestamp;
+    sample.Sequence = Sequence++;
+    Samples.PushBack(sample);
+
+    // Samples that the new sample outlives can never be the minimum (maximum)
+    while (!MinDeque.IsEmpty() && MinDeque.Back().Value >= value)
+        MinDeque.PopBack();
+    MinDeque.PushBack(sample);
+    while (!MaxDeque.IsEmpty() && MaxDeque.Back().Value <= value)
+        MaxDeque.PopBack();
+    MaxDeque.PushBack(sample);
+
+    // Welford's update
+    const double delta = value - Mean;
+    Mean += delta / Samples.GetSize();
+    M2 += delta * (value - Mean);
+
+    // Bound rounding error of removals (amortized O(1) per sample)
+    if (Removals >= Samples.GetCapacity())
+        Recompute();
+}
+
+double SlidingWindowStatistics::GetVariance(void) const
+{
+    if (Samples.IsEmpty())
+        return 0.0;
+
+    // Removal of samples may leave small negative rounding error
+    const double variance = M2 / Samples.GetSize();
+    return (variance > 0.0 ? variance : 0.0);
+}
+
+void SlidingWindowStatistics::ToStream(std::ostream & os) const
+{
+    os << "window: ";
+    if (Type == WINDOW_COUNT)
+        os << Samples.GetCapacity() << " samples";
+    else
+        os << Duration / 1e6 << " ms (max " << Samples.GetCapacity() << " samples)";
+    os << ", samples: " << Samples.GetSize()
+       << ", mean: " << GetMean() << ", variance: " << GetVariance()
+       << ", min: " << GetMin() << ", max: " << GetMax();
+}
@@ -0,0 +1,246 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _CompressedSignalAccessor_h
+#define _CompressedSignalAccessor_h
+
+#include "safecass/signalAccessor.h"
+#include "safecass/compression.h"
+
+namespace SC {
+
+//! Signal accessor that keeps samples compressed (see compression.h)
+/*!
+    Stores history of ParamEigen<_type> signals in a CompressedColumn, where
+    _type is an integral type, float, or double.  Samples are decompressed on
+    read.  Because samples do not exist as ParamEigen objects, windows,
+    reductions, and signal handles are not available; samples are read by
+    GetSample(), GetSamples(), or GetValues().
+
+    Type descriptor and serialization format are the same as those of
+    SignalAccessor, and thus history can be exported from a compressed signal
+    and imported into an uncompressed one, and vice versa.
+
+    Reads must be done by the thread that takes snapshots (see CompressedColumn).
+*/
+template <typename _type>
+class CompressedSignalAccessor: public SignalAccessorBase
+{
+public:
+    typedef ParamEigen<_type>         ValueType;
+    typedef _type                     DataType;
+    typedef CompressedColumn<_type>   ColumnType;
+
+protected:
+    //! Typed reference to original object (resolved once at construction)
+    const ValueType & TypedSignalObject;
+
+    //! Compressed samples
+    ColumnType Column;
+
+    static const ValueType & CastSignalObject(const ParamBase & object) {
+        const ValueType * param = dynamic_cast<const ValueType *>(&object);
+        SCASSERT(param);
+        return *param;
+    }
+
+    inline void PushSample(const ValueType & sample) {
+        Column.Push(sample.Val, sample.GetTimestamp(), sample.IsValid());
+    }
+
+public:
+    //! Constructor
+    CompressedSignalAccessor(const ParamBase & object, const std::string & name, size_t size)
+        : SignalAccessorBase(object, name), TypedSignalObject(CastSignalObject(object)), Column(size)
+    {}
+
+    //! Push current value of the signal object (non-virtual; see SignalAccessorGroup)
+    inline void PushTyped(void) {
+        PushSample(TypedSignalObject);
+    }
+
+    virtual void Push(void) {
+        PushTyped();
+    }
+
+    //! Copies latest sample to arg (arg becomes invalid if no sample is available)
+    virtual void GetValue(ParamBase & arg) const {
+        ValueType * pArg = dynamic_cast<ValueType *>(&arg);
+        SCASSERT(pArg);
+        if (!GetSample(Column.GetSize() - 1, *pArg))
+            arg.SetValid(false);
+    }
+
+    //
+    // Reads (samples are decompressed)
+    //
+    //! Copies i-th sample (0: oldest), including its validity and timestamp
+    inline bool GetSample(size_t i, ValueType & sample) const {
+        _type value;
+        SC::TimestampType timestamp;
+        bool valid;
+        if (!Column.Get(i, value, timestamp, valid))
+            return false;
+        sample.Val = value;
+        sample.SetTimestamp(timestamp);
+        sample.SetValid(valid);
+        return true;
+    }
+
+    //! Copies i-th sample (0: oldest) in packed form (see PackedParam)
+    inline bool GetPacked(size_t i, PackedParam<_type> & packed) const {
+        _type value;
+        SC::TimestampType timestamp;
+        bool valid;
+        if (!Column.Get(i, value, timestamp, valid))
+            return false;
+        packed.Set(value, timestamp, valid);
+        return true;
+    }
+
+    //! Copies consecutive samples (0: oldest)
+    /*!
+        \return false if the range specified is out of bound
+    */
+    bool GetSamples(size_t begin, size_t count, std::vector<ValueType> & samples) const {
+        std::vector<_type> values(count);
+        std::vector<SC::TimestampType> timestamps(count);
+        bool * valid = new bool[count];
+        const bool ret = Column.Read(begin, count, (count ? &values[0] : 0), (count ? &timestamps[0] : 0), valid);
+        if (ret) {
+            samples.resize(count, TypedSignalObject);
+            for (size_t i = 0; i < count; ++i) {
+                samples[i].Val = values[i];
+                samples[i].SetTimestamp(timestamps[i]);
+                samples[i].SetValid(valid[i]);
+            }
+        }
+        delete [] valid;
+        return ret;
+    }
+
+    //! Copies values of consecutive samples (0: oldest)
+    bool GetValues(size_t begin, size_t count, std::vector<_type> & values) const {
+        values.resize(count);
+        return Column.Read(begin, count, (count ? &values[0] : 0), 0, 0);
+    }
+
+    //! Returns ratio of uncompressed size to compressed size (see CompressedColumn)
+    virtual double GetCompressionRatio(void) const { return Column.GetCompressionRatio(); }
+
+    //! Returns compressed column
+    inline const ColumnType & GetColumn(void) const { return Column; }
+
+    virtual bool SetValue(size_t i, const ParamBase & arg) {
+        const ValueType * value = dynamic_cast<const ValueType *>(&arg);
+        if (!value)
+            return false;
+        return Column.Set(i, value->Val, value->GetTimestamp(), value->IsValid());
+    }
+
+    //
+    // Depth of history
+    //
+    virtual size_t GetCapacity(void) const { return Column.GetCapacity(); }
+
+    virtual bool SetCapacity(size_t capacity) {
+        if (capacity == 0)
+            return false;
+        Column.SetCapacity(capacity);
+        return true;
+    }
+
+    virtual size_t GetMemoryUsage(void) const {
+        return sizeof(*this) - sizeof(ColumnType) + Column.GetMemoryUsage();
+    }
+
+    //
+    // Export and import of samples (same format as SignalAccessor)
+    //
+    virtual size_t GetNumberOfSamples(void) const { return Column.GetSize(); }
+
+    virtual std::string GetTypeDescriptor(void) const { return SC::GetTypeDescriptor(TypedSignalObject); }
+
+    virtual void Clear(void) {
+        Column.Clear();
+    }
+
+    virtual bool WriteBinary(std::string & buffer) const {
+        std::vector<ValueType> samples;
+        GetSamples(0, Column.GetSize(), samples);
+
+        const size_t n = samples.size();
+        ParamCodecDetail::AppendRaw(buffer, (boost::uint32_t) n);
+        for (size_t i = 0; i < n; ++i)
+            ParamCodecDetail::AppendRaw(buffer, (boost::int64_t) samples[i].GetTimestamp());
+        for (size_t i = 0; i < n; ++i)
+            buffer += (char) (samples[i].IsValid() ? 1 : 0);
+        for (size_t i = 0; i < n; ++i)
+            EncodeBinary(samples[i], buffer);
+        return true;
+    }
+
+    virtual bool ReadBinary(const char *& p, const char * end) {
+        Clear();
+
+        boost::uint32_t n;
+        if (!ParamCodecDetail::ReadRaw(p, end, n))
+            return false;
+        if ((size_t)(end - p) < n * (sizeof(boost::int64_t) + 1))
+            return false;
+        const char * timestamps = p;
+        const char * valid = p + n * sizeof(boost::int64_t);
+        p = valid + n;
+
+        ValueType sample(TypedSignalObject);
+        boost::int64_t timestamp;
+        for (boost::uint32_t i = 0; i < n; ++i) {
+            if (!DecodeBinary(p, end, sample))
+                return false;
+            memcpy(&timestamp, timestamps + i * sizeof(boost::int64_t), sizeof(timestamp));
+            sample.SetTimestamp(timestamp);
+            sample.SetValid(valid[i] != 0);
+            PushSample(sample);
+        }
+        return true;
+    }
+
+    virtual bool WriteText(size_t i, std::string & buffer, bool & valid, SC::TimestampType & timestamp) const {
+        ValueType sample(TypedSignalObject);
+        if (!GetSample(i, sample))
+            return false;
+        EncodeText(sample, buffer);
+        valid = sample.IsValid();
+        timestamp = sample.GetTimestamp();
+        return true;
+    }
+
+    virtual bool PushText(const char * begin, const char * end, bool valid, SC::TimestampType timestamp) {
+        ValueType sample(TypedSignalObject);
+        if (!DecodeText(begin, end, sample))
+            return false;
+        sample.SetTimestamp(timestamp);
+        sample.SetValid(valid);
+        PushSample(sample);
+        return true;
+    }
+
+    virtual void ToStream(std::ostream & os) const {
+        os << "Compressed signal accessor \"" << this->GetSignalName() << "\": " << SignalObject
+           << ", container: " << Column.GetSize() << " samples, compression ratio: "
+           << Column.GetCompressionRatio();
+    }
+};
+
+};
+
+#endif // _CompressedSignalAccessor_h
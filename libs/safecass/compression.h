@@ -0,0 +1,452 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+/*!
+    This file implements lossless compression of signal history, which
+    CompressedSignalAccessor uses to keep long histories of slowly varying
+    signals in little memory (see HistoryBuffer::AddCompressedSignal()).
+
+    Samples are compressed in blocks of Compression::BLOCK_SIZE samples:
+
+    - Timestamps: delta-of-delta, zigzag, and bit-packing.  Snapshots are taken
+      periodically, and thus delta-of-deltas are close to zero.
+    - Validity: one bit per sample.
+    - Integers: delta, zigzag, and bit-packing.  All deltas in a block are
+      packed with the width of the largest delta.
+    - Floating-point numbers: XOR with the previous value (Gorilla encoding;
+      Pelkonen et al., VLDB 2015).  Values that do not change cost one bit.
+
+    CompressedColumn keeps the latest block uncompressed (open block) and
+    compresses it once it is full (sealed block).  Reads of samples in sealed
+    blocks decompress the whole block into the stack of the caller.  Pushes
+    release and reuse memory of blocks in place, and thus a column is not
+    thread-safe: reads must not run concurrently with pushes, e.g., during
+    HistoryBuffer::Snapshot() (see HistoryBufferConcurrent for external
+    filtering).
+*/
+
+#ifndef _Compression_h
+#define _Compression_h
+
+#include <deque>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include "common/common.h"
+#include "common/utils.h"
+
+namespace SC {
+
+namespace Compression {
+
+    //! Number of samples per block
+    enum { BLOCK_SIZE = 128 };
+
+    //! Words of compressed block
+    typedef std::vector<boost::uint64_t> WordsType;
+
+    //! Writer of bit stream
+    class BitWriter
+    {
+    protected:
+        WordsType & Words;
+        size_t BitCount;
+
+    public:
+        //! Constructor (words are cleared but keep their capacity)
+        BitWriter(WordsType & words): Words(words), BitCount(0) { Words.clear(); }
+
+        //! Appends lower bits of value (upper bits must be zero)
+        /*!
+            \param bits Number of bits to write (0 to 64)
+        */
+        inline void Write(boost::uint64_t value, unsigned int bits) {
+            if (bits == 0)
+                return;
+            const unsigned int offset = (unsigned int) (BitCount & 63);
+            if (offset == 0)
+                Words.push_back(0);
+            Words.back() |= (value << offset);
+            if (offset + bits > 64)
+                Words.push_back(value >> (64 - offset));
+            BitCount += bits;
+        }
+
+        inline void WriteBit(bool bit) { Write(bit ? 1 : 0, 1); }
+
+        inline size_t GetBitCount(void) const { return BitCount; }
+    };
+
+    //! Reader of bit stream written by BitWriter
+    class BitReader
+    {
+    protected:
+        const boost::uint64_t * Words;
+        size_t Position;
+
+    public:
+        BitReader(const WordsType & words): Words(words.empty() ? 0 : &words[0]), Position(0) {}
+
+        //! Reads bits (0 to 64)
+        inline boost::uint64_t Read(unsigned int bits) {
+            if (bits == 0)
+                return 0;
+            const size_t word = Position >> 6;
+            const unsigned int offset = (unsigned int) (Position & 63);
+            boost::uint64_t value = Words[word] >> offset;
+            if (offset + bits > 64)
+                value |= (Words[word + 1] << (64 - offset));
+            Position += bits;
+            return (bits == 64 ? value : value & ((((boost::uint64_t) 1) << bits) - 1));
+        }
+
+        inline bool ReadBit(void) { return (Read(1) != 0); }
+    };
+
+    //! Maps signed integers to unsigned integers so that small magnitudes have few bits
+    inline boost::uint64_t ZigZagEncode(boost::uint64_t x) {
+        return (x << 1) ^ (((boost::uint64_t) 0) - (x >> 63));
+    }
+    inline boost::uint64_t ZigZagDecode(boost::uint64_t z) {
+        return (z >> 1) ^ (((boost::uint64_t) 0) - (z & 1));
+    }
+
+    //
+    // Codecs of arrays (n must not exceed BLOCK_SIZE)
+    //
+    //! Delta, zigzag, and bit-packing
+    SCLIB_EXPORT void EncodeIntegers(const boost::int64_t * x, size_t n, BitWriter & writer);
+    SCLIB_EXPORT void DecodeIntegers(BitReader & reader, size_t n, boost::int64_t * x);
+
+    //! Delta-of-delta, zigzag, and bit-packing
+    SCLIB_EXPORT void EncodeTimestamps(const SC::TimestampType * t, size_t n, BitWriter & writer);
+    SCLIB_EXPORT void DecodeTimestamps(BitReader & reader, size_t n, SC::TimestampType * t);
+
+    //! XOR with previous value (bits of floating-point numbers of width 32 or 64)
+    SCLIB_EXPORT void EncodeFloats(const boost::uint64_t * x, size_t n, unsigned int width, BitWriter & writer);
+    SCLIB_EXPORT void DecodeFloats(BitReader & reader, size_t n, unsigned int width, boost::uint64_t * x);
+
+    //! Selects codec by type of value (integers)
+    template <typename T, bool integral = boost::is_integral<T>::value>
+    struct ValueCodec
+    {
+        BOOST_STATIC_ASSERT((!boost::is_same<T, bool>::value));
+
+        static void Encode(const T * x, size_t n, BitWriter & writer) {
+            boost::int64_t values[BLOCK_SIZE];
+            for (size_t i = 0; i < n; ++i)
+                values[i] = static_cast<boost::int64_t>(x[i]);
+            EncodeIntegers(values, n, writer);
+        }
+        static void Decode(BitReader & reader, size_t n, T * x) {
+            boost::int64_t values[BLOCK_SIZE];
+            DecodeIntegers(reader, n, values);
+            for (size_t i = 0; i < n; ++i)
+                x[i] = static_cast<T>(values[i]);
+        }
+    };
+
+    //! Selects codec by type of value (floating-point numbers)
+    template <typename T>
+    struct ValueCodec<T, false>
+    {
+        BOOST_STATIC_ASSERT((boost::is_same<T, float>::value || boost::is_same<T, double>::value));
+
+        static void Encode(const T * x, size_t n, BitWriter & writer) {
+            boost::uint64_t bits[BLOCK_SIZE];
+            for (size_t i = 0; i < n; ++i)
+                bits[i] = ToBits(x[i]);
+            EncodeFloats(bits, n, 8 * sizeof(T), writer);
+        }
+        static void Decode(BitReader & reader, size_t n, T * x) {
+            boost::uint64_t bits[BLOCK_SIZE];
+            DecodeFloats(reader, n, 8 * sizeof(T), bits);
+            for (size_t i = 0; i < n; ++i)
+                x[i] = FromBits(bits[i]);
+        }
+
+    protected:
+        static inline boost::uint64_t ToBits(float x) {
+            boost::uint32_t bits;
+            memcpy(&bits, &x, sizeof(bits));
+            return bits;
+        }
+        static inline boost::uint64_t ToBits(double x) {
+            boost::uint64_t bits;
+            memcpy(&bits, &x, sizeof(bits));
+            return bits;
+        }
+        static inline T FromBits(boost::uint64_t bits) {
+            T x;
+            if (sizeof(T) == sizeof(boost::uint32_t)) {
+                const boost::uint32_t bits32 = (boost::uint32_t) bits;
+                memcpy(&x, &bits32, sizeof(x));
+            } else
+                memcpy(&x, &bits, sizeof(x));
+            return x;
+        }
+    };
+
+};
+
+//! Compressed history of samples of numeric type
+/*!
+    Works like a ring buffer of (value, timestamp, validity): once capacity is
+    reached, each push removes the oldest sample.  Memory of removed samples is
+    released block by block, and thus up to BLOCK_SIZE - 1 removed samples may
+    remain in memory.
+
+    Only integral types (except bool), float, and double are supported.
+
+    Not thread-safe: Push(), Set(), Clear(), and SetCapacity() may release a
+    block or compress another block into its memory while Get() or Read()
+    decodes it.  All methods must be called by the same thread.
+*/
+template <typename T>
+class CompressedColumn
+{
+public:
+    typedef T ValueType;
+    typedef Compression::WordsType BlockType;
+
+    enum { BLOCK_SIZE = Compression::BLOCK_SIZE };
+
+protected:
+    typedef Compression::ValueCodec<T> CodecType;
+    typedef std::deque<BlockType> BlocksType;
+
+    //! Max number of samples
+    size_t Capacity;
+    //! Sealed (compressed) blocks, oldest first
+    BlocksType Blocks;
+    //! Memory of the block released most recently, reused by the next sealed block
+    BlockType Spare;
+
+    //! Open (uncompressed) block, which follows sealed blocks
+    T OpenValues[BLOCK_SIZE];
+    SC::TimestampType OpenTimestamps[BLOCK_SIZE];
+    bool OpenValid[BLOCK_SIZE];
+    size_t OpenSize;
+
+    //! Number of removed samples in the oldest block
+    size_t Skip;
+
+    //! Compresses samples into block
+    static void EncodeBlock(const T * values, const SC::TimestampType * timestamps, const bool * valid,
+                            BlockType & block)
+    {
+        Compression::BitWriter writer(block);
+        Compression::EncodeTimestamps(timestamps, BLOCK_SIZE, writer);
+        for (size_t i = 0; i < BLOCK_SIZE; ++i)
+            writer.WriteBit(valid[i]);
+        CodecType::Encode(values, BLOCK_SIZE, writer);
+    }
+
+    //! Decompresses block (timestamps and valid may be 0)
+    static void DecodeBlock(const BlockType & block, T * values, SC::TimestampType * timestamps, bool * valid)
+    {
+        SC::TimestampType t[BLOCK_SIZE];
+        Compression::BitReader reader(block);
+        Compression::DecodeTimestamps(reader, BLOCK_SIZE, (timestamps ? timestamps : t));
+        for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+            const bool bit = reader.ReadBit();
+            if (valid)
+                valid[i] = bit;
+        }
+        CodecType::Decode(reader, BLOCK_SIZE, values);
+    }
+
+    //! Compresses open block and appends it to sealed blocks
+    void Seal(void) {
+        EncodeBlock(OpenValues, OpenTimestamps, OpenValid, Spare);
+        Blocks.push_back(BlockType());
+        Blocks.back().swap(Spare);
+        OpenSize = 0;
+    }
+
+    //! Removes oldest samples until size does not exceed capacity
+    void Evict(void) {
+        while (GetSize() > Capacity) {
+            if (++Skip == BLOCK_SIZE) {
+                Spare.swap(Blocks.front());
+                Blocks.pop_front();
+                Skip = 0;
+            }
+        }
+    }
+
+public:
+    CompressedColumn(size_t capacity): Capacity(capacity), OpenSize(0), Skip(0) {}
+
+    //! Appends sample
+    void Push(const T & value, SC::TimestampType timestamp, bool valid) {
+        OpenValues[OpenSize] = value;
+        OpenTimestamps[OpenSize] = timestamp;
+        OpenValid[OpenSize] = valid;
+        if (++OpenSize == BLOCK_SIZE)
+            Seal();
+        Evict();
+    }
+
+    //! Copies i-th sample (0: oldest)
+    bool Get(size_t i, T & value, SC::TimestampType & timestamp, bool & valid) const {
+        if (i >= GetSize())
+            return false;
+        const size_t j = Skip + i;
+        const size_t block = j / BLOCK_SIZE;
+        const size_t offset = j % BLOCK_SIZE;
+        if (block == Blocks.size()) {
+            value = OpenValues[offset];
+            timestamp = OpenTimestamps[offset];
+            valid = OpenValid[offset];
+        } else {
+            T values[BLOCK_SIZE];
+            SC::TimestampType timestamps[BLOCK_SIZE];
+            bool flags[BLOCK_SIZE];
+            DecodeBlock(Blocks[block], values, timestamps, flags);
+            value = values[offset];
+            timestamp = timestamps[offset];
+            valid = flags[offset];
+        }
+        return true;
+    }
+
+    //! Copies consecutive samples (0: oldest); timestamps and valid may be 0
+    /*!
+        Each block is decompressed once.
+        \return false if the range specified is out of bound
+    */
+    bool Read(size_t begin, size_t count, T * values, SC::TimestampType * timestamps, bool * valid) const {
+        if (begin > GetSize() || count > GetSize() - begin)
+            return false;
+
+        T blockValues[BLOCK_SIZE];
+        SC::TimestampType blockTimestamps[BLOCK_SIZE];
+        bool blockValid[BLOCK_SIZE];
+
+        size_t j = Skip + begin;
+        const size_t jEnd = j + count;
+        while (j < jEnd) {
+            const size_t block = j / BLOCK_SIZE;
+            const size_t offset = j % BLOCK_SIZE;
+            const size_t n = std::min(jEnd - j, (size_t) BLOCK_SIZE - offset);
+            const T * srcValues;
+            const SC::TimestampType * srcTimestamps;
+            const bool * srcValid;
+            if (block == Blocks.size()) {
+                srcValues = OpenValues;
+                srcTimestamps = OpenTimestamps;
+                srcValid = OpenValid;
+            } else {
+                DecodeBlock(Blocks[block], blockValues, (timestamps ? blockTimestamps : 0),
+                            (valid ? blockValid : 0));
+                srcValues = blockValues;
+                srcTimestamps = blockTimestamps;
+                srcValid = blockValid;
+            }
+            std::copy(srcValues + offset, srcValues + offset + n, values);
+            values += n;
+            if (timestamps) {
+                std::copy(srcTimestamps + offset, srcTimestamps + offset + n, timestamps);
+                timestamps += n;
+            }
+            if (valid) {
+                std::copy(srcValid + offset, srcValid + offset + n, valid);
+                valid += n;
+            }
+            j += n;
+        }
+        return true;
+    }
+
+    //! Replaces i-th sample (0: oldest); the block of the sample is compressed again
+    bool Set(size_t i, const T & value, SC::TimestampType timestamp, bool valid) {
+        if (i >= GetSize())
+            return false;
+        const size_t j = Skip + i;
+        const size_t block = j / BLOCK_SIZE;
+        const size_t offset = j % BLOCK_SIZE;
+        if (block == Blocks.size()) {
+            OpenValues[offset] = value;
+            OpenTimestamps[offset] = timestamp;
+            OpenValid[offset] = valid;
+        } else {
+            T values[BLOCK_SIZE];
+            SC::TimestampType timestamps[BLOCK_SIZE];
+            bool flags[BLOCK_SIZE];
+            DecodeBlock(Blocks[block], values, timestamps, flags);
+            values[offset] = value;
+            timestamps[offset] = timestamp;
+            flags[offset] = valid;
+            EncodeBlock(values, timestamps, flags, Spare);
+            Blocks[block].swap(Spare);
+        }
+        return true;
+    }
+
+    //! Removes all samples (memory of one block is kept)
+    void Clear(void) {
+        if (!Blocks.empty())
+            Spare.swap(Blocks.back());
+        Blocks.clear();
+        OpenSize = 0;
+        Skip = 0;
+    }
+
+    //! Changes max number of samples, keeping the latest samples
+    void SetCapacity(size_t capacity) {
+        Capacity = capacity;
+        Evict();
+    }
+
+    inline size_t GetCapacity(void) const { return Capacity; }
+    inline size_t GetSize(void) const { return Blocks.size() * BLOCK_SIZE + OpenSize - Skip; }
+
+    //! Returns bytes of samples kept in memory, including removed ones not released yet
+    size_t GetEncodedSize(void) const {
+        size_t bytes = OpenSize * (sizeof(T) + sizeof(SC::TimestampType) + sizeof(bool));
+        for (size_t i = 0; i < Blocks.size(); ++i)
+            bytes += Blocks[i].size() * sizeof(boost::uint64_t);
+        return bytes;
+    }
+
+    //! Returns ratio of uncompressed size to compressed size of samples
+    /*!
+        Uncompressed size of sample is the size of value, timestamp, and
+        validity.  Returns 1 if there is no sample.
+    */
+    double GetCompressionRatio(void) const {
+        const size_t encoded = GetEncodedSize();
+        if (encoded == 0)
+            return 1.0;
+        const size_t samples = Blocks.size() * BLOCK_SIZE + OpenSize;
+        return (double) (samples * (sizeof(T) + sizeof(SC::TimestampType) + sizeof(bool))) / encoded;
+    }
+
+    //! Returns memory usage in bytes
+    size_t GetMemoryUsage(void) const {
+        size_t bytes = sizeof(*this) + Spare.capacity() * sizeof(boost::uint64_t);
+        for (size_t i = 0; i < Blocks.size(); ++i)
+            bytes += sizeof(BlockType) + Blocks[i].capacity() * sizeof(boost::uint64_t);
+        return bytes;
+    }
+};
+
+};
+
+#endif // _Compression_h
@@ -0,0 +1,62 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _FilterAverage_h
+#define _FilterAverage_h
+
+#include "safecass/filterSlidingWindow.h"
+
+namespace SC {
+
+/*!
+    Running mean and variance of scalar signal over sliding window
+
+        Output Y0 = mean of samples in window
+               Y1 = population variance of samples in window
+
+    See FilterSlidingWindow for arguments.
+*/
+class SCLIB_EXPORT FilterAverage: public FilterSlidingWindow
+{
+protected:
+    // Filter should be instantiated with explicit arguments
+    FilterAverage(void);
+
+    void Initialize(void);
+
+    //! Mean of samples in window
+    ParamType Mean;
+    //! Variance of samples in window
+    ParamType Variance;
+
+    void UpdateOutputs(void);
+
+public:
+    //! Constructor with explicit arguments (time-based window if windowDuration is positive)
+    FilterAverage(FilteringType            filteringType,
+                  const StateMachineInfo & stateMachineInfo,
+                  const std::string &      inputSignalName,
+                  size_t                   windowSize,
+                  TimestampType            windowDuration = 0);
+    //! Constructor using JSON
+    FilterAverage(const Json::Value & jsonNode);
+
+    inline const ParamType & GetMean(void) const { return Mean; }
+    inline const ParamType & GetVariance(void) const { return Variance; }
+
+    //! For filter factory
+    SC_DEFINE_FACTORY_CREATE(FilterAverage);
+};
+
+};
+
+#endif // _FilterAverage_h
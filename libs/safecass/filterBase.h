@@ -7,7 +7,7 @@
 //-----------------------------------------------------------------------------------
 //
 // Created on   : Jan 7, 2012
-// Last revision: Apr 28, 2016
+// Last revision: Oct 17, 2026
 // Author       : Min Yang Jung <myj@jhu.edu>
 // Github       : https://github.com/safecass/safecass
 //
@@ -23,7 +23,10 @@
 #include "safecass/state.h"
 #include "safecass/signalElement.h"
 #include "safecass/event.h"
+#include "safecass/filterEvent.h"
+#include "safecass/filterEventGate.h"
 #include "safecass/eventLocationBase.h"
+#include "safecass/filterExecutionStatistics.h"
 
 namespace SC {
 
@@ -31,6 +34,38 @@ class EventPublisherBase;
 
 class Coordinator;
 
+class FilterBase;
+
+//! Receiver of events that filters detect
+/*!
+    Filters deliver events via FilterBase::EmitEvent() to the event sink set
+    by FilterBase::SetEventSink(), e.g., FilterScheduler.  Coordinator does
+    not implement this interface yet; it receives events via
+    Coordinator::OnEvent().
+*/
+class SCLIB_EXPORT FilterEventSink
+{
+public:
+    virtual ~FilterEventSink() {}
+
+    //! Called when filter detects event
+    /*!
+        \param timestamp Timestamp of event (e.g., timestamp of input sample)
+        \param event JSON-encoded event information (see GenerateEventInfo())
+    */
+    virtual void OnFilterEvent(const FilterBase * filter, TimestampType timestamp, const std::string & event) = 0;
+
+    //! Called when filter detects event (typed)
+    /*!
+        Sinks that handle events without JSON override this method.  By
+        default, the event is serialized and passed to the method above.
+        Coordinator does not take typed events yet and receives them in JSON.
+    */
+    virtual void OnFilterEvent(const FilterBase * filter, const FilterEvent & event) {
+        OnFilterEvent(filter, event.Timestamp, event.ToJsonString());
+    }
+};
+
 class SCLIB_EXPORT FilterBase
 {
 public:
@@ -128,12 +163,18 @@ public:
         STATE_DETECTED  /*!< Enabled, outstanding event exists, no new event can be detected */
     } FilterStateType;
 
+    //! Value injected to input signal
+    typedef struct {
+        SignalElement * Signal;
+        ParamBase *     Value;  // owned by filter
+    } InjectionType;
+
     //! Typedef of queue for shallow fault injection
     /*!
         See comments in HistoryBuffer::PushNewValue()
         \sa HistoryBuffer::PushNewValue()
     */
-    typedef std::queue<ParamBase*> InjectionQueueType;
+    typedef std::queue<InjectionType> InjectionQueueType;
 #if 0
     template<typename _type>
     BaseType::IndexType AddSignal(const ParamEigen<_type> & arg, const BaseType::IDType & name)
@@ -196,10 +237,47 @@ protected:
 
     //! Queue for shallow fault injection
     InjectionQueueType InjectionQueue;
+    //! Value injected for the current run (Signal is 0 if none)
+    InjectionType Injection;
 
     //! Pointer to Safety Coordinator instance
     Coordinator * SafetyCoordinator;
 
+    //! Receiver of events that this filter detects (0 if not set)
+    FilterEventSink * EventSink;
+
+    //! Execution-time histogram and overrun counters (updated by filter executor)
+    FilterExecutionStatistics ExecutionStatistics;
+
+    //! Debounce, hysteresis, and rate limit of events emitted (inactive unless configured)
+    FilterEventGate EventGate;
+
+    //! Interned names of target component and interface (see CreateEvent())
+    StringIDType TargetComponentID;
+    StringIDType TargetInterfaceID;
+
+    //! Deliver event detected to event sink (used by derived filters)
+    /*!
+        Events pass through EventGate, which may suppress or hold them.
+        \return false if event sink is not set
+    */
+    bool EmitEvent(TimestampType timestamp, const std::string & event);
+    bool EmitEvent(const FilterEvent & event);
+
+    //! Deliver events held by EventGate, if due (called by RefreshSamples())
+    /*!
+        Time is given by the latest timestamp of input samples.
+    */
+    void FlushEvents(void);
+
+    //! Returns event of this filter with target state machine filled in
+    /*!
+        Derived filters add filter-specific values and deliver the event by
+        EmitEvent(), which does not allocate memory.  Event names should be
+        interned when configured.
+    */
+    FilterEvent CreateEvent(StringIDType eventName, TimestampType timestamp) const;
+
     //! Initialize this filter
     virtual void Initialize(void);
 
@@ -213,7 +291,11 @@ protected:
     */
     bool RefreshSamples(void);
 
-    // Serialize information of the event detected in JSON format
+    //! Release value injected for the previous run
+    void ReleaseInjection(void);
+
+    // Serialize information of the event detected in JSON format (timestamp in
+    // nanoseconds, same as FilterEvent::ToJson())
     virtual void GenerateEventInfo(Json::Value & json) const;
 
     //--------------------------------------------------
@@ -227,8 +309,14 @@ protected:
     //! Output signals
     SignalElementsType OutputSignals;
 
+    //! Returns signal element of the interned name in signals (0 if not found)
+    static SignalElement * FindSignalElement(const SignalElementsType & signals, StringIDType nameId);
+
 public:
     //! Add input signal to this filter (used by derived filters)
+    /*!
+        Duplicate names are detected by comparing interned names (see StringTable).
+    */
     bool AddInputSignal(ParamBase & signalObject, const std::string & signalName);
 
     //! Add output signal to this filter (used by derived filters)
@@ -254,6 +342,18 @@ public:
 
     std::string GetInputSignalName(size_t index) const;
     std::string GetOutputSignalName(size_t index) const;
+
+    //! Returns current value of input signal (used by derived filters in RunFilter())
+    /*!
+        If the input signal is bound to output of upstream filter (see
+        FilterPipeline), the output is read in place.  _paramType must be the
+        type of the signal object given to AddInputSignal().
+    */
+    template<class _paramType>
+    inline const _paramType & GetInputValue(size_t index) const {
+        SCASSERT(index < InputSignals.size());
+        return static_cast<const _paramType &>(InputSignals[index]->GetValue());
+    }
     /* @} */
 
 
@@ -338,7 +438,10 @@ public:
     /*! \addtogroup Fault injection
         @{
     */
-    // FIXME add description about deep vs. fault injection
+    // Deep injection pushes the value to the history buffer of the input signal,
+    // whereas shallow injection queues the value in this filter without going
+    // through the history buffer.  Values of any parameter type, scalar or
+    // vector, can be injected as long as the type is that of the input signal.
     //! Injection of one element
     void InjectInput(const std::string & inputSignalName,
                      const ParamBase & arg,
@@ -391,6 +494,18 @@ public:
     //! Sets Safety Coordinator instance
     inline void SetSafetyCoordinator(Coordinator * instance) { SafetyCoordinator = instance; }
 
+    //! Returns execution-time histogram and overrun counters (see FilterPipeline)
+    inline const FilterExecutionStatistics & GetExecutionStatistics(void) const { return ExecutionStatistics; }
+    inline FilterExecutionStatistics & GetExecutionStatistics(void) { return ExecutionStatistics; }
+
+    //! Returns output stage of events emitted (see FilterEventGate::Configure())
+    inline const FilterEventGate & GetEventGate(void) const { return EventGate; }
+    inline FilterEventGate & GetEventGate(void) { return EventGate; }
+
+    inline FilterEventSink * GetEventSink(void) const { return EventSink; }
+    //! Sets receiver of events that this filter detects
+    inline void SetEventSink(FilterEventSink * sink) { EventSink = sink; }
+
     //! Returns content of this filter in human readable format
     virtual const std::string ToString(bool verbose = false) const;
 
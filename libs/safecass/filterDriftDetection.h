@@ -0,0 +1,142 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _FilterDriftDetection_h
+#define _FilterDriftDetection_h
+
+#include "safecass/filterBase.h"
+#include "safecass/paramEigen.h"
+#include "safecass/changeDetector.h"
+
+namespace SC {
+
+/*!
+    Detection of shift or drift in the mean of scalar signal
+
+    Every run adds the current value of the input signal to a streaming
+    change detector (CUSUM, Page-Hinkley, or EWMA; see changeDetector.h),
+    in O(1) time and memory per sample.
+
+        Output Y0 = test statistic of detector
+               Y1 = 1 while statistic exceeds threshold, 0 otherwise
+
+    The onset event is generated when the statistic exceeds the threshold
+    (or, in level-triggered mode, at every run above the threshold), and the
+    completion event when it falls back below the threshold.  Events are
+    delivered by FilterBase::EmitEvent() as FilterEvent, with the value of the
+    input signal and the test statistic as payload.
+    Samples that are NaN are ignored.
+
+    JSON configuration (see FilterFactory):
+
+        {   "class_name": "FilterDriftDetection",
+            "target"    : { "type": "s_A", "component": "robot" },
+            "type"      : "INTERNAL",
+            "argument"  : {
+                "input_signal"    : "ForceY",
+                "detector"        : "cusum",   // "page_hinkley", "ewma"
+                // cusum: drift k, page_hinkley: delta, ewma: lambda
+                "drift"           : 0.5,
+                // cusum: h, page_hinkley: lambda, ewma: width of control limits L
+                "threshold"       : 5.0,
+                // target of signal in control (cusum, ewma); if not given,
+                // estimated from the first warm_up samples
+                "mean"            : 0.0,
+                "stddev"          : 1.0,
+                "warm_up"         : 100,
+                "event_onset"     : "EVT_FORCE_DRIFT",
+                "event_completion": "/EVT_FORCE_DRIFT"
+            }
+        }
+*/
+class SCLIB_EXPORT FilterDriftDetection: public FilterBase
+{
+public:
+    typedef ParamEigen<double> ParamType;
+
+    typedef enum { DRIFT_COMPLETION, DRIFT_ONSET } EVENT_TYPE;
+
+protected:
+    // Filter should be instantiated with explicit arguments
+    FilterDriftDetection(void);
+
+    void Initialize(void);
+
+    FilterEvent GenerateEvent(EVENT_TYPE eventType) const;
+
+    //--------------------------------------------------
+    //  Filter-specific parameters
+    //--------------------------------------------------
+    //! Name of input signal
+    const std::string NameOfInputSignal;
+    //! Names of events generated
+    std::string EventNameOnset;
+    std::string EventNameCompletion;
+    //! Interned names of events generated
+    StringIDType EventIDOnset;
+    StringIDType EventIDCompletion;
+
+    //! Input signal object
+    ParamType Input;
+    //! Test statistic
+    ParamType Statistic;
+    //! Alarm state
+    ParamType Alarm;
+
+    //! Change detector (never null)
+    ChangeDetector * Detector;
+
+    //--------------------------------------------------
+    //  Methods required by the base class
+    //--------------------------------------------------
+    bool ConfigureFilter(const Json::Value & jsonNode);
+    bool InitFilter(void);
+    void RunFilter(void); //< Implements filtering algorithm
+    void CleanupFilter(void);
+
+public:
+    //! Constructor with explicit arguments (see ChangeDetector::Create() for parameters)
+    FilterDriftDetection(FilterBase::FilteringType          filteringType,
+                         const StateMachineInfo &           stateMachineInfo,
+                         const std::string &                inputSignalName,
+                         ChangeDetector::DetectorType       detectorType,
+                         double                             param1,
+                         double                             threshold,
+                         const std::string &                eventNameOnset,
+                         const std::string &                eventNameCompletion,
+                         FilterBase::EventDetectionModeType eventDetectionMode = EVENT_DETECTION_EDGE);
+    //! Constructor using JSON
+    FilterDriftDetection(const Json::Value & jsonNode);
+    //! Destructor
+    ~FilterDriftDetection();
+
+    //! Getters
+    inline const std::string & GetNameOfInputSignal(void) const { return NameOfInputSignal; }
+    inline const std::string & GetEventNameOnset(void) const { return EventNameOnset; }
+    inline const std::string & GetEventNameCompletion(void) const { return EventNameCompletion; }
+    inline const ParamType & GetStatistic(void) const { return Statistic; }
+    inline const ParamType & GetAlarm(void) const { return Alarm; }
+
+    //! Detector, e.g., to set target or warm-up
+    inline ChangeDetector & GetDetector(void) { return *Detector; }
+    inline const ChangeDetector & GetDetector(void) const { return *Detector; }
+
+    /*! Returns human readable representation of this filter */
+    void ToStream(std::ostream & outputStream, bool verbose = true) const;
+
+    //! For filter factory
+    SC_DEFINE_FACTORY_CREATE(FilterDriftDetection);
+};
+
+};
+
+#endif // _FilterDriftDetection_h
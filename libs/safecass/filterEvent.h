@@ -0,0 +1,109 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _FilterEvent_h
+#define _FilterEvent_h
+
+#include <iostream>
+#include <string>
+
+#include "common/common.h"
+#include "common/jsonwrapper.h"
+#include "common/stringTable.h"
+
+#include "safecass/state.h"
+
+namespace SC {
+
+//! Event that filter detects
+/*!
+    Fixed-size record that filters fill in and deliver to event sinks (see
+    FilterBase::EmitEvent()) without memory allocation: names are given as
+    IDs interned in the process-wide StringTable at configuration time, and
+    filter-specific values are kept in a small inline payload.  The event is
+    serialized in JSON only when published or logged (see ToJson()).
+
+    JSON representation:
+
+        {
+            "event": {
+                "fuid"     : 3,
+                "name"     : "EVT_FORCE",
+                "timestamp": 1476707588000000000,
+                "signal"   : "Force",               // if any
+                "value"    : 12.5,                  // payload[0], if any
+                "payload"  : [ 12.5, 3.0 ],         // if more than one value
+                "elements" : [ 1, 5 ]               // if any
+            },
+            "target": { "type": 2, "component": "robot", "interface": "" }
+        }
+
+    "timestamp" is an integer in nanoseconds; FilterBase::GenerateEventInfo()
+    emits the same representation for filters that build JSON directly.
+*/
+struct SCLIB_EXPORT FilterEvent
+{
+    //! Max number of values in payload
+    enum { PAYLOAD_SIZE = 4 };
+
+    //! UID of filter that detected event (see FilterBase::GetFilterID())
+    size_t FilterUID;
+    //! Interned name of event
+    StringIDType Name;
+    //! Timestamp of event (e.g., timestamp of input sample)
+    TimestampType Timestamp;
+
+    //! Target state machine
+    State::StateMachineType TargetType;
+    StringIDType TargetComponent;
+    StringIDType TargetInterface;
+
+    //! Interned name of signal that caused event (INVALID_STRING_ID if none)
+    StringIDType Signal;
+    //! Bitmask of elements (of vector signal) that caused event; elements above 63 are not recorded
+    boost::uint64_t Elements;
+
+    //! Filter-specific values (e.g., value of signal, test statistic)
+    unsigned int PayloadSize;
+    double Payload[PAYLOAD_SIZE];
+
+    FilterEvent(void);
+
+    //! Append value to payload (false if payload is full)
+    bool AddPayload(double value);
+
+    //! Mark element of vector signal
+    inline void AddElement(int index) {
+        if (index >= 0 && index < 64)
+            Elements |= ((boost::uint64_t) 1 << index);
+    }
+
+    //! Returns name of event
+    inline const std::string & GetName(void) const { return StringTable::GetInstance()->GetString(Name); }
+
+    //! Serialize event in JSON
+    void ToJson(Json::Value & json) const;
+    std::string ToJsonString(void) const;
+
+    //! Returns human readable representation of this event
+    void ToStream(std::ostream & outputStream) const;
+};
+
+inline std::ostream & operator << (std::ostream & outputStream, const FilterEvent & event)
+{
+    event.ToStream(outputStream);
+    return outputStream;
+}
+
+};
+
+#endif // _FilterEvent_h
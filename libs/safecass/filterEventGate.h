@@ -0,0 +1,205 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _FilterEventGate_h
+#define _FilterEventGate_h
+
+#include <iostream>
+#include <vector>
+
+#include "common/common.h"
+#include "common/jsonwrapper.h"
+
+#include "safecass/filterEvent.h"
+
+namespace SC {
+
+//! Debounce, hysteresis, and rate limit of events that filter emits
+/*!
+    Output stage of FilterBase::EmitEvent() that keeps noisy input around a
+    threshold from flooding event sinks.  Inactive unless any of the following
+    is set:
+
+    - Minimum dwell time: an event of other name than the last event
+      delivered (a "flip", e.g., completion after onset) is held while the
+      current event has been in effect for less than the dwell time.
+    - Hysteresis band: a flip is held while the value of the event
+      (payload[0]) is within the band of the value of the event that
+      started the current one.  Requires minimum dwell time, which bounds
+      how long a flip is held by hysteresis.
+    - Max event rate: at most the given number of events per second are
+      delivered (bursts of up to one second worth of events), by timestamp
+      of events.
+
+    Repeated events of the current name (level-triggered mode) are subject
+    to the rate limit only.  Of events held, the latest is kept: it is
+    dropped if an event of the current name follows (the input went back,
+    and that event is suppressed as well), replaced by a later event held,
+    delivered if a later event of the same name passes, and otherwise
+    released by Flush() once the dwell time has passed (held by dwell time:
+    since the current event started; held by hysteresis: since the event
+    held) or, if held by rate limit, once the rate allows.  Thus no flip is
+    held forever, even if edge-triggered filters do not emit it again.
+
+    An event is counted as suppressed when it is dropped or replaced (or
+    not delivered due to the rate limit), and as released when Flush()
+    delivers it: every event pushed is counted once as delivered,
+    suppressed, or released, unless it is still held.
+
+    Dwell time and hysteresis apply to the events of each signal (see
+    FilterEvent::Signal) separately, so that events of filters that monitor
+    more than one signal (e.g., FilterThresholdBank) do not hold or drop
+    each other; the state of a signal is allocated on its first event.  The
+    rate limit applies to all events of the filter.
+
+    Events given in JSON (FilterBase::EmitEvent(TimestampType, const
+    std::string &)) are subject to the rate limit only.
+
+    JSON configuration (member "event_output" of filter configuration):
+
+        "event_output": {
+            "min_dwell_time": 0.1,   // seconds
+            "hysteresis"    : 0.5,   // in units of payload[0]
+            "max_rate"      : 10.0   // events per second
+        }
+*/
+class SCLIB_EXPORT FilterEventGate
+{
+public:
+    //! Reasons of suppression
+    typedef enum {
+        SUPPRESSED_DWELL,
+        SUPPRESSED_HYSTERESIS,
+        SUPPRESSED_RATE,
+        NUMBER_OF_REASONS
+    } ReasonType;
+
+protected:
+    //! Configuration (0: not used)
+    TimestampType MinDwellTime;
+    double HysteresisBand;
+    double MaxRate;
+    //! Min interval between events and tolerance of burst (in nanoseconds) for rate limit
+    TimestampType Interval;
+    TimestampType Burst;
+
+    //! Run-time state of events of one signal
+    struct ChannelType {
+        StringIDType Signal;
+
+        //! Current event: last event delivered
+        bool HasCurrent;
+        StringIDType CurrentName;
+        //! Time and value when current event started (at the last flip)
+        TimestampType CurrentTimestamp;
+        bool HasCurrentValue;
+        double CurrentValue;
+
+        //! Latest event held
+        bool HasPending;
+        ReasonType PendingReason;
+        FilterEvent Pending;
+    };
+    typedef std::vector<ChannelType> ChannelsType;
+    ChannelsType Channels;
+
+    //! Number of channels that hold event
+    size_t NumberOfPending;
+
+    //! Theoretical arrival time of next event for rate limit (GCRA)
+    TimestampType NextArrival;
+    bool HasNextArrival;
+
+    //! Counters
+    size_t Delivered;
+    size_t Suppressed[NUMBER_OF_REASONS];
+    size_t Released;
+
+    //! Returns if rate limit allows event at timestamp (and counts it if so)
+    bool AllowRate(TimestampType timestamp);
+
+    //! Returns channel of signal (added if not found)
+    ChannelType & GetChannel(StringIDType signal);
+
+    //! Returns if event held by channel is due at time now
+    bool IsDue(const ChannelType & channel, TimestampType now) const;
+
+    //! Start event delivered
+    static void SetCurrent(ChannelType & channel, const FilterEvent & event);
+
+    //! Hold event (replaces event held, if any)
+    bool Hold(ChannelType & channel, const FilterEvent & event, ReasonType reason);
+    //! Drop event held, if any (counted as suppressed)
+    void Drop(ChannelType & channel);
+
+public:
+    FilterEventGate(void);
+
+    //! Configure (see class description)
+    /*!
+        \param minDwellTime Minimum dwell time in nanoseconds (0: not used)
+        \param hysteresisBand Hysteresis band (0: not used)
+        \param maxRate Max number of events per second (0: not used)
+        \return false if any argument is negative, or if hysteresis band
+                is set without minimum dwell time
+    */
+    bool Configure(TimestampType minDwellTime, double hysteresisBand, double maxRate);
+    //! Configure using JSON
+    bool Configure(const Json::Value & json);
+
+    //! Reset run-time state and counters
+    void Reset(void);
+
+    //! Returns if any of dwell time, hysteresis, and rate limit is set
+    inline bool IsEnabled(void) const {
+        return (MinDwellTime > 0 || HysteresisBand > 0.0 || MaxRate > 0.0);
+    }
+
+    //! Pass event through this gate
+    /*!
+        \return true if the event should be delivered now
+    */
+    bool Push(const FilterEvent & event);
+    //! Pass event given in JSON through this gate (rate limit only)
+    bool Push(TimestampType timestamp);
+
+    //! Release event held, if due at time now
+    /*!
+        Releases one event per call; call again until it returns false to
+        release events of all signals that are due.
+        \return true if event held is released (copied to released)
+    */
+    bool Flush(TimestampType now, FilterEvent & released);
+
+    //! Getters
+    inline TimestampType GetMinDwellTime(void) const { return MinDwellTime; }
+    inline double GetHysteresisBand(void) const { return HysteresisBand; }
+    inline double GetMaxRate(void) const { return MaxRate; }
+    inline bool HasPendingEvent(void) const { return (NumberOfPending > 0); }
+    inline size_t GetDelivered(void) const { return Delivered; }
+    inline size_t GetSuppressed(ReasonType reason) const { return Suppressed[reason]; }
+    inline size_t GetReleased(void) const { return Released; }
+    //! Returns number of events suppressed for any reason
+    size_t GetSuppressed(void) const;
+
+    void ToStream(std::ostream & os) const;
+};
+
+inline std::ostream & operator << (std::ostream & os, const FilterEventGate & gate)
+{
+    gate.ToStream(os);
+    return os;
+}
+
+};
+
+#endif // _FilterEventGate_h
@@ -0,0 +1,108 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _FilterExecutionStatistics_h
+#define _FilterExecutionStatistics_h
+
+#include <iostream>
+
+#include <boost/thread/mutex.hpp>
+
+#include "common/common.h"
+#include "common/utils.h"
+
+namespace SC {
+
+//! Execution-time histogram and overrun counters of filter
+/*!
+    Updated by the filter executor (see FilterPipeline) and printed as part
+    of FilterBase::ToStream(), and thus by Coordinator::GetFilterList().
+
+    Bins are powers of two in microseconds: bin 0 counts runs shorter than
+    1 us, bin i (0 < i < NUMBER_OF_BINS - 1) counts runs in [2^(i-1), 2^i)
+    us, and the last bin counts all longer runs.  Recording a run is O(1)
+    and does not allocate.
+
+    Statistics of an offloaded filter are recorded by the monitoring thread
+    (see FilterOffloadQueue) while the component thread records skipped runs
+    and other threads print them, so all members are accessed under lock.
+    Copying takes a consistent snapshot.
+*/
+class SCLIB_EXPORT FilterExecutionStatistics
+{
+public:
+    enum { NUMBER_OF_BINS = 16 };
+
+protected:
+    size_t Bins[NUMBER_OF_BINS];
+
+    //! Number of runs recorded
+    size_t Count;
+    //! Sum and maximum of execution times (in nanoseconds)
+    TimestampType Total;
+    TimestampType Max;
+
+    //! Number of runs deferred to next tick due to budget overrun
+    size_t Deferred;
+    //! Number of runs offloaded to external filtering due to budget overrun
+    size_t Offloaded;
+    //! Number of runs skipped (e.g., previous offloaded run not completed)
+    size_t Skipped;
+
+    mutable boost::mutex Mutex;
+
+    //! Copy counters of other (caller holds lock of both)
+    void CopyFrom(const FilterExecutionStatistics & other);
+
+public:
+    FilterExecutionStatistics(void);
+    FilterExecutionStatistics(const FilterExecutionStatistics & other);
+    FilterExecutionStatistics & operator=(const FilterExecutionStatistics & other);
+
+    //! Record execution time of one run (in nanoseconds)
+    void Record(TimestampType elapsed);
+
+    void RecordDeferred(void);
+    void RecordOffloaded(void);
+    void RecordSkipped(void);
+
+    void Reset(void);
+
+    //! Returns bin of execution time (in nanoseconds)
+    static size_t GetBin(TimestampType elapsed);
+    //! Returns upper bound of bin in microseconds (0 for the last bin, which has none)
+    static TimestampType GetBinUpperBound(size_t bin);
+
+    size_t GetBinCount(size_t bin) const;
+    size_t GetCount(void) const;
+    TimestampType GetTotal(void) const;
+    TimestampType GetMax(void) const;
+    double GetMean(void) const;
+    size_t GetDeferred(void) const;
+    size_t GetOffloaded(void) const;
+    size_t GetSkipped(void) const;
+
+    //! Returns bin that contains the percentile of execution time (e.g., 0.99)
+    size_t GetPercentileBin(double percentile) const;
+
+    void ToStream(std::ostream & os) const;
+};
+
+inline std::ostream & operator << (std::ostream & os, const FilterExecutionStatistics & statistics)
+{
+    statistics.ToStream(os);
+    return os;
+}
+
+};
+
+#endif // _FilterExecutionStatistics_h
@@ -0,0 +1,62 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _FilterMinMax_h
+#define _FilterMinMax_h
+
+#include "safecass/filterSlidingWindow.h"
+
+namespace SC {
+
+/*!
+    Running minimum and maximum of scalar signal over sliding window
+
+        Output Y0 = minimum of samples in window
+               Y1 = maximum of samples in window
+
+    See FilterSlidingWindow for arguments.
+*/
+class SCLIB_EXPORT FilterMinMax: public FilterSlidingWindow
+{
+protected:
+    // Filter should be instantiated with explicit arguments
+    FilterMinMax(void);
+
+    void Initialize(void);
+
+    //! Minimum of samples in window
+    ParamType Min;
+    //! Maximum of samples in window
+    ParamType Max;
+
+    void UpdateOutputs(void);
+
+public:
+    //! Constructor with explicit arguments (time-based window if windowDuration is positive)
+    FilterMinMax(FilteringType            filteringType,
+                 const StateMachineInfo & stateMachineInfo,
+                 const std::string &      inputSignalName,
+                 size_t                   windowSize,
+                 TimestampType            windowDuration = 0);
+    //! Constructor using JSON
+    FilterMinMax(const Json::Value & jsonNode);
+
+    inline const ParamType & GetMin(void) const { return Min; }
+    inline const ParamType & GetMax(void) const { return Max; }
+
+    //! For filter factory
+    SC_DEFINE_FACTORY_CREATE(FilterMinMax);
+};
+
+};
+
+#endif // _FilterMinMax_h
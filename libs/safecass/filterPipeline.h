@@ -0,0 +1,298 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _FilterPipeline_h
+#define _FilterPipeline_h
+
+#include <vector>
+
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+#include "common/common.h"
+#include "common/utils.h"
+#include "safecass/filterBase.h"
+
+namespace SC {
+
+//! Queue of filters offloaded from FilterPipeline to external filtering
+/*!
+    When a pipeline overruns its budget with OVERRUN_OFFLOAD policy (see
+    FilterPipeline::SetBudget()), it pushes the remaining stages of the tick to
+    this queue, and the monitoring thread runs them by Run().  The pipeline
+    takes a copy of every input the offloaded stages read from the stages that
+    already ran, so that offloaded filters do not race with the component
+    thread.  Only one batch is in flight at a time: while the queue is busy,
+    the pipeline skips the offloaded stages.  The pipeline cancels its batch
+    by Cancel() before it unbinds input signals (e.g., when destroyed).
+*/
+class SCLIB_EXPORT FilterOffloadQueue
+{
+protected:
+    //! Filters to run in order (valid while Busy is true)
+    std::vector<FilterBase *> Filters;
+    bool Busy;
+    //! True while Run() runs filters
+    bool Running;
+
+    mutable boost::mutex Mutex;
+    boost::condition_variable Completed;
+
+public:
+    FilterOffloadQueue(void);
+
+    //! Returns true if offloaded filters have not completed yet
+    bool IsBusy(void) const;
+
+    //! Reserve space for filters so that Push() does not allocate
+    void Reserve(size_t size);
+
+    //! Push filters to run (called by component thread)
+    /*!
+        \return false if queue is busy
+    */
+    bool Push(FilterBase * const * filters, size_t size);
+
+    //! Run offloaded filters, if any (called by monitoring thread)
+    /*!
+        Execution time of each filter is recorded to its execution statistics
+        (see FilterBase::GetExecutionStatistics()).
+        \return number of filters run
+    */
+    size_t Run(void);
+
+    //! Drop filters pushed by Push() if not started yet, or wait until they complete
+    /*!
+        Called by component thread.  Filters pushed by another pipeline are
+        left as they are.
+        \param filters Filters pushed by Push()
+    */
+    void Cancel(FilterBase * const * filters);
+};
+
+/*!
+    Executor of filters chained into directed acyclic graph (DAG)
+
+    A filter consumes output of another filter if one of its input signals
+    has the same name as one of the output signals of the other filter (names
+    are compared as interned names; see StringTable).  Build() sorts filters
+    topologically so that every filter runs after the filters it consumes
+    output of, and binds each such input signal to the output signal object
+    of the upstream filter.  Filters read their inputs by
+    FilterBase::GetInputValue(), which refers to the upstream output in place
+    without copy or history buffer round trip.
+
+        FilterPipeline pipeline;
+        pipeline.AddFilter(&threshold); // reads "force:norm"
+        pipeline.AddFilter(&norm);      // writes "force:norm"
+        pipeline.Build();               // norm, then threshold
+        ...
+        pipeline.Run();                 // every tick
+
+    Input signals that no filter in the pipeline writes are not bound, and
+    filters read them as before.  Run() measures the latency of each stage.
+    The pipeline does not own filters, and filters must outlive the pipeline.
+
+    Each component runs its internal filters by its own pipeline, and
+    SetBudget() limits the time the pipeline may take per tick.  Once the
+    budget is used up, the remaining stages are deferred to the next tick or
+    offloaded to external filtering (see OverrunPolicyType).  Execution time
+    of each filter, and the number of times it was deferred, offloaded, or
+    skipped, is recorded to its execution statistics, which
+    FilterBase::ToStream() prints in verbose mode.
+*/
+class SCLIB_EXPORT FilterPipeline
+{
+public:
+    //! Latency statistics of stage (in nanoseconds)
+    struct LatencyType {
+        size_t        Count;
+        TimestampType Last;
+        TimestampType Min;
+        TimestampType Max;
+        TimestampType Total;
+
+        inline double GetMean(void) const {
+            return (Count == 0 ? 0.0 : (double) Total / (double) Count);
+        }
+    };
+
+    //! What to do with the remaining stages when the budget is used up
+    typedef enum {
+        //! Run them in the next tick, before any other stage
+        OVERRUN_DEFER,
+        //! Run them by the monitoring thread (see FilterOffloadQueue)
+        OVERRUN_OFFLOAD
+    } OverrunPolicyType;
+
+protected:
+    //! Stage of pipeline
+    struct StageType {
+        FilterBase * Filter;
+        //! True if no filter in the pipeline consumes output of this filter
+        bool LastFilterOfPipeline;
+        LatencyType Latency;
+    };
+    typedef std::vector<StageType> StagesType;
+
+    typedef std::vector<FilterBase *> FiltersType;
+
+    //! Filters in order added
+    FiltersType Filters;
+
+    //! Stages in execution order (valid if Built is true)
+    StagesType Stages;
+    //! Filters of stages in execution order
+    FiltersType SortedFilters;
+
+    //! Input signal bound to upstream output
+    struct BindingType {
+        SignalElement * Input;
+        const ParamBase * Source;
+        //! Stages of upstream and downstream filters
+        size_t Producer;
+        size_t Consumer;
+        //! Copy of source read by offloaded stage (0 if no offload queue)
+        ParamBase * Copy;
+    };
+
+    //! Input signals bound to upstream outputs (unbound when rebuilt or destroyed)
+    std::vector<BindingType> BoundInputs;
+
+    //! True if filters have been sorted and bound
+    bool Built;
+
+    //! True if Run() measures latency of each stage
+    bool MeasureLatency;
+
+    //! Time budget per tick (in nanoseconds, 0 if unlimited)
+    TimestampType Budget;
+    OverrunPolicyType OverrunPolicy;
+    FilterOffloadQueue * OffloadQueue;
+
+    //! Stage to start next tick from (nonzero if stages were deferred)
+    size_t Cursor;
+    //! First offloaded stage (number of stages if none offloaded)
+    size_t OffloadedFrom;
+
+    //! Number of ticks that used up the budget
+    size_t NumberOfOverruns;
+
+    //! Unbind all input signals bound by this pipeline
+    void Unbind(void);
+
+    //! Handle overrun before stage (stages from end on are offloaded)
+    void Overrun(size_t stage, size_t end);
+
+    //! Bind offloaded stages back to upstream outputs after the offload queue completed
+    void RestoreOffloaded(void);
+
+    static void ResetLatency(LatencyType & latency);
+
+public:
+    FilterPipeline(void);
+    ~FilterPipeline();
+
+    //! Add filter to pipeline
+    /*!
+        The pipeline has to be built again (see Build()).
+        \return false if filter is 0 or already in pipeline
+    */
+    bool AddFilter(FilterBase * filter);
+
+    inline size_t GetNumberOfFilters(void) const { return Filters.size(); }
+
+    //! Sort filters topologically and bind input signals to upstream outputs
+    /*!
+        Filters that do not depend on each other run in the order added.
+        \return false if any signal is written by more than one filter, if an
+                input signal is bound to an output signal of different type,
+                or if filters have circular dependency.  Nothing is bound in
+                that case.
+    */
+    bool Build(void);
+
+    inline bool IsBuilt(void) const { return Built; }
+
+    //! Run all filters once in topological order (builds pipeline if not built yet)
+    /*!
+        With a budget set, Run() starts from the stages deferred by the
+        previous tick, and checks the budget before each stage; at least one
+        stage runs per tick.
+        \return false if pipeline cannot be built
+    */
+    bool Run(void);
+
+    //! Set time budget per tick in microseconds (0 for unlimited, the default)
+    /*!
+        The budget is checked between stages, so a stage that starts within
+        the budget always completes.  With OVERRUN_OFFLOAD policy, an offload
+        queue has to be set (see SetOffloadQueue()); otherwise the remaining
+        stages are deferred.
+    */
+    void SetBudget(TimestampType microseconds, OverrunPolicyType policy = OVERRUN_DEFER);
+    inline TimestampType GetBudget(void) const { return Budget / 1000; }
+    inline OverrunPolicyType GetOverrunPolicy(void) const { return OverrunPolicy; }
+
+    //! Set queue that the monitoring thread runs offloaded stages from
+    /*!
+        The pipeline has to be built again (see Build()).  The queue must
+        outlive the pipeline.
+    */
+    void SetOffloadQueue(FilterOffloadQueue * queue);
+    inline FilterOffloadQueue * GetOffloadQueue(void) const { return OffloadQueue; }
+
+    inline size_t GetNumberOfOverruns(void) const { return NumberOfOverruns; }
+
+    //! Returns stage that next tick starts from (0 unless stages were deferred)
+    inline size_t GetNextStage(void) const { return Cursor; }
+
+    //
+    // Stages (in execution order)
+    //
+    inline size_t GetNumberOfStages(void) const { return Stages.size(); }
+
+    //! Returns filter of stage (0 if stage is invalid)
+    FilterBase * GetStage(size_t stage) const;
+
+    //! Returns true if no filter in the pipeline consumes output of the filter of stage
+    bool IsLastFilterOfPipeline(size_t stage) const;
+
+    //! Returns latency statistics of stage (0 if stage is invalid)
+    const LatencyType * GetLatency(size_t stage) const;
+
+    //! Enable or disable latency measurement (enabled by default)
+    /*!
+        Latency measurement reads the (monotonic) clock once per stage, which
+        may cost more than light-weight filters.
+    */
+    inline void EnableLatencyMeasurement(bool enable = true) { MeasureLatency = enable; }
+    inline bool IsLatencyMeasurementEnabled(void) const { return MeasureLatency; }
+
+    //! Clear latency statistics of all stages and number of overruns
+    void ResetLatency(void);
+
+    //! Print latency statistics and overrun counters of all stages in microseconds
+    void ReportLatency(std::ostream & os) const;
+
+    void ToStream(std::ostream & os) const;
+};
+
+inline std::ostream & operator << (std::ostream & os, const FilterPipeline & pipeline)
+{
+    pipeline.ToStream(os);
+    return os;
+}
+
+};
+
+#endif // _FilterPipeline_h
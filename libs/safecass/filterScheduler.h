@@ -0,0 +1,217 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _FilterScheduler_h
+#define _FilterScheduler_h
+
+#include <vector>
+#include <deque>
+
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+#include "common/common.h"
+#include "common/utils.h"
+#include "safecass/filterPipeline.h"
+
+namespace SC {
+
+/*!
+    Parallel scheduler of external filters (FilterBase::FILTERING_EXTERNAL)
+
+    Without the scheduler, the monitoring component runs all external filters
+    one by one, and detection delay grows with the number of filters.
+    FilterScheduler partitions filters into tasks and runs tasks on a pool of
+    worker threads at every tick (Run()):
+
+    - Filters connected by signals (see FilterPipeline) form one task and run
+      in topological order on the same worker.  Independent filters form
+      separate tasks that run in parallel.
+    - Tasks are assigned to workers by their cost measured at the previous
+      tick (the longest first, to the least loaded worker).  A worker that
+      runs out of tasks steals tasks from the other workers.
+    - Run() returns when all tasks have run once.  Each filter thus runs
+      exactly once per tick and never concurrently with itself, and the order
+      of runs of each filter is preserved.
+    - Events that filters emit (FilterBase::EmitEvent()) are buffered per task
+      during the tick and delivered to the event sink (any FilterEventSink) by
+      the thread calling Run(), in timestamp order (ties in order of filter
+      ID, then in order emitted).  All events of a tick are delivered before
+      the next tick starts.  Typed events (FilterEvent) are delivered as
+      such, without serialization.
+
+    Workers are idle between ticks; utilization of each worker is the ratio
+    of time spent running tasks to time spent in Run().  The scheduler does
+    not own filters, and filters must outlive the scheduler.
+*/
+class SCLIB_EXPORT FilterScheduler
+{
+public:
+    //! Statistics of worker thread
+    struct WorkerStatisticsType {
+        //! Number of tasks run
+        size_t Tasks;
+        //! Number of tasks stolen from other workers
+        size_t Steals;
+        //! Time spent running tasks (in nanoseconds)
+        TimestampType BusyTime;
+    };
+
+protected:
+    //! Buffer of events emitted by filters of task during tick
+    class EventBufferType: public FilterEventSink
+    {
+    public:
+        struct EventType {
+            TimestampType Timestamp;
+            const FilterBase * Filter;
+            //! Typed event (Typed is false if event is given in JSON)
+            bool Typed;
+            FilterEvent Event;
+            std::string Json;
+        };
+        std::vector<EventType> Events;
+
+        void OnFilterEvent(const FilterBase * filter, TimestampType timestamp, const std::string & event);
+        void OnFilterEvent(const FilterBase * filter, const FilterEvent & event);
+    };
+
+    //! Task: filters connected by signals
+    struct TaskType {
+        FilterPipeline * Pipeline;
+        EventBufferType * Events;
+        //! Time spent at the latest tick (in nanoseconds)
+        TimestampType Cost;
+    };
+    typedef std::vector<TaskType> TasksType;
+
+    //! Worker thread and its task queue
+    struct WorkerType {
+        boost::thread * Thread;
+        boost::mutex QueueMutex;
+        //! Tasks assigned (index of task); owner pops front, thieves pop back
+        std::deque<size_t> Queue;
+        WorkerStatisticsType Statistics;
+    };
+    typedef std::vector<WorkerType *> WorkersType;
+
+    typedef std::vector<FilterBase *> FiltersType;
+
+    //! Filters in order added
+    FiltersType Filters;
+    //! Event sinks of filters before added (restored when scheduler is destroyed)
+    std::vector<FilterEventSink *> PreviousEventSinks;
+
+    TasksType Tasks;
+    //! True if filters have been partitioned into tasks
+    bool Built;
+
+    WorkersType Workers;
+
+    //! Receiver of events (0: events are dropped)
+    FilterEventSink * EventSink;
+
+    //
+    // Synchronization between Run() and workers (protected by Mutex)
+    //
+    boost::mutex Mutex;
+    //! Notified when tick starts or scheduler stops
+    boost::condition_variable TickStarted;
+    //! Notified when all tasks of tick have run
+    boost::condition_variable TickCompleted;
+    //! Incremented at every tick
+    size_t Tick;
+    //! Number of tasks of the current tick not completed yet
+    size_t NumberOfRemainingTasks;
+    bool Stop;
+
+    //! Time spent in Run() (in nanoseconds)
+    TimestampType TotalTime;
+    //! Number of events delivered
+    size_t NumberOfEvents;
+
+    //! Main loop of worker thread
+    void RunWorker(size_t worker);
+
+    //! Pop task from queue of worker, or steal one from other workers
+    bool PopTask(size_t worker, size_t & task, bool & stolen);
+
+    //! Deliver events buffered during tick in timestamp order
+    void DeliverEvents(void);
+
+    //! Delete tasks
+    void ClearTasks(void);
+
+public:
+    //! Constructor
+    /*!
+        \param numberOfThreads Number of worker threads (at least one)
+    */
+    FilterScheduler(size_t numberOfThreads);
+    ~FilterScheduler();
+
+    //! Add external filter
+    /*!
+        The scheduler has to be built again (see Build()).
+        \return false if filter is 0, already added, or not external filter
+    */
+    bool AddFilter(FilterBase * filter);
+
+    inline size_t GetNumberOfFilters(void) const { return Filters.size(); }
+
+    //! Partition filters into tasks
+    /*!
+        \return false if filters connected by signals cannot be sorted (see
+                FilterPipeline::Build())
+    */
+    bool Build(void);
+
+    inline bool IsBuilt(void) const { return Built; }
+
+    //! Number of tasks (valid after Build())
+    inline size_t GetNumberOfTasks(void) const { return Tasks.size(); }
+
+    //! Sets receiver of events
+    inline void SetEventSink(FilterEventSink * sink) { EventSink = sink; }
+
+    //! Run all filters once on worker threads (builds scheduler if not built yet)
+    /*!
+        Must not be called by more than one thread at the same time.
+        \return false if scheduler cannot be built
+    */
+    bool Run(void);
+
+    //
+    // Statistics
+    //
+    inline size_t GetNumberOfWorkers(void) const { return Workers.size(); }
+
+    //! Returns statistics of worker (0 if worker is invalid)
+    const WorkerStatisticsType * GetWorkerStatistics(size_t worker) const;
+
+    //! Returns utilization of worker [0, 1] (0 if worker is invalid or Run() has not been called)
+    double GetUtilization(size_t worker) const;
+
+    inline TimestampType GetTotalTime(void) const { return TotalTime; }
+    inline size_t GetNumberOfEvents(void) const { return NumberOfEvents; }
+
+    //! Clear statistics of all workers
+    void ResetStatistics(void);
+
+    //! Print statistics of all workers
+    void ReportUtilization(std::ostream & os) const;
+};
+
+};
+
+#endif // _FilterScheduler_h
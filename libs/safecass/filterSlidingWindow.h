@@ -0,0 +1,92 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _FilterSlidingWindow_h
+#define _FilterSlidingWindow_h
+
+#include "safecass/filterBase.h"
+#include "safecass/paramEigen.h"
+#include "safecass/slidingWindow.h"
+
+namespace SC {
+
+/*!
+    Base class of filters that compute statistics of a scalar signal over a
+    sliding window (see SlidingWindowStatistics)
+
+    Every run adds the current value of the input signal to the window, with
+    the timestamp of the value, and derived filters update their outputs from
+    the window statistics by UpdateOutputs().  Each run costs O(1) regardless
+    of the window size.
+
+    JSON arguments common to derived filters:
+
+        "argument": {
+            "input_signal"  : "ForceY",
+            // count-based window: latest N samples
+            "window_samples": 100,
+            // time-based window (optional): samples within the last 0.5 s,
+            // at most window_samples samples
+            "window_time"   : 0.5
+        }
+*/
+class SCLIB_EXPORT FilterSlidingWindow: public FilterBase
+{
+public:
+    typedef ParamEigen<double> ParamType;
+
+protected:
+    //! Name of input signal
+    const std::string NameOfInputSignal;
+    //! Input signal object
+    ParamType Input;
+
+    //! Window of samples (created by constructor or ConfigureFilter())
+    SlidingWindowStatistics * Window;
+
+    //! Create window (time-based if duration is positive)
+    void CreateWindow(size_t size, TimestampType duration);
+
+    //! Update outputs from window statistics
+    virtual void UpdateOutputs(void) = 0;
+
+    //--------------------------------------------------
+    //  Methods required by the base class
+    //--------------------------------------------------
+    bool ConfigureFilter(const Json::Value & jsonNode);
+    bool InitFilter(void);
+    void RunFilter(void); //< Implements filtering algorithm
+    void CleanupFilter(void);
+
+    //! Constructor with explicit arguments (time-based window if windowDuration is positive)
+    FilterSlidingWindow(const std::string &      filterName,
+                        FilteringType            filteringType,
+                        const StateMachineInfo & stateMachineInfo,
+                        const std::string &      inputSignalName,
+                        size_t                   windowSize,
+                        TimestampType            windowDuration = 0);
+    //! Constructor using JSON
+    FilterSlidingWindow(const std::string & filterName, const Json::Value & jsonNode);
+
+public:
+    virtual ~FilterSlidingWindow();
+
+    inline const std::string & GetNameOfInputSignal(void) const { return NameOfInputSignal; }
+    inline const SlidingWindowStatistics & GetWindow(void) const { return *Window; }
+
+    /*! Returns human readable representation of this filter */
+    void ToStream(std::ostream & outputStream, bool verbose = true) const;
+};
+
+};
+
+#endif // _FilterSlidingWindow_h
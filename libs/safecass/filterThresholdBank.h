@@ -0,0 +1,173 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _FilterThresholdBank_h
+#define _FilterThresholdBank_h
+
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+#include "safecass/filterBase.h"
+#include "safecass/paramEigen.h"
+
+namespace SC {
+
+/*!
+    Threshold filter over many scalar signals
+
+    Given threshold T[i] and tolerance t[i] of each signal i,
+
+        Output Y[i] = OutputAbove if X[i] > (T[i] + t[i])
+                      OutputBelow otherwise
+
+    which is the same as FilterThreshold, but one filter checks all signals
+    in one pass: inputs are gathered into a contiguous array and compared
+    against T + t with SSE2 or AVX (see SAFECASS_ENABLE_AVX), producing a
+    bitmask of signals above threshold.  Events are generated only for
+    signals whose bit changed (or, in level-triggered mode, is set), so that
+    a tick without crossing neither allocates nor builds event strings.
+    Signals whose value is NaN are considered below threshold.
+
+    JSON configuration (see FilterFactory):
+
+        {   "class_name": "FilterThresholdBank",
+            "target"    : { "type": "s_A", "component": "robot" },
+            "type"      : "INTERNAL",
+            "argument"  : {
+                "output_above": 1.0,
+                "output_below": 0.0,
+                "signals": [
+                    { "input_signal": "q1", "threshold": 1.57, "tolerance": 0.01,
+                      "event_onset": "EVT_Q1_LIMIT", "event_completion": "/EVT_Q1_LIMIT" },
+                    ...
+                ]
+            }
+        }
+
+    Events are delivered by FilterBase::EmitEvent() as FilterEvent, with the
+    name and value of the signal.
+*/
+class SCLIB_EXPORT FilterThresholdBank: public FilterBase
+{
+public:
+    typedef ParamEigen<double> ParamType;
+    typedef ParamEigen<Eigen::VectorXd> OutputType;
+
+    typedef enum { BELOW_THRESHOLD, ABOVE_THRESHOLD } EVENT_TYPE;
+
+protected:
+    // Filter should be instantiated with explicit arguments
+    FilterThresholdBank(void);
+
+    void Initialize(void);
+
+    FilterEvent GenerateEvent(size_t index, EVENT_TYPE eventType) const;
+
+    //! Bitmask words of signals above threshold
+    typedef std::vector<boost::uint64_t> MaskType;
+
+    //--------------------------------------------------
+    //  Filter-specific parameters (one element per signal)
+    //--------------------------------------------------
+    //! Input signal objects (owned by this filter)
+    std::vector<ParamType *> Inputs;
+    std::vector<double> Thresholds;
+    std::vector<double> Tolerances;
+    //! Threshold plus tolerance, compared against inputs
+    std::vector<double> Limits;
+    //! Names of events generated
+    std::vector<std::string> EventNamesAbove;
+    std::vector<std::string> EventNamesBelow;
+    //! Interned names of events generated
+    std::vector<StringIDType> EventIDsAbove;
+    std::vector<StringIDType> EventIDsBelow;
+
+    //! Output when input exceeds threshold by more than margin of tolerance
+    double OutputAbove;
+    //! Output when input does not exceed threshold with margin of tolerance
+    double OutputBelow;
+
+    //! Output of all signals
+    OutputType Output;
+
+    //--------------------------------------------------
+    //  Run-time state
+    //--------------------------------------------------
+    //! Inputs gathered for comparison
+    std::vector<double> Values;
+    //! Signals above threshold at previous and current run
+    MaskType Above;
+    MaskType Current;
+
+    //! Number of threshold crossings (in either direction)
+    size_t NumberOfCrossings;
+
+    //--------------------------------------------------
+    //  Methods required by the base class
+    //--------------------------------------------------
+    bool ConfigureFilter(const Json::Value & jsonNode);
+    bool InitFilter(void);
+    void RunFilter(void); //< Implements filtering algorithm
+    void CleanupFilter(void);
+
+    //! Update output and generate event of signal that crossed threshold
+    void OnCrossing(size_t index, bool above);
+
+public:
+    //! Constructor with explicit arguments (signals are added by AddSignal())
+    FilterThresholdBank(FilterBase::FilteringType          filteringType,
+                        const StateMachineInfo &           stateMachineInfo,
+                        double                             outputBelow = 0.0,
+                        double                             outputAbove = 1.0,
+                        FilterBase::EventDetectionModeType eventDetectionMode = EVENT_DETECTION_EDGE);
+    //! Constructor using JSON
+    FilterThresholdBank(const Json::Value & jsonNode);
+    //! Destructor
+    ~FilterThresholdBank();
+
+    //! Add signal to check
+    /*!
+        \return false if signal of the same name has been added
+    */
+    bool AddSignal(const std::string & inputSignalName,
+                   double              threshold,
+                   double              tolerance,
+                   const std::string & eventNameAbove,
+                   const std::string & eventNameBelow);
+
+    //! Getters
+    inline size_t GetNumberOfSignals(void) const { return Inputs.size(); }
+    inline double GetThreshold(size_t index) const { return Thresholds[index]; }
+    inline double GetTolerance(size_t index) const { return Tolerances[index]; }
+    inline double GetOutputBelow(void) const { return OutputBelow; }
+    inline double GetOutputAbove(void) const { return OutputAbove; }
+    inline const std::string & GetEventNameAbove(size_t index) const { return EventNamesAbove[index]; }
+    inline const std::string & GetEventNameBelow(size_t index) const { return EventNamesBelow[index]; }
+    inline const OutputType & GetOutput(void) const { return Output; }
+    inline size_t GetNumberOfCrossings(void) const { return NumberOfCrossings; }
+
+    //! Returns true if signal was above threshold at last run
+    inline bool IsAbove(size_t index) const {
+        return ((Above[index / 64] >> (index % 64)) & 1) != 0;
+    }
+
+    /*! Returns human readable representation of this filter */
+    void ToStream(std::ostream & outputStream, bool verbose = true) const;
+
+    //! For filter factory
+    SC_DEFINE_FACTORY_CREATE(FilterThresholdBank);
+};
+
+};
+
+#endif // _FilterThresholdBank_h
@@ -0,0 +1,280 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _FilterVector_h
+#define _FilterVector_h
+
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "common/jsonwrapper.h"
+#include "safecass/filterBase.h"
+#include "safecass/paramEigen.h"
+
+namespace SC {
+
+/*!
+    Base class of filters that check all elements of vector signal at once
+
+    The input signal is of type ParamEigen<_vectorType>, where _vectorType is
+    a column vector of doubles, either dynamic-size (Eigen::VectorXd, the
+    default) or fixed-size (e.g., 6-DOF wrench as Eigen::Matrix<double, 6, 1>).
+    As FilterPipeline binds inputs to outputs of the same type only, the type
+    of the filter should match that of the upstream output.
+
+    Derived filters evaluate the input by Evaluate() as a single Eigen
+    expression per run, which Eigen fuses into one loop without temporaries
+    (unrolled for fixed-size vectors).  Limits of dynamic-size vectors are
+    sized when configured, so that runs do not allocate.
+
+        Output Y0 = measure of violation (see derived filters)
+
+    The onset event is generated when violation starts (or, in level-triggered
+    mode, at every run in violation), and the completion event when it ends.
+    Events are delivered by FilterBase::EmitEvent() as FilterEvent, with the
+    output as value and the elements in violation, if any, as bitmask.
+
+    JSON arguments common to derived filters:
+
+        "argument": {
+            "input_signal"    : "Wrench",
+            // number of elements (dynamic-size vectors only; optional if
+            // limits are given as arrays)
+            "dimension"       : 6,
+            "event_onset"     : "EVT_WRENCH",
+            "event_completion": "/EVT_WRENCH"
+        }
+*/
+template <class _vectorType = Eigen::VectorXd>
+class FilterVector: public FilterBase
+{
+public:
+    typedef _vectorType VectorType;
+    typedef ParamEigen<VectorType> ParamType;
+    typedef ParamEigen<double> OutputType;
+
+    typedef enum { VIOLATION_COMPLETION, VIOLATION_ONSET } EVENT_TYPE;
+
+    // Fixed-size vectorizable members are aligned by operator new of derived filters as well
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+protected:
+    //! Name of input signal
+    const std::string NameOfInputSignal;
+    //! Names of events generated
+    std::string EventNameOnset;
+    std::string EventNameCompletion;
+    //! Interned names of events generated
+    StringIDType EventIDOnset;
+    StringIDType EventIDCompletion;
+
+    //! Input signal object
+    ParamType Input;
+    //! Output signal object
+    OutputType Output;
+
+    //! Number of elements of input (-1 if any)
+    int Dimension;
+
+    //! Indices of elements in violation at the last run (filled by derived filters)
+    std::vector<int> Elements;
+
+    //! Violation at the last run
+    bool Violation;
+
+    //! Evaluate input, update output, and return if input is in violation
+    virtual bool Evaluate(const ParamType & input) = 0;
+
+    //! Set number of elements of input
+    void SetDimension(int dimension) {
+        Dimension = dimension;
+        if (dimension > 0)
+            Elements.reserve(dimension);
+    }
+
+    //! Read vector of Dimension elements from array or scalar (all elements) in JSON
+    /*!
+        If Dimension is not yet known, it is set to the size of array.
+        \return false if value is missing or of wrong size
+    */
+    bool ReadVector(const Json::Value & argument, const char * key, VectorType & vector) {
+        const Json::Value & value = argument[key];
+        if (value.isArray()) {
+            if (Dimension < 0)
+                SetDimension((int) value.size());
+            if ((int) value.size() != Dimension) {
+                SCLOG_ERROR << Name << ": \"" << key << "\" of size " << value.size()
+                            << ", expected " << Dimension << std::endl;
+                return false;
+            }
+            vector.resize(Dimension);
+            for (int i = 0; i < Dimension; ++i)
+                vector(i) = value[i].asDouble();
+            return true;
+        }
+        if (value.isNumeric() && Dimension >= 0) {
+            vector = VectorType::Constant(Dimension, value.asDouble());
+            return true;
+        }
+
+        SCLOG_ERROR << Name << ": invalid or missing \"" << key << "\"" << std::endl;
+        return false;
+    }
+
+    //! Set names of events generated
+    void SetEventNames(const std::string & onset, const std::string & completion) {
+        EventNameOnset = onset;
+        EventNameCompletion = completion;
+        EventIDOnset = StringTable::GetInstance()->Intern(onset);
+        EventIDCompletion = StringTable::GetInstance()->Intern(completion);
+    }
+
+    FilterEvent GenerateEvent(EVENT_TYPE eventType, TimestampType timestamp) const {
+        FilterEvent event = CreateEvent(eventType == VIOLATION_ONSET ? EventIDOnset : EventIDCompletion, timestamp);
+        event.Signal = InputSignals[0]->GetNameID();
+        event.AddPayload(Output.Val);
+        for (size_t i = 0; i < Elements.size(); ++i)
+            event.AddElement(Elements[i]);
+
+        return event;
+    }
+
+    //--------------------------------------------------
+    //  Methods required by the base class
+    //--------------------------------------------------
+    bool ConfigureFilter(const Json::Value & jsonNode) {
+        const Json::Value & argument = jsonNode["argument"];
+
+        if (argument.isMember("dimension")) {
+            const int dimension = argument["dimension"].asInt();
+            if (dimension <= 0 || (VectorType::SizeAtCompileTime != Eigen::Dynamic &&
+                                   dimension != VectorType::SizeAtCompileTime)) {
+                SCLOG_ERROR << Name << ": invalid dimension: " << dimension << std::endl;
+                return false;
+            }
+            SetDimension(dimension);
+        }
+
+        SetEventNames(argument["event_onset"].asString(), argument["event_completion"].asString());
+
+        return true;
+    }
+
+    bool InitFilter(void) {
+        Output.Val = 0.0;
+        Elements.clear();
+        Violation = false;
+
+        return true;
+    }
+
+    void RunFilter(void) {
+        if (!FilterBase::RefreshSamples())
+            return;
+
+        const ParamType & input = GetInputValue<ParamType>(0);
+        if (Dimension >= 0 && input.Val.size() != Dimension) {
+            SCLOG_ERROR << Name << ": input of size " << input.Val.size() << ", expected "
+                        << Dimension << ": " << *this << std::endl;
+            // Suppress further error messages due to the same issue
+            Enable(false);
+            return;
+        }
+
+        const bool violation = Evaluate(input);
+
+        FilterState = (violation ? FilterBase::STATE_DETECTED : FilterBase::STATE_ENABLED);
+
+        const bool level = (EventDetectionMode == FilterBase::EVENT_DETECTION_LEVEL);
+        if (violation && (level || !Violation))
+            EmitEvent(GenerateEvent(VIOLATION_ONSET, input.GetTimestamp()));
+        else if (!violation && Violation)
+            EmitEvent(GenerateEvent(VIOLATION_COMPLETION, input.GetTimestamp()));
+
+        Violation = violation;
+    }
+
+    void CleanupFilter(void) {}
+
+    //! Constructor with explicit arguments (dimension -1: any)
+    FilterVector(const std::string &                filterName,
+                 FilterBase::FilteringType          filteringType,
+                 const StateMachineInfo &           stateMachineInfo,
+                 const std::string &                inputSignalName,
+                 int                                dimension,
+                 const std::string &                eventNameOnset,
+                 const std::string &                eventNameCompletion,
+                 FilterBase::EventDetectionModeType eventDetectionMode)
+        : FilterBase(filterName, filteringType, stateMachineInfo, eventDetectionMode),
+          NameOfInputSignal(inputSignalName),
+          Output(0.0),
+          Dimension(-1),
+          Violation(false)
+    {
+        SetEventNames(eventNameOnset, eventNameCompletion);
+        InitializeSignals(dimension);
+    }
+
+    //! Constructor using JSON (derived filters call ConfigureFilter())
+    FilterVector(const std::string & filterName, const Json::Value & jsonNode)
+        : FilterBase(filterName, jsonNode),
+          NameOfInputSignal(jsonNode["argument"].get("input_signal", NONAME).asString()),
+          Output(0.0),
+          Dimension(-1),
+          Violation(false)
+    {
+        SetEventNames("", "");
+        InitializeSignals(-1);
+    }
+
+    void InitializeSignals(int dimension) {
+        if (VectorType::SizeAtCompileTime != Eigen::Dynamic)
+            dimension = VectorType::SizeAtCompileTime;
+        SetDimension(dimension);
+
+        SCASSERT(AddInputSignal(Input, NameOfInputSignal));
+        SCASSERT(AddOutputSignal(Output, GenerateOutputSignalName(NameOfInputSignal, Name, FilterID, 0)));
+    }
+
+public:
+    virtual ~FilterVector() {}
+
+    //! Getters
+    inline const std::string & GetNameOfInputSignal(void) const { return NameOfInputSignal; }
+    inline const std::string & GetEventNameOnset(void) const { return EventNameOnset; }
+    inline const std::string & GetEventNameCompletion(void) const { return EventNameCompletion; }
+    inline int GetDimension(void) const { return Dimension; }
+    inline const OutputType & GetOutput(void) const { return Output; }
+    //! Indices of elements in violation at the last run
+    inline const std::vector<int> & GetElements(void) const { return Elements; }
+    inline bool IsViolation(void) const { return Violation; }
+
+    /*! Returns human readable representation of this filter */
+    void ToStream(std::ostream & outputStream, bool verbose = true) const {
+        BaseType::ToStream(outputStream, verbose);
+
+        if (!verbose) {
+            outputStream << "dimension " << Dimension;
+            return;
+        }
+
+        outputStream << "----- Filter-specifics: " << std::endl
+                     << "Dimension  : " << Dimension << std::endl
+                     << "Onset      : " << EventNameOnset << std::endl
+                     << "Completion : " << EventNameCompletion << std::endl;
+    }
+};
+
+};
+
+#endif // _FilterVector_h
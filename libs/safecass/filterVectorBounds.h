@@ -0,0 +1,135 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _FilterVectorBounds_h
+#define _FilterVectorBounds_h
+
+#include "safecass/filterVector.h"
+
+namespace SC {
+
+/*!
+    Per-element bounds on vector signal, e.g., joint limits
+
+    Given lower bounds L and upper bounds U,
+
+        Output Y0 = number of elements i such that X[i] < L[i] or X[i] > U[i]
+        Violation if Y0 > 0
+
+    Elements that are NaN are considered within bounds.  Bounds are given as
+    arrays, or as numbers that apply to all elements.  See FilterVector for
+    common arguments.
+
+        "argument": {
+            "input_signal": "JointPosition",
+            "lower"       : [ -1.57, -0.8, 0.0, -3.14, -1.57, -1.57, 0.0 ],
+            "upper"       : [  1.57,  0.8, 0.2,  3.14,  1.57,  1.57, 1.0 ],
+            ...
+        }
+*/
+template <class _vectorType = Eigen::VectorXd>
+class FilterVectorBounds: public FilterVector<_vectorType>
+{
+public:
+    typedef FilterVector<_vectorType> VectorBaseType;
+    typedef typename VectorBaseType::VectorType VectorType;
+    typedef typename VectorBaseType::ParamType ParamType;
+
+protected:
+    VectorType Lower;
+    VectorType Upper;
+
+    bool Evaluate(const ParamType & input) {
+        const typename VectorType::Index count =
+            ((input.Val.array() < Lower.array()) || (input.Val.array() > Upper.array())).count();
+        this->Output.Val = (double) count;
+
+        // Elements in violation are looked up only if any
+        this->Elements.clear();
+        if (count == 0)
+            return false;
+        for (int i = 0; i < this->Dimension; ++i)
+            if (input.Val(i) < Lower(i) || input.Val(i) > Upper(i))
+                this->Elements.push_back(i);
+
+        return true;
+    }
+
+    bool ConfigureFilter(const Json::Value & jsonNode) {
+        if (!VectorBaseType::ConfigureFilter(jsonNode))
+            return false;
+
+        const Json::Value & argument = jsonNode["argument"];
+        // Array bound is read first, which sets dimension
+        if (argument["lower"].isArray()) {
+            if (!this->ReadVector(argument, "lower", Lower) || !this->ReadVector(argument, "upper", Upper))
+                return false;
+        } else {
+            if (!this->ReadVector(argument, "upper", Upper) || !this->ReadVector(argument, "lower", Lower))
+                return false;
+        }
+
+        return true;
+    }
+
+public:
+    //! Constructor with explicit arguments (lower and upper should be of the same size)
+    FilterVectorBounds(FilterBase::FilteringType          filteringType,
+                       const FilterBase::StateMachineInfo & stateMachineInfo,
+                       const std::string &                inputSignalName,
+                       const VectorType &                 lower,
+                       const VectorType &                 upper,
+                       const std::string &                eventNameOnset,
+                       const std::string &                eventNameCompletion,
+                       FilterBase::EventDetectionModeType eventDetectionMode = FilterBase::EVENT_DETECTION_EDGE)
+        : VectorBaseType(FilterVectorBounds::Name, filteringType, stateMachineInfo, inputSignalName, (int) lower.size(),
+                         eventNameOnset, eventNameCompletion, eventDetectionMode),
+          Lower(lower), Upper(upper)
+    {
+        SCASSERT(lower.size() == upper.size());
+    }
+
+    //! Constructor using JSON
+    FilterVectorBounds(const Json::Value & jsonNode)
+        : VectorBaseType(FilterVectorBounds::Name, jsonNode),
+          Lower(EigenDefault<VectorType>::Get()), Upper(EigenDefault<VectorType>::Get())
+    {
+        if (!ConfigureFilter(jsonNode)) {
+            SCLOG_ERROR << "FilterVectorBounds: invalid configuration: " << JsonWrapper::GetJsonString(jsonNode) << std::endl;
+            // Bounds of matching size so that the filter runs (or is disabled by input size)
+            this->SetDimension(this->Dimension < 0 ? 0 : this->Dimension);
+            Lower = Upper = VectorType::Zero(this->Dimension);
+        }
+    }
+
+    inline const VectorType & GetLower(void) const { return Lower; }
+    inline const VectorType & GetUpper(void) const { return Upper; }
+
+    /*! Returns human readable representation of this filter */
+    void ToStream(std::ostream & outputStream, bool verbose = true) const {
+        VectorBaseType::ToStream(outputStream, verbose);
+
+        if (verbose)
+            outputStream << "Lower      : " << Lower.transpose() << std::endl
+                         << "Upper      : " << Upper.transpose() << std::endl;
+    }
+
+    //! For filter factory
+    SC_DEFINE_FACTORY_CREATE(FilterVectorBounds);
+};
+
+template <class _vectorType>
+const std::string FilterVectorBounds<_vectorType>::Name = "FilterVectorBounds";
+
+};
+
+#endif // _FilterVectorBounds_h
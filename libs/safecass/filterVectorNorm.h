@@ -0,0 +1,128 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _FilterVectorNorm_h
+#define _FilterVectorNorm_h
+
+#include <cmath>
+
+#include "safecass/filterVector.h"
+
+namespace SC {
+
+/*!
+    Threshold on Euclidean norm of vector signal, e.g., magnitude of force
+
+    Given threshold T and tolerance t,
+
+        Output Y0 = norm of input X
+        Violation if |X| > (T + t)
+
+    The squared norm is compared against (T + t)^2, so that no square root is
+    taken to check the threshold.  The dimension of dynamic-size input is not
+    checked unless given.  See FilterVector for common arguments.
+
+        "argument": {
+            "input_signal": "Force",
+            "threshold"   : 10.0,
+            "tolerance"   : 0.5,
+            ...
+        }
+*/
+template <class _vectorType = Eigen::VectorXd>
+class FilterVectorNorm: public FilterVector<_vectorType>
+{
+public:
+    typedef FilterVector<_vectorType> VectorBaseType;
+    typedef typename VectorBaseType::ParamType ParamType;
+
+protected:
+    double Threshold;
+    double Tolerance;
+    //! (Threshold + Tolerance)^2
+    double Limit;
+
+    bool Evaluate(const ParamType & input) {
+        const double squaredNorm = input.Val.squaredNorm();
+        this->Output.Val = std::sqrt(squaredNorm);
+        return (squaredNorm > Limit);
+    }
+
+    bool ConfigureFilter(const Json::Value & jsonNode) {
+        if (!VectorBaseType::ConfigureFilter(jsonNode))
+            return false;
+
+        const Json::Value & argument = jsonNode["argument"];
+        if (!argument.isMember("threshold")) {
+            SCLOG_ERROR << this->Name << ": no threshold" << std::endl;
+            return false;
+        }
+        SetThreshold(argument["threshold"].asDouble(), argument.get("tolerance", 0.0).asDouble());
+
+        return true;
+    }
+
+public:
+    //! Constructor with explicit arguments
+    FilterVectorNorm(FilterBase::FilteringType          filteringType,
+                     const FilterBase::StateMachineInfo & stateMachineInfo,
+                     const std::string &                inputSignalName,
+                     double                             threshold,
+                     double                             tolerance,
+                     const std::string &                eventNameOnset,
+                     const std::string &                eventNameCompletion,
+                     FilterBase::EventDetectionModeType eventDetectionMode = FilterBase::EVENT_DETECTION_EDGE)
+        : VectorBaseType(FilterVectorNorm::Name, filteringType, stateMachineInfo, inputSignalName, -1,
+                         eventNameOnset, eventNameCompletion, eventDetectionMode)
+    {
+        SetThreshold(threshold, tolerance);
+    }
+
+    //! Constructor using JSON
+    FilterVectorNorm(const Json::Value & jsonNode)
+        : VectorBaseType(FilterVectorNorm::Name, jsonNode)
+    {
+        SetThreshold(0.0, 0.0);
+
+        if (!ConfigureFilter(jsonNode))
+            SCLOG_ERROR << "FilterVectorNorm: invalid configuration: " << JsonWrapper::GetJsonString(jsonNode) << std::endl;
+    }
+
+    void SetThreshold(double threshold, double tolerance) {
+        Threshold = threshold;
+        Tolerance = tolerance;
+        // Negative limit: any norm is in violation
+        Limit = (threshold + tolerance < 0.0 ? -1.0 : (threshold + tolerance) * (threshold + tolerance));
+    }
+
+    inline double GetThreshold(void) const { return Threshold; }
+    inline double GetTolerance(void) const { return Tolerance; }
+
+    /*! Returns human readable representation of this filter */
+    void ToStream(std::ostream & outputStream, bool verbose = true) const {
+        VectorBaseType::ToStream(outputStream, verbose);
+
+        if (verbose)
+            outputStream << "Threshold  : " << Threshold << std::endl
+                         << "Tolerance  : " << Tolerance << std::endl;
+    }
+
+    //! For filter factory
+    SC_DEFINE_FACTORY_CREATE(FilterVectorNorm);
+};
+
+template <class _vectorType>
+const std::string FilterVectorNorm<_vectorType>::Name = "FilterVectorNorm";
+
+};
+
+#endif // _FilterVectorNorm_h
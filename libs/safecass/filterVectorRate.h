@@ -0,0 +1,149 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _FilterVectorRate_h
+#define _FilterVectorRate_h
+
+#include <cmath>
+
+#include "safecass/filterVector.h"
+
+namespace SC {
+
+/*!
+    Per-element rate limits on vector signal, e.g., joint velocity limits
+
+    Given rate limits R (per second) and samples X, X' at the current and
+    previous runs, dt seconds apart (from timestamps of samples),
+
+        Output Y0 = number of elements i such that |X[i] - X'[i]| > R[i] * dt
+        Violation if Y0 > 0
+
+    The first sample and samples with the same timestamp as the previous one
+    only update the previous sample.  Rate limits are given as an array, or
+    as a number that applies to all elements.  See FilterVector for common
+    arguments.
+
+        "argument": {
+            "input_signal": "JointPosition",
+            "rate_limit"  : [ 1.0, 1.0, 0.5, 2.0, 2.0, 2.0, 1.0 ],
+            ...
+        }
+*/
+template <class _vectorType = Eigen::VectorXd>
+class FilterVectorRate: public FilterVector<_vectorType>
+{
+public:
+    typedef FilterVector<_vectorType> VectorBaseType;
+    typedef typename VectorBaseType::VectorType VectorType;
+    typedef typename VectorBaseType::ParamType ParamType;
+
+protected:
+    //! Rate limits (per second)
+    VectorType Limit;
+
+    //! Sample at previous run
+    VectorType Previous;
+    TimestampType PreviousTimestamp;
+    bool HasPrevious;
+
+    bool Evaluate(const ParamType & input) {
+        const TimestampType timestamp = input.GetTimestamp();
+        if (HasPrevious && timestamp <= PreviousTimestamp)
+            return this->Violation;
+
+        typename VectorType::Index count = 0;
+        this->Elements.clear();
+        if (HasPrevious) {
+            const double dt = (timestamp - PreviousTimestamp) * 1e-9;
+            count = ((input.Val - Previous).array().abs() > Limit.array() * dt).count();
+
+            // Elements in violation are looked up only if any
+            for (int i = 0; count && i < this->Dimension; ++i)
+                if (std::abs(input.Val(i) - Previous(i)) > Limit(i) * dt)
+                    this->Elements.push_back(i);
+        }
+        this->Output.Val = (double) count;
+
+        Previous = input.Val;
+        PreviousTimestamp = timestamp;
+        HasPrevious = true;
+
+        return (count > 0);
+    }
+
+    bool ConfigureFilter(const Json::Value & jsonNode) {
+        if (!VectorBaseType::ConfigureFilter(jsonNode))
+            return false;
+
+        if (!this->ReadVector(jsonNode["argument"], "rate_limit", Limit))
+            return false;
+        Previous = VectorType::Zero(this->Dimension);
+
+        return true;
+    }
+
+    bool InitFilter(void) {
+        HasPrevious = false;
+
+        return VectorBaseType::InitFilter();
+    }
+
+public:
+    //! Constructor with explicit arguments
+    FilterVectorRate(FilterBase::FilteringType          filteringType,
+                     const FilterBase::StateMachineInfo & stateMachineInfo,
+                     const std::string &                inputSignalName,
+                     const VectorType &                 limit,
+                     const std::string &                eventNameOnset,
+                     const std::string &                eventNameCompletion,
+                     FilterBase::EventDetectionModeType eventDetectionMode = FilterBase::EVENT_DETECTION_EDGE)
+        : VectorBaseType(FilterVectorRate::Name, filteringType, stateMachineInfo, inputSignalName, (int) limit.size(),
+                         eventNameOnset, eventNameCompletion, eventDetectionMode),
+          Limit(limit), Previous(VectorType::Zero(limit.size())), PreviousTimestamp(0), HasPrevious(false)
+    {
+    }
+
+    //! Constructor using JSON
+    FilterVectorRate(const Json::Value & jsonNode)
+        : VectorBaseType(FilterVectorRate::Name, jsonNode),
+          Limit(EigenDefault<VectorType>::Get()), Previous(EigenDefault<VectorType>::Get()),
+          PreviousTimestamp(0), HasPrevious(false)
+    {
+        if (!ConfigureFilter(jsonNode)) {
+            SCLOG_ERROR << "FilterVectorRate: invalid configuration: " << JsonWrapper::GetJsonString(jsonNode) << std::endl;
+            // Limits of matching size so that the filter runs (or is disabled by input size)
+            this->SetDimension(this->Dimension < 0 ? 0 : this->Dimension);
+            Limit = Previous = VectorType::Zero(this->Dimension);
+        }
+    }
+
+    inline const VectorType & GetLimit(void) const { return Limit; }
+
+    /*! Returns human readable representation of this filter */
+    void ToStream(std::ostream & outputStream, bool verbose = true) const {
+        VectorBaseType::ToStream(outputStream, verbose);
+
+        if (verbose)
+            outputStream << "Rate limit : " << Limit.transpose() << std::endl;
+    }
+
+    //! For filter factory
+    SC_DEFINE_FACTORY_CREATE(FilterVectorRate);
+};
+
+template <class _vectorType>
+const std::string FilterVectorRate<_vectorType>::Name = "FilterVectorRate";
+
+};
+
+#endif // _FilterVectorRate_h
@@ -7,7 +7,7 @@
 //-----------------------------------------------------------------------------------
 //
 // Created on   : Mar 15, 2016
-// Last revision: Apr 12, 2016
+// Last revision: Oct 17, 2026
 // Author       : Min Yang Jung <myj@jhu.edu>
 // Github       : https://github.com/safecass/safecass
 //
@@ -16,13 +16,49 @@
 
 #include <vector>
 #include <map>
+#include <cmath>
+#include <boost/type_traits/is_integral.hpp>
 
 #include "common/common.h"
+#include "common/stringTable.h"
 #include "safecass/historyBufferBase.h"
 #include "safecass/signalAccessor.h"
+#include "safecass/compressedSignalAccessor.h"
+#include "safecass/signalHandle.h"
 
 namespace SC {
 
+//! Linear interpolation between two samples
+/*!
+    Defined for numeric types and Eigen types only.  For other types (e.g.,
+    std::vector), Compute() returns false.
+*/
+template <typename T, bool num = (IsNum<T>::Yes == 1), bool eigen = is_eigen_matrix<T>::value>
+struct LinearInterpolation {
+    static bool Compute(const T & /*a*/, const T & /*b*/, double /*ratio*/, T & /*result*/) {
+        return false;
+    }
+};
+
+template <typename T>
+struct LinearInterpolation<T, true, false> {
+    static bool Compute(const T & a, const T & b, double ratio, T & result) {
+        // Compute in double such that (b - a) does not wrap for unsigned types
+        const double value = static_cast<double>(a) * (1.0 - ratio) + static_cast<double>(b) * ratio;
+        result = static_cast<T>(boost::is_integral<T>::value ? std::floor(value + 0.5) : value);
+        return true;
+    }
+};
+
+template <typename T>
+struct LinearInterpolation<T, false, true> {
+    static bool Compute(const T & a, const T & b, double ratio, T & result) {
+        result = (a.template cast<double>() * (1.0 - ratio) +
+                  b.template cast<double>() * ratio).template cast<typename T::Scalar>();
+        return true;
+    }
+};
+
 /*!
 
     Design considerations:
@@ -87,15 +123,35 @@ public:
     //! Typedef of base type
     typedef HistoryBufferBase BaseType;
 
+    //! Typedef of lookup modes for GetValueAt()
+    typedef enum {
+        LOOKUP_NEAREST,    /*!< Sample taken by the snapshot nearest to timestamp */
+        LOOKUP_PREVIOUS,   /*!< Latest sample taken at or before timestamp */
+        LOOKUP_INTERPOLATE /*!< Linear interpolation of two samples around timestamp */
+    } LookupModeType;
+
+    //! Typedef of timestamp column
+    typedef boost::circular_buffer<SC::TimestampType> TimestampsType;
+
+    //! Typedef of export formats for Serialize() and Deserialize()
+    typedef enum {
+        FORMAT_TEXT,   /*!< Human readable text (export only) */
+        FORMAT_BINARY, /*!< Binary: schema header followed by one block per signal */
+        FORMAT_CSV     /*!< Comma-separated values: one row per snapshot */
+    } FormatType;
+
 protected:
     //! Typedef of vector containing a set of signal accessors
     typedef std::vector<SignalAccessorBase *> SignalAccessorsType;
 
-    //! Typedef of map for look up (key: name of signal, value: signal index in SignalAccessors)
-    typedef std::map<BaseType::IDType, BaseType::IndexType> SignalAccessorsMapType;
+    //! Typedef of map for look up (key: interned name of signal, value: signal index in SignalAccessors)
+    typedef HashMap<StringIDType, BaseType::IndexType> SignalAccessorsMapType;
 
-    //! Size of each signal accessor (i.e., length of underlying circular buffer)
-    const size_t BufferSize;
+    //! Default depth of signal accessors (i.e., length of underlying circular buffer)
+    /*!
+        Signals can have depths different from this (see AddSignal()).
+    */
+    size_t BufferSize;
 
     //! Index of snapshot in the table
     BaseType::IndexType SnapshotIndex;
@@ -104,8 +160,125 @@ protected:
     SignalAccessorsType SignalAccessors;
 
     //! Map for signal index lookup using signal name
+    /*!
+        Names of signals are interned in the process-wide string table (see
+        StringTable::GetInstance()).
+    */
     SignalAccessorsMapType SignalAccessorsMap;
 
+    //! Timestamps of snapshots (monotonic; shared by all signal accessors)
+    /*!
+        Signal accessors and this column are pushed together at every snapshot,
+        and thus the i-th latest sample of any signal accessor was taken by the
+        snapshot of the i-th latest timestamp.  Capacity of this column is the
+        max depth of signal accessors (see UpdateTimestampsCapacity()).
+    */
+    TimestampsType SnapshotTimestamps;
+
+    //! Returns signal accessor of the type specified (0 if index or type is invalid)
+    template<typename _type>
+    const SignalAccessor<ParamEigen<_type> > * GetSignalAccessor(const BaseType::IndexType & index) const
+    {
+        if (index == BaseType::INVALID_SIGNAL_INDEX || index >= (BaseType::IndexType) SignalAccessors.size()) {
+            SCLOG_WARNING << "Invalid signal index: " << index << std::endl;
+            return 0;
+        }
+
+        const SignalAccessor<ParamEigen<_type> > * accessor =
+            dynamic_cast<const SignalAccessor<ParamEigen<_type> > *>(SignalAccessors[index]);
+        if (!accessor)
+            SCLOG_WARNING << "Type mismatch: \"" << SignalAccessors[index]->GetSignalName() << "\"" << std::endl;
+
+        return accessor;
+    }
+
+    template<typename _type>
+    SignalAccessor<ParamEigen<_type> > * GetSignalAccessor(const BaseType::IndexType & index)
+    {
+        const HistoryBuffer * self = this;
+        return const_cast<SignalAccessor<ParamEigen<_type> > *>(self->GetSignalAccessor<_type>(index));
+    }
+
+    //! Returns number of latest samples of the accessor taken at or after t0 and at or before t1
+    /*!
+        \param accessorSize Number of samples in signal accessor
+        \param t0 Beginning of time range
+        \param t1 End of time range
+        \param begin Index of oldest sample in time range (0: oldest sample in accessor)
+        \param count Number of samples in time range
+    */
+    void FindTimeRange(size_t accessorSize, SC::TimestampType t0, SC::TimestampType t1,
+                       size_t & begin, size_t & count) const;
+
+    //! Finds latest sample of the accessor taken at or before time t
+    /*!
+        Snapshots are typically taken periodically, and thus timestamps are
+        nearly evenly spaced.  This method uses interpolation search, which
+        takes O(log log n) in such cases, and falls back to bisection whenever
+        an interpolation step does not halve the search range, which bounds
+        the worst case to O(log n).
+
+        \param accessorSize Number of samples in signal accessor
+        \param t Timestamp to look up
+        \param index Index of sample found (0: oldest sample in accessor)
+        \return false if all samples were taken after t (or no sample)
+    */
+    bool FindPrevious(size_t accessorSize, SC::TimestampType t, size_t & index) const;
+
+    //! Adjusts capacity of SnapshotTimestamps to the deepest signal accessor
+    /*!
+        Latest timestamps are kept, and thus alignment of samples and
+        timestamps is preserved.
+    */
+    void UpdateTimestampsCapacity(void);
+
+    //! Appends timestamp to SnapshotTimestamps
+    /*!
+        Timestamp lookups (FindTimeRange(), FindPrevious()) require snapshot
+        timestamps to be non-decreasing.  A timestamp earlier than the latest
+        one (e.g., wall clock stepped backwards) is clamped to the latest one.
+    */
+    void PushSnapshotTimestamp(SC::TimestampType timestamp);
+
+    //! Removes all samples and snapshot timestamps, and resets snapshot index
+    void ClearSamples(void);
+
+    //! Export and import in specific formats (see Serialize())
+    bool SerializeBinary(std::ostream & os) const;
+    bool SerializeCsv(std::ostream & os) const;
+    bool DeserializeBinary(std::istream & is);
+    bool DeserializeCsv(std::istream & is);
+
+    //! Typedef of vector containing signal accessor groups
+    typedef std::vector<SignalAccessorGroupBase *> SignalAccessorGroupsType;
+
+    //! Signal accessors grouped by type of signal (used by Snapshot())
+    SignalAccessorGroupsType SignalAccessorGroups;
+
+    //! Returns signal accessor group of the type specified (created if not found)
+    template<class _groupType>
+    _groupType * GetSignalAccessorGroup(void)
+    {
+        _groupType * group;
+        for (size_t i = 0; i < SignalAccessorGroups.size(); ++i) {
+            group = dynamic_cast<_groupType *>(SignalAccessorGroups[i]);
+            if (group)
+                return group;
+        }
+
+        group = new _groupType;
+        SignalAccessorGroups.push_back(group);
+
+        return group;
+    }
+
+    //! Registers new signal accessor under name and returns its index
+    /*!
+        History buffer takes ownership of accessor.  The caller adds accessor
+        to its signal accessor group.
+    */
+    BaseType::IndexType RegisterSignalAccessor(SignalAccessorBase * accessor, StringIDType nameId);
+
 public:
     //! Constructor
     /*!
@@ -134,15 +307,131 @@ public:
     */
     virtual bool GetNewValue(const BaseType::IndexType & index, ParamBase & arg) const;
 
-    //! Push value to history buffer
-    // FIXME
-    // PushNewValue() requries more thoughts on deep fault injection
-    // - Should HistoryBuffer enable push of a series of value only?
-    // - Or, pushing a set of values at specified timestamp?
     //
-    // For now, take simple solution: value only without consideration of timestamp
+    // Deep fault injection
+    //
+    // Samples of signal accessors are aligned with snapshot timestamps (see
+    // SnapshotTimestamps), and thus injected values replace samples of existing
+    // snapshots in place, rather than being appended.  Injection takes no lock;
+    // like Snapshot(), it must be called by the thread that owns this history
+    // buffer.  If injection fails, no sample is modified.
+    //
+    //! Push value to history buffer: replaces latest sample of signal
+    /*!
+        Value, validity, and timestamp of arg are copied as they are.
+        \return false if signal index or type is invalid, or no sample is available
+    */
     virtual bool PushNewValue(const IndexType & index, const ParamBase & arg);
 
+    //! Push value to history buffer at timestamp
+    /*!
+        Replaces the sample taken by the latest snapshot at or before timestamp.
+        Timestamp of the sample is set to timestamp.
+        \return false if signal index or type is invalid, or timestamp is earlier
+                than the oldest sample
+    */
+    bool PushNewValue(const IndexType & index, const ParamBase & arg, SC::TimestampType timestamp);
+
+    //! Push burst of values to history buffer
+    /*!
+        Replaces the latest values.size() samples of signal: values[0] replaces
+        the oldest of them, and the last value replaces the latest sample.
+        \return false if signal index or type is invalid, or signal has fewer
+                samples than values
+    */
+    template<typename _type, typename _alloc>
+    bool PushNewValues(const IndexType & index, const std::vector<ParamEigen<_type>, _alloc> & values)
+    {
+        SignalAccessor<ParamEigen<_type> > * accessor = GetSignalAccessor<_type>(index);
+        if (!accessor)
+            return false;
+
+        const size_t n = accessor->GetContainerSize();
+        if (values.size() > n) {
+            SCLOG_WARNING << "PushNewValues: " << values.size() << " values for " << n << " samples of signal \""
+                          << accessor->GetSignalName() << "\"" << std::endl;
+            return false;
+        }
+
+        const size_t offset = n - values.size();
+        for (size_t i = 0; i < values.size(); ++i)
+            accessor->SetSample(offset + i, values[i]);
+
+        return true;
+    }
+
+    //! Push burst of packed values to history buffer (see PackedParam)
+    /*!
+        Same as PushNewValues() above, but values are kept in compact form
+        until they are written in place to the samples of signal.
+    */
+    template<typename _type, typename _alloc>
+    bool PushNewValues(const IndexType & index, const std::vector<PackedParam<_type>, _alloc> & values)
+    {
+        SignalAccessor<ParamEigen<_type> > * accessor = GetSignalAccessor<_type>(index);
+        if (!accessor)
+            return false;
+
+        const size_t n = accessor->GetContainerSize();
+        if (values.size() > n) {
+            SCLOG_WARNING << "PushNewValues: " << values.size() << " values for " << n << " samples of signal \""
+                          << accessor->GetSignalName() << "\"" << std::endl;
+            return false;
+        }
+
+        const size_t offset = n - values.size();
+        for (size_t i = 0; i < values.size(); ++i)
+            accessor->SetPacked(offset + i, values[i]);
+
+        return true;
+    }
+
+    //! Push burst of values to history buffer at timestamps
+    /*!
+        values[i] replaces the sample taken by the latest snapshot at or before
+        timestamps[i], and timestamp of the sample is set to timestamps[i].  If
+        more than one value maps to the same sample, the last one is kept.
+        \return false if signal index or type is invalid, sizes of values and
+                timestamps differ, or any timestamp is earlier than the oldest sample
+    */
+    template<typename _type, typename _alloc>
+    bool PushNewValues(const IndexType & index, const std::vector<ParamEigen<_type>, _alloc> & values,
+                       const std::vector<SC::TimestampType> & timestamps)
+    {
+        SignalAccessor<ParamEigen<_type> > * accessor = GetSignalAccessor<_type>(index);
+        if (!accessor)
+            return false;
+
+        if (values.size() != timestamps.size()) {
+            SCLOG_WARNING << "PushNewValues: " << values.size() << " values for "
+                          << timestamps.size() << " timestamps" << std::endl;
+            return false;
+        }
+
+        // Resolve all samples first so that nothing is modified on failure
+        const size_t n = accessor->GetContainerSize();
+        std::vector<size_t> samples(values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (!FindPrevious(n, timestamps[i], samples[i])) {
+                SCLOG_WARNING << "PushNewValues: no sample of signal \"" << accessor->GetSignalName()
+                              << "\" at or before timestamp " << timestamps[i] << std::endl;
+                return false;
+            }
+        }
+
+        if (values.empty())
+            return true;
+
+        ParamEigen<_type> value(values[0]);
+        for (size_t i = 0; i < values.size(); ++i) {
+            value = values[i];
+            value.SetTimestamp(timestamps[i]);
+            accessor->SetSample(samples[i], value);
+        }
+
+        return true;
+    }
+
     //
     // Interfaces to manage signals
     //
@@ -154,51 +443,409 @@ public:
     /*!
         \param name Name of signal
         \param accessor SignalAccessor(Base) instance
-        \return random accessible index of the signal accessor if successful.
-                HistoryBufferBase::INVALID_SIGNAL_INDEX otherwise.
+        \param depth Number of samples to keep for this signal (0: buffer size).
+                     Slots are allocated up front, and thus slow signals (e.g.,
+                     status flags) can save memory with shallow history.
+        \return typed handle to the signal (see SignalHandle), which converts
+                implicitly to the random accessible index of the signal accessor.
+                The handle is invalid and its index is
+                HistoryBufferBase::INVALID_SIGNAL_INDEX if this method fails.
     */
     template<typename _type>
-    BaseType::IndexType AddSignal(const ParamEigen<_type> & arg, const BaseType::IDType & name)
+    SignalHandle<_type> AddSignal(const ParamEigen<_type> & arg, const BaseType::IDType & name,
+                                  size_t depth = 0)
     {
         // Check duplicate name
-        if (FindSignal(name)) {
+        const StringIDType nameId = StringTable::GetInstance()->Intern(name);
+        if (FindSignal(nameId)) {
             SCLOG_ERROR << "AddSignal() failed: duplicate name \"" << name << "\"" << std::endl;
-            return BaseType::INVALID_SIGNAL_INDEX;
+            return SignalHandle<_type>();
         }
 
         typedef ParamEigen<_type> ParamType;
-        SignalAccessor<ParamType> * accessor = new SignalAccessor<ParamType>(arg, name, BufferSize);
+        SignalAccessor<ParamType> * accessor =
+            new SignalAccessor<ParamType>(arg, name, (depth == 0 ? BufferSize : depth));
 
-        BaseType::IndexType accessorId = (BaseType::IndexType) SignalAccessors.size();
+        const BaseType::IndexType accessorId = RegisterSignalAccessor(accessor, nameId);
 
-        SignalAccessors.push_back(accessor);
-        SignalAccessorsMap.insert(std::make_pair(name, accessorId));
+        // Type of signal is resolved here once so that Snapshot() does not
+        // need run-time type checks
+        GetSignalAccessorGroup<SignalAccessorGroup<ParamType> >()->Add(accessor);
 
-        SCLOG_INFO << "Created accessor (id=" << accessorId << "): " << *accessor << std::endl;
+        return SignalHandle<_type>(accessor, accessorId);
+    }
+
+    //! Add signal whose history is kept compressed
+    /*!
+        Same as AddSignal() but samples are compressed losslessly (see
+        compression.h and CompressedSignalAccessor), which suits long histories
+        of slowly varying signals.  Only integral types, float, and double are
+        supported.  Samples are decompressed on read: GetNewValue(), deep fault
+        injection, and serialization work as for other signals, and typed reads
+        are available through GetCompressedSignalAccessor().  Windows,
+        reductions, and signal handles are not available.
+
+        \return index of the signal (HistoryBufferBase::INVALID_SIGNAL_INDEX if
+                this method fails)
+    */
+    template<typename _type>
+    BaseType::IndexType AddCompressedSignal(const ParamEigen<_type> & arg, const BaseType::IDType & name,
+                                            size_t depth = 0)
+    {
+        const StringIDType nameId = StringTable::GetInstance()->Intern(name);
+        if (FindSignal(nameId)) {
+            SCLOG_ERROR << "AddCompressedSignal() failed: duplicate name \"" << name << "\"" << std::endl;
+            return BaseType::INVALID_SIGNAL_INDEX;
+        }
+
+        typedef CompressedSignalAccessor<_type> AccessorType;
+        AccessorType * accessor = new AccessorType(arg, name, (depth == 0 ? BufferSize : depth));
+
+        const BaseType::IndexType accessorId = RegisterSignalAccessor(accessor, nameId);
+
+        GetSignalAccessorGroup<SignalAccessorGroup<ParamEigen<_type>, AccessorType> >()->Add(accessor);
 
         return accessorId;
     }
 
+    //! Returns accessor of compressed signal (0 if index is invalid, or signal is not compressed or of different type)
+    template<typename _type>
+    const CompressedSignalAccessor<_type> * GetCompressedSignalAccessor(const BaseType::IndexType & index) const
+    {
+        if (index == BaseType::INVALID_SIGNAL_INDEX || index >= (BaseType::IndexType) SignalAccessors.size())
+            return 0;
+        return dynamic_cast<const CompressedSignalAccessor<_type> *>(SignalAccessors[index]);
+    }
+
+    //! Returns typed handle to signal (invalid handle if index or type is invalid)
+    /*!
+        Type of signal is checked once here, rather than at every read.
+    */
+    template<typename _type>
+    SignalHandle<_type> GetSignalHandle(const BaseType::IndexType & index)
+    {
+        SignalAccessor<ParamEigen<_type> > * accessor = GetSignalAccessor<_type>(index);
+        if (!accessor)
+            return SignalHandle<_type>();
+        return SignalHandle<_type>(accessor, index);
+    }
+    template<typename _type>
+    SignalHandle<_type> GetSignalHandle(const BaseType::IDType & id) {
+        return GetSignalHandle<_type>(GetSignalIndex(id));
+    }
+
     //! Find signal using signal name
     bool FindSignal(const BaseType::IDType & id) const;
+    //! Find signal using interned signal name (see StringTable)
+    bool FindSignal(StringIDType nameId) const;
 
     //! Take new snapshot of all signals
+    /*!
+        Signals are copied group by group, i.e., one virtual call per type of
+        signal followed by a non-virtual loop over signals of that type.
+    */
     void Snapshot(void);
 
+    //! Take new snapshot of all signals with the timestamp given
+    /*!
+        Same as Snapshot() but does not read the clock (see HistoryBufferGroup,
+        which snapshots several history buffers with one timestamp).  If
+        timestamp is earlier than that of the latest snapshot, the latest
+        timestamp is used instead such that timestamps are non-decreasing.
+    */
+    void Snapshot(SC::TimestampType timestamp);
+
+    //
+    // Depth of history
+    //
+    // Depths can change at run-time.  The latest samples are kept when
+    // shrinking, and samples remain aligned with snapshot timestamps.
+    //
+    //! Change depth of signal
+    /*!
+        \return false if signal index is invalid or depth is zero
+    */
+    bool SetSignalDepth(const BaseType::IndexType & index, size_t depth);
+
+    //! Change depth of all signals and default depth of signals added later
+    /*!
+        \return false if bufferSize is zero
+    */
+    bool SetBufferSize(size_t bufferSize);
+
+    //! Returns depth of signal (0 if signal index is invalid)
+    size_t GetSignalDepth(const BaseType::IndexType & index) const;
+
+    //! Returns estimated memory usage of this history buffer in bytes
+    size_t GetMemoryUsage(void) const;
+
+    //! Returns compression ratio of signal (1 if not compressed, 0 if signal index is invalid)
+    /*!
+        \sa CompressedColumn::GetCompressionRatio()
+    */
+    double GetCompressionRatio(const BaseType::IndexType & index) const;
+
+    //! Prints memory usage of each signal and total memory usage
+    /*!
+        \param budget Memory budget in bytes (0: no budget).  If total memory
+                      usage exceeds budget, the report says so.
+        \return false if total memory usage exceeds budget
+    */
+    bool ReportMemoryUsage(std::ostream & os, size_t budget = 0) const;
+
     //
     // Getters
     //
+    //! Returns default depth of signals
     inline size_t GetBufferSize(void) const                 { return BufferSize; }
     inline size_t GetNumberOfSignals(void) const            { return SignalAccessors.size(); }
     inline BaseType::IndexType GetSnapshotIndex(void) const { return SnapshotIndex; }
 
     BaseType::IndexType GetSignalIndex(const BaseType::IDType & id) const;
+    //! Returns index of signal using interned signal name (no string hashing)
+    BaseType::IndexType GetSignalIndex(StringIDType nameId) const;
 
-    //! Export content of table
+    //! Returns timestamps of snapshots (oldest first)
+    inline const TimestampsType & GetSnapshotTimestamps(void) const { return SnapshotTimestamps; }
+
+    //! Returns timestamp of the latest snapshot (0 if no snapshot)
+    inline SC::TimestampType GetSnapshotTimestamp(void) const {
+        return (SnapshotTimestamps.empty() ? 0 : SnapshotTimestamps.back());
+    }
+
+    //
+    // Window queries (zero-copy)
+    //
+    // Windows refer to samples in history buffer and remain valid until the
+    // next snapshot.  Type of window must match type of signal.
+    //
+    //! Get window of last n samples
+    /*!
+        If less than n samples are available, all samples are returned.
+        \return false if signal index or type is invalid
+    */
+    template<typename _type>
+    bool GetLastN(const BaseType::IndexType & index, size_t n,
+                  SignalWindow<ParamEigen<_type> > & window) const
+    {
+        const SignalAccessor<ParamEigen<_type> > * accessor = GetSignalAccessor<_type>(index);
+        if (!accessor)
+            return false;
+
+        accessor->GetLastN(n, window);
+
+        return true;
+    }
+
+    //! Get window of samples taken by snapshots at or after time t
+    /*!
+        \return false if signal index or type is invalid
+    */
+    template<typename _type>
+    bool GetSince(const BaseType::IndexType & index, SC::TimestampType t,
+                  SignalWindow<ParamEigen<_type> > & window) const
+    {
+        return GetRange(index, t, GetSnapshotTimestamp(), window);
+    }
+
+    //! Get window of samples taken by snapshots in time range [t0, t1]
+    /*!
+        \return false if signal index or type is invalid
+    */
+    template<typename _type>
+    bool GetRange(const BaseType::IndexType & index, SC::TimestampType t0, SC::TimestampType t1,
+                  SignalWindow<ParamEigen<_type> > & window) const
+    {
+        const SignalAccessor<ParamEigen<_type> > * accessor = GetSignalAccessor<_type>(index);
+        if (!accessor)
+            return false;
+
+        size_t begin, count;
+        FindTimeRange(accessor->GetContainerSize(), t0, t1, begin, count);
+
+        return accessor->GetWindow(begin, count, window);
+    }
+
+    //! Get value of signal at time t
+    /*!
+        Looks up snapshot timestamps in O(log n) (see FindPrevious()), which
+        requires snapshot timestamps to be non-decreasing.  Snapshot() keeps
+        them so by clamping timestamps that go backwards.
+
+        - LOOKUP_NEAREST: sample of the snapshot nearest to t
+        - LOOKUP_PREVIOUS: latest sample taken at or before t
+        - LOOKUP_INTERPOLATE: linear interpolation of the two samples around t.
+          Timestamp of arg is set to t, and arg is valid only if both samples
+          are valid.  Not available for non-numeric types.  If t is later than
+          the latest snapshot, the latest sample is returned (no extrapolation).
+
+        \return false if signal index or type is invalid, no sample is
+                available, or t is earlier than the oldest sample (except for
+                LOOKUP_NEAREST)
+    */
+    template<typename _type>
+    bool GetValueAt(const BaseType::IndexType & index, SC::TimestampType t,
+                    ParamEigen<_type> & arg, LookupModeType mode = LOOKUP_PREVIOUS) const
+    {
+        typedef SignalAccessor<ParamEigen<_type> > AccessorType;
+        const AccessorType * accessor = GetSignalAccessor<_type>(index);
+        if (!accessor)
+            return false;
+
+        const size_t n = accessor->GetContainerSize();
+        if (n == 0)
+            return false;
+
+        const typename AccessorType::ContainerType & samples = *accessor->Container;
+        const size_t offset = SnapshotTimestamps.size() - n;
+
+        size_t i;
+        if (!FindPrevious(n, t, i)) {
+            if (mode != LOOKUP_NEAREST)
+                return false;
+            arg = samples[0];
+            return true;
+        }
+
+        // t is later than or equal to the timestamp of the last sample
+        if (i == n - 1) {
+            arg = samples[i];
+            return true;
+        }
+
+        const SC::TimestampType tPrev = SnapshotTimestamps[offset + i];
+        const SC::TimestampType tNext = SnapshotTimestamps[offset + i + 1];
+
+        switch (mode) {
+        case LOOKUP_PREVIOUS:
+            arg = samples[i];
+            break;
+        case LOOKUP_NEAREST:
+            arg = ((t - tPrev) <= (tNext - t) ? samples[i] : samples[i + 1]);
+            break;
+        case LOOKUP_INTERPOLATE:
+            {
+                const double ratio = (tNext == tPrev ? 0.0 : (double)(t - tPrev) / (double)(tNext - tPrev));
+                if (!LinearInterpolation<_type>::Compute(samples[i].Val, samples[i + 1].Val, ratio, arg.Val)) {
+                    SCLOG_WARNING << "GetValueAt: interpolation not supported for signal \""
+                                  << accessor->GetSignalName() << "\"" << std::endl;
+                    return false;
+                }
+                arg.SetValid(samples[i].IsValid() && samples[i + 1].IsValid());
+                arg.SetTimestamp(t);
+            }
+            break;
+        }
+
+        return true;
+    }
+
+    //! Window queries using signal id
+    template<typename _type>
+    bool GetLastN(const BaseType::IDType & id, size_t n, SignalWindow<ParamEigen<_type> > & window) const {
+        return GetLastN(GetSignalIndex(id), n, window);
+    }
+    template<typename _type>
+    bool GetSince(const BaseType::IDType & id, SC::TimestampType t, SignalWindow<ParamEigen<_type> > & window) const {
+        return GetSince(GetSignalIndex(id), t, window);
+    }
+    template<typename _type>
+    bool GetRange(const BaseType::IDType & id, SC::TimestampType t0, SC::TimestampType t1,
+                  SignalWindow<ParamEigen<_type> > & window) const {
+        return GetRange(GetSignalIndex(id), t0, t1, window);
+    }
+    template<typename _type>
+    bool GetValueAt(const BaseType::IDType & id, SC::TimestampType t,
+                    ParamEigen<_type> & arg, LookupModeType mode = LOOKUP_PREVIOUS) const {
+        return GetValueAt(GetSignalIndex(id), t, arg, mode);
+    }
+
+    //
+    // Reductions over windows (numeric signals only)
     //
-    // TODO: serialization and deserialization of *this with support for
-    // for different export format (raw, human readable, csv, ..)
-    void Serialize(std::ostream & os) const;
+    // Values of samples are strided in memory, and thus reductions run scalar
+    // loops over samples in place (see Reduction::ReduceSamples()).
+    // HistoryBufferColumnar keeps values in contiguous columns and reduces them
+    // with vectorized kernels.  Invalid samples are skipped.  Type must match
+    // type of signal, e.g., ReduceLastN<double>(index, 100, REDUCTION_MEAN, mean).
+    //
+    //! Reduce last n samples (or all samples if less than n samples are available)
+    /*!
+        \return false if signal index or type is invalid, signal is not numeric,
+                or there is no valid sample
+    */
+    template<typename _type>
+    bool ReduceLastN(const BaseType::IndexType & index, size_t n, ReductionType type, double & result) const
+    {
+        const SignalAccessor<ParamEigen<_type> > * accessor = GetSignalAccessor<_type>(index);
+        if (!accessor)
+            return false;
+
+        return accessor->ReduceLastN(n, type, result);
+    }
+
+    //! Reduce samples taken by snapshots in time range [t0, t1]
+    /*!
+        \return false if signal index or type is invalid, signal is not numeric,
+                or there is no valid sample in the range
+    */
+    template<typename _type>
+    bool ReduceRange(const BaseType::IndexType & index, SC::TimestampType t0, SC::TimestampType t1,
+                     ReductionType type, double & result) const
+    {
+        const SignalAccessor<ParamEigen<_type> > * accessor = GetSignalAccessor<_type>(index);
+        if (!accessor)
+            return false;
+
+        size_t begin, count;
+        FindTimeRange(accessor->GetContainerSize(), t0, t1, begin, count);
+
+        return accessor->Reduce(begin, count, type, result);
+    }
+
+    //! Reductions using signal id
+    template<typename _type>
+    bool ReduceLastN(const BaseType::IDType & id, size_t n, ReductionType type, double & result) const {
+        return ReduceLastN<_type>(GetSignalIndex(id), n, type, result);
+    }
+    template<typename _type>
+    bool ReduceRange(const BaseType::IDType & id, SC::TimestampType t0, SC::TimestampType t1,
+                     ReductionType type, double & result) const {
+        return ReduceRange<_type>(GetSignalIndex(id), t0, t1, type, result);
+    }
+
+    //! Export content of table
+    /*!
+        - FORMAT_TEXT: human readable dump of signal accessors
+        - FORMAT_BINARY: header (magic, version, buffer size, snapshot index,
+          number of snapshots and signals) and snapshot timestamps, followed by
+          schema (name and type descriptor of each signal) and one block of
+          samples per signal (see SignalAccessorBase::WriteBinary()).  Native
+          byte order is used.
+        - FORMAT_CSV: header row "snapshot,timestamp,<name>,<name>.valid,
+          <name>.timestamp,..." followed by one row per snapshot, oldest first.
+          Fields of signals added after a snapshot are left empty.  Values are
+          encoded as described in paramCodec.h, and signal names must not
+          contain commas.
+
+        Output is written to os in large blocks rather than element by element.
+
+        \return false if a signal does not support the format specified
+    */
+    bool Serialize(std::ostream & os, FormatType format = FORMAT_TEXT) const;
+
+    //! Import content of table exported by Serialize()
+    /*!
+        Signals are matched by name, and thus all signals in the input must
+        have been added to this history buffer with the same type beforehand.
+        Signals not found in this history buffer are skipped.  Existing samples
+        are discarded, and if the input contains more snapshots than the buffer
+        size, only the latest ones are kept.
+
+        \return false if format is FORMAT_TEXT or the input is invalid, in which
+                case this history buffer is left empty
+    */
+    bool Deserialize(std::istream & is, FormatType format);
 
     virtual void ToStream(std::ostream & os) const;
 };
@@ -0,0 +1,353 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _HistoryBufferColumnar_h
+#define _HistoryBufferColumnar_h
+
+#include <vector>
+#include <map>
+#include <boost/type_traits/is_same.hpp>
+
+#include "common/common.h"
+#include "common/utils.h"
+#include "safecass/historyBufferBase.h"
+#include "safecass/reduction.h"
+
+namespace SC {
+
+/*!
+    Columnar (struct-of-arrays) implementation of the history buffer
+
+    HistoryBuffer maintains one boost::circular_buffer of ParamEigen objects
+    per signal, and thus every sample carries its own vtable pointer, validity
+    flag, and timestamp.  With hundreds of signals, Snapshot() ends up chasing
+    pointers through scattered memory.  This class keeps the same history as
+    a table of columns instead:
+
+    row     time    valid   s(0)  s(1)
+    -----------------------------------------
+    0       1.0     o o     1     [1.1, 2.1]
+    1       2.0     o o     2     [1.2, 2.2]
+    2       0.0     x x     0     [0.0, 0.0]
+    ...
+    1023    0.0     x x     0     [0.0, 0.0]
+    -----------------------------------------
+
+    - time : one timestamp column shared by all signals
+    - valid: one validity bit per signal and row, packed in words
+    - s(i) : one contiguous column of plain values (not ParamEigen objects) of
+             signal i
+
+    Because values and validity of numeric signals are contiguous, reductions
+    over windows (ReduceLastN(), ReduceRange()) run vectorized kernels that
+    apply the validity mask in vector registers (see reduction.h).
+
+    All columns share the same row index, which is derived from SnapshotIndex.
+    Snapshot() reads the clock once and copies the current values of all signals
+    into the same row.
+
+    Note that timestamps are maintained per snapshot, not per sample.  The
+    timestamp of a sample read by GetNewValue() is therefore the time when the
+    snapshot containing the sample was taken, rather than the timestamp of the
+    original object.
+
+    \sa HistoryBuffer
+*/
+class SCLIB_EXPORT HistoryBufferColumnar: public HistoryBufferBase
+{
+public:
+    //! Typedef of base type
+    typedef HistoryBufferBase BaseType;
+
+    //! Typedef of shared timestamp column
+    /*!
+        Note that BaseType::TimestampType is deprecated (see historyBufferBase.h)
+    */
+    typedef std::vector<SC::TimestampType> TimestampColumnType;
+
+protected:
+    //! Typedef of validity mask (see Reduction::MaskWordType)
+    typedef std::vector<Reduction::MaskWordType> MaskType;
+
+    //! Reductions over value columns
+    /*!
+        Generic version for non-numeric types and bool: not supported.
+    */
+    template <typename T, bool num = (IsNum<T>::Yes == 1 && !boost::is_same<T, bool>::value)>
+    struct ColumnReduction {
+        template <typename V>
+        static bool Reduce(const V & /*values*/, const MaskType & /*valid*/, size_t /*begin*/, size_t /*count*/,
+                           ReductionType /*type*/, double & /*result*/) {
+            return false;
+        }
+    };
+
+    //! Reductions over value columns: numeric types
+    template <typename T>
+    struct ColumnReduction<T, true> {
+        template <typename V>
+        static bool Reduce(const V & values, const MaskType & valid, size_t begin, size_t count,
+                           ReductionType type, double & result) {
+            return Reduction::ReduceRing(&values[0], &valid[0], values.size(), begin, count, type, result);
+        }
+    };
+
+    //! Base class of typed columns
+    class ColumnBase
+    {
+    protected:
+        //! Name of signal that this column maintains
+        const std::string SignalName;
+        //! Validity of each row (one bit per row)
+        MaskType Valid;
+        //! Number of samples captured (saturates at the number of rows)
+        size_t NumberOfSamples;
+
+    public:
+        ColumnBase(const std::string & name, size_t rows)
+            : SignalName(name), Valid(Reduction::GetMaskSize(rows), 0), NumberOfSamples(0)
+        {}
+        virtual ~ColumnBase() {}
+
+        inline const std::string & GetSignalName(void) const { return SignalName; }
+        inline size_t GetNumberOfSamples(void) const { return NumberOfSamples; }
+        inline bool IsValid(size_t row) const { return Reduction::IsValid(&Valid[0], row); }
+
+        //! Reduce valid samples of count rows from the row specified, wrapping around
+        /*!
+            Because not every type of signal supports reductions, this method
+            is not declared as pure virtual and fails by default.
+        */
+        virtual bool Reduce(size_t /*row*/, size_t /*count*/, ReductionType /*type*/, double & /*result*/) const {
+            return false;
+        }
+
+        //! Copy current value of the signal object to the row specified
+        virtual void Capture(size_t row) = 0;
+        //! Read value at the row specified
+        virtual void GetValue(size_t row, ParamBase & arg) const = 0;
+        //! Print out samples from oldest to latest
+        virtual void ToStream(std::ostream & os,
+                              const TimestampColumnType & timestamps,
+                              size_t latestRow) const = 0;
+    };
+
+    //! Typed column of plain values
+    template<typename _type>
+    class Column: public ColumnBase
+    {
+    public:
+        typedef ParamEigen<_type> ParamType;
+        //! Eigen requires aligned allocator for fixed-size vectorizable types
+        typedef std::vector<_type, Eigen::aligned_allocator<_type> > ValuesType;
+
+    protected:
+        //! Reference to original object associated with this column
+        const ParamType & SignalObject;
+        //! Contiguous column of values
+        ValuesType Values;
+
+    public:
+        Column(const ParamType & object, const std::string & name, size_t rows)
+            : ColumnBase(name, rows), SignalObject(object), Values(rows, object.Val)
+        {}
+
+        void Capture(size_t row) {
+            Values[row] = SignalObject.Val;
+            Reduction::SetValid(&Valid[0], row, SignalObject.IsValid());
+            if (NumberOfSamples < Values.size())
+                ++NumberOfSamples;
+        }
+
+        void GetValue(size_t row, ParamBase & arg) const {
+            ParamType * pArg = dynamic_cast<ParamType *>(&arg);
+            SCASSERT(pArg);
+            pArg->Val = Values[row];
+            pArg->SetValid(IsValid(row));
+        }
+
+        bool Reduce(size_t row, size_t count, ReductionType type, double & result) const {
+            return ColumnReduction<_type>::Reduce(Values, Valid, row, count, type, result);
+        }
+
+        void ToStream(std::ostream & os, const TimestampColumnType & timestamps, size_t latestRow) const {
+            os << "Column \"" << SignalName << "\": " << SignalObject << ", container: ";
+            if (NumberOfSamples == 0) {
+                os << "empty";
+                return;
+            }
+            const size_t rows = Values.size();
+            size_t row = (latestRow + rows + 1 - NumberOfSamples) % rows;
+            for (size_t i = 0; i < NumberOfSamples; ++i, row = (row + 1) % rows) {
+                ParamType sample(Values[row]);
+                sample.SetValid(IsValid(row));
+                sample.SetTimestamp(timestamps[row]);
+                os << sample;
+                if (i + 1 != NumberOfSamples)
+                    os << ", ";
+            }
+        }
+    };
+
+    //! Typedef of vector containing a set of columns
+    typedef std::vector<ColumnBase *> ColumnsType;
+
+    //! Typedef of map for look up (key: name of signal, value: column index)
+    typedef std::map<BaseType::IDType, BaseType::IndexType> ColumnsMapType;
+
+    //! Number of rows of each column (i.e., length of history)
+    const size_t BufferSize;
+
+    //! Index of snapshot in the table
+    BaseType::IndexType SnapshotIndex;
+
+    //! Row where the latest snapshot was stored
+    size_t LatestRow;
+
+    //! Timestamp column shared by all signals
+    TimestampColumnType Timestamps;
+
+    //! Vector of columns
+    ColumnsType Columns;
+
+    //! Map for column index lookup using signal name
+    ColumnsMapType ColumnsMap;
+
+    //! Returns true if the column specified is valid and has at least one sample
+    bool CheckReadable(BaseType::IndexType index) const;
+
+    //! Returns row of i-th sample (0: oldest) of column that has n samples
+    inline size_t GetRow(size_t n, size_t i) const {
+        return (LatestRow + BufferSize + 1 - n + i) % BufferSize;
+    }
+
+    //! Find samples of column that has n samples taken in time range [t0, t1]
+    /*!
+        \param begin Index of the first sample in the range (0: oldest sample)
+        \param count Number of samples in the range (0 if none)
+    */
+    void FindTimeRange(size_t n, SC::TimestampType t0, SC::TimestampType t1,
+                       size_t & begin, size_t & count) const;
+
+public:
+    //! Constructor
+    /*!
+        \param bufferSize Number of rows (i.e., length of history) of each column
+    */
+    HistoryBufferColumnar(size_t bufferSize = 128);
+
+    //! Destructor
+    virtual ~HistoryBufferColumnar();
+
+    //
+    // Methods required by the base class
+    //
+    //! Get latest value from history buffer using signal id
+    /*!
+        \sa HistoryBufferBase()
+    */
+    virtual bool GetNewValue(const BaseType::IDType & id, ParamBase & arg) const;
+
+    //! Get latest value from history buffer using signal index
+    /*!
+        \sa HistoryBufferBase()
+    */
+    virtual bool GetNewValue(const BaseType::IndexType & index, ParamBase & arg) const;
+
+    //
+    // Interfaces to manage signals
+    //
+    //! Add signal
+    /*!
+        Allocates a column of length BufferSize for the signal.  The same
+        restriction as HistoryBuffer::AddSignal() applies: signals cannot be
+        removed once added.
+
+        \param arg Signal object whose value is copied at every snapshot
+        \param name Name of signal
+        \return random accessible index of the signal if successful.
+                HistoryBufferBase::INVALID_SIGNAL_INDEX otherwise.
+    */
+    template<typename _type>
+    BaseType::IndexType AddSignal(const ParamEigen<_type> & arg, const BaseType::IDType & name)
+    {
+        // Check duplicate name
+        if (FindSignal(name)) {
+            SCLOG_ERROR << "AddSignal() failed: duplicate name \"" << name << "\"" << std::endl;
+            return BaseType::INVALID_SIGNAL_INDEX;
+        }
+
+        Column<_type> * column = new Column<_type>(arg, name, BufferSize);
+
+        BaseType::IndexType columnId = (BaseType::IndexType) Columns.size();
+
+        Columns.push_back(column);
+        ColumnsMap.insert(std::make_pair(name, columnId));
+
+        SCLOG_INFO << "Created column (id=" << columnId << "): \"" << name << "\"" << std::endl;
+
+        return columnId;
+    }
+
+    //! Find signal using signal name
+    bool FindSignal(const BaseType::IDType & id) const;
+
+    //! Take new snapshot of all signals
+    void Snapshot(void);
+
+    //
+    // Getters
+    //
+    inline size_t GetBufferSize(void) const                 { return BufferSize; }
+    inline size_t GetNumberOfSignals(void) const            { return Columns.size(); }
+    inline BaseType::IndexType GetSnapshotIndex(void) const { return SnapshotIndex; }
+
+    BaseType::IndexType GetSignalIndex(const BaseType::IDType & id) const;
+
+    //
+    // Reductions over windows (numeric signals only)
+    //
+    // Invalid samples are skipped, e.g., mean is that of valid samples.
+    //
+    //! Reduce last n samples (or all samples if less than n samples are available)
+    /*!
+        eturn false if signal index is invalid, signal is not numeric, or
+                there is no valid sample
+    */
+    bool ReduceLastN(const BaseType::IndexType & index, size_t n, ReductionType type, double & result) const;
+
+    //! Reduce samples taken by snapshots in time range [t0, t1]
+    /*!
+        eturn false if signal index is invalid, signal is not numeric, or
+                there is no valid sample in the range
+    */
+    bool ReduceRange(const BaseType::IndexType & index, SC::TimestampType t0, SC::TimestampType t1,
+                     ReductionType type, double & result) const;
+
+    //! Reductions using signal id
+    bool ReduceLastN(const BaseType::IDType & id, size_t n, ReductionType type, double & result) const {
+        return ReduceLastN(GetSignalIndex(id), n, type, result);
+    }
+    bool ReduceRange(const BaseType::IDType & id, SC::TimestampType t0, SC::TimestampType t1,
+                     ReductionType type, double & result) const {
+        return ReduceRange(GetSignalIndex(id), t0, t1, type, result);
+    }
+
+    //! Export content of table
+    void Serialize(std::ostream & os) const;
+
+    virtual void ToStream(std::ostream & os) const;
+};
+
+};
+
+#endif // _HistoryBufferColumnar_h
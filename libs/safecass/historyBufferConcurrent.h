@@ -0,0 +1,256 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _HistoryBufferConcurrent_h
+#define _HistoryBufferConcurrent_h
+
+#include <vector>
+#include <map>
+
+#include <boost/atomic.hpp>
+#include <boost/static_assert.hpp>
+
+#include "common/common.h"
+#include "common/utils.h"
+#include "safecass/historyBufferBase.h"
+
+namespace SC {
+
+/*!
+    Single-writer/multi-reader history buffer for external filtering
+
+    With FilterBase::FILTERING_EXTERNAL, filters run in a monitoring thread and
+    read signals while the component thread updates the history buffer via
+    Snapshot().  Neither HistoryBuffer nor boost::circular_buffer is safe
+    for such concurrent accesses.
+
+    This class keeps the same columnar layout as HistoryBufferColumnar (one
+    column per signal, one shared timestamp column) and protects each row with
+    a sequence lock:
+
+    - Writer (component thread, Snapshot()) increments the sequence number of
+      the row to write to an odd number, writes all columns, increments it
+      back to an even number, and then publishes the new snapshot index.
+      The writer never waits for readers.
+
+    - Readers (filter threads, GetNewValue()) read the sequence number of
+      the latest row, copy values, and re-read the sequence number.  If the
+      sequence number was odd or has changed, the row was overwritten while
+      being read and the read is retried.
+
+    Because the writer moves to the next row at every snapshot, a reader has to
+    retry only if the writer wraps around the entire buffer during a read.
+
+    Restrictions:
+    - Only signals of fixed memory layout (i.e., numeric types and fixed-size
+      Eigen types) can be added; values of dynamic-size types (std::vector,
+      Eigen::VectorXd, ...) cannot be read safely during concurrent write.
+    - All signals should be added before readers start.  AddSignal() is not
+      thread-safe.
+    - Only one thread can call Snapshot().
+
+    \sa HistoryBufferColumnar
+*/
+class SCLIB_EXPORT HistoryBufferConcurrent: public HistoryBufferBase
+{
+public:
+    //! Typedef of base type
+    typedef HistoryBufferBase BaseType;
+
+    //! Typedef of sequence number
+    typedef unsigned long SequenceType;
+
+protected:
+    //! Base class of typed columns
+    class ColumnBase
+    {
+    protected:
+        //! Name of signal that this column maintains
+        const std::string SignalName;
+        //! Validity of each row (not bool to avoid bit packing)
+        std::vector<char> Valid;
+
+    public:
+        ColumnBase(const std::string & name, size_t rows)
+            : SignalName(name), Valid(rows, 0)
+        {}
+        virtual ~ColumnBase() {}
+
+        inline const std::string & GetSignalName(void) const { return SignalName; }
+
+        //! Copy current value of the signal object to the row specified
+        virtual void Capture(size_t row) = 0;
+        //! Read value at the row specified (may be torn; caller validates)
+        virtual void Read(size_t row, ParamBase & arg) const = 0;
+        //! Returns true if arg is of the type of this column
+        virtual bool CheckType(const ParamBase & arg) const = 0;
+    };
+
+    //! Typed column of plain values
+    template<typename _type>
+    class Column: public ColumnBase
+    {
+    public:
+        typedef ParamEigen<_type> ParamType;
+        typedef std::vector<_type, Eigen::aligned_allocator<_type> > ValuesType;
+
+    protected:
+        //! Reference to original object associated with this column
+        const ParamType & SignalObject;
+        //! Contiguous column of values
+        ValuesType Values;
+
+    public:
+        Column(const ParamType & object, const std::string & name, size_t rows)
+            : ColumnBase(name, rows), SignalObject(object), Values(rows, object.Val)
+        {}
+
+        void Capture(size_t row) {
+            Values[row] = SignalObject.Val;
+            Valid[row] = SignalObject.IsValid();
+        }
+
+        void Read(size_t row, ParamBase & arg) const {
+            ParamType & param = static_cast<ParamType &>(arg);
+            param.Val = Values[row];
+            param.SetValid(Valid[row] != 0);
+        }
+
+        bool CheckType(const ParamBase & arg) const {
+            return (dynamic_cast<const ParamType *>(&arg) != 0);
+        }
+    };
+
+    //! Typedef of vector containing a set of columns
+    typedef std::vector<ColumnBase *> ColumnsType;
+
+    //! Typedef of map for look up (key: name of signal, value: column index)
+    typedef std::map<BaseType::IDType, BaseType::IndexType> ColumnsMapType;
+
+    //! Number of rows of each column (i.e., length of history)
+    const size_t BufferSize;
+
+    //! Number of snapshots taken (accessed by writer only)
+    SequenceType WriteCount;
+
+    //! Number of snapshots published to readers
+    boost::atomic<SequenceType> PublishedCount;
+
+    //! Sequence number of each row (odd while the row is being written)
+    boost::atomic<SequenceType> * Sequences;
+
+    //! Timestamp column shared by all signals
+    std::vector<SC::TimestampType> Timestamps;
+
+    //! Vector of columns
+    ColumnsType Columns;
+
+    //! Map for column index lookup using signal name
+    ColumnsMapType ColumnsMap;
+
+    //! Reads the latest row of the columns specified in a consistent manner
+    bool ReadLatest(const BaseType::IndexType * indices, ParamBase * const * args, size_t n) const;
+
+public:
+    //! Constructor
+    /*!
+        \param bufferSize Number of rows (i.e., length of history) of each column
+    */
+    HistoryBufferConcurrent(size_t bufferSize = 128);
+
+    //! Destructor
+    virtual ~HistoryBufferConcurrent();
+
+    //
+    // Methods required by the base class (thread-safe)
+    //
+    //! Get latest value from history buffer using signal id
+    /*!
+        \sa HistoryBufferBase()
+    */
+    virtual bool GetNewValue(const BaseType::IDType & id, ParamBase & arg) const;
+
+    //! Get latest value from history buffer using signal index
+    /*!
+        \sa HistoryBufferBase()
+    */
+    virtual bool GetNewValue(const BaseType::IndexType & index, ParamBase & arg) const;
+
+    //! Get latest values of multiple signals from the same snapshot (thread-safe)
+    /*!
+        \param indices Indices of signals to read
+        \param args Objects to store values in (in the order of indices)
+        \return true if success; false otherwise (e.g., no snapshot yet,
+                invalid index, type mismatch)
+    */
+    bool GetNewValues(const std::vector<BaseType::IndexType> & indices,
+                      const std::vector<ParamBase *> & args) const;
+
+    //
+    // Interfaces to manage signals (not thread-safe)
+    //
+    //! Add signal
+    /*!
+        \param arg Signal object whose value is copied at every snapshot
+        \param name Name of signal
+        \return random accessible index of the signal if successful.
+                HistoryBufferBase::INVALID_SIGNAL_INDEX otherwise.
+    */
+    template<typename _type>
+    BaseType::IndexType AddSignal(const ParamEigen<_type> & arg, const BaseType::IDType & name)
+    {
+        // Values of dynamic memory layout cannot be read safely during concurrent write
+        BOOST_STATIC_ASSERT(IsFixedSize<_type>::Yes);
+
+        // Check duplicate name
+        if (FindSignal(name)) {
+            SCLOG_ERROR << "AddSignal() failed: duplicate name \"" << name << "\"" << std::endl;
+            return BaseType::INVALID_SIGNAL_INDEX;
+        }
+
+        Column<_type> * column = new Column<_type>(arg, name, BufferSize);
+
+        BaseType::IndexType columnId = (BaseType::IndexType) Columns.size();
+
+        Columns.push_back(column);
+        ColumnsMap.insert(std::make_pair(name, columnId));
+
+        SCLOG_INFO << "Created column (id=" << columnId << "): \"" << name << "\"" << std::endl;
+
+        return columnId;
+    }
+
+    //! Find signal using signal name
+    bool FindSignal(const BaseType::IDType & id) const;
+
+    //! Take new snapshot of all signals (writer thread only)
+    void Snapshot(void);
+
+    //
+    // Getters
+    //
+    inline size_t GetBufferSize(void) const      { return BufferSize; }
+    inline size_t GetNumberOfSignals(void) const { return Columns.size(); }
+    //! Returns index of latest snapshot published (INVALID_SIGNAL_INDEX if none)
+    inline BaseType::IndexType GetSnapshotIndex(void) const {
+        SequenceType count = PublishedCount.load(boost::memory_order_acquire);
+        return (count == 0 ? BaseType::INVALID_SIGNAL_INDEX : (BaseType::IndexType) count);
+    }
+
+    BaseType::IndexType GetSignalIndex(const BaseType::IDType & id) const;
+
+    virtual void ToStream(std::ostream & os) const;
+};
+
+};
+
+#endif // _HistoryBufferConcurrent_h
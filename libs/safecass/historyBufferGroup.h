@@ -0,0 +1,201 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _HistoryBufferGroup_h
+#define _HistoryBufferGroup_h
+
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+#include "common/common.h"
+#include "common/utils.h"
+#include "safecass/historyBuffer.h"
+
+namespace SC {
+
+/*!
+    Group of history buffers snapshotted under a shared logical clock
+
+    Each component owns its history buffer, and the snapshot index of each
+    history buffer is local to it.  Correlating samples of signals across
+    components thus requires searching snapshot timestamps of each history
+    buffer.  HistoryBufferGroup snapshots all history buffers in the group at
+    the same logical tick with one timestamp (one clock read per tick), and
+    keeps track of which ticks each history buffer has samples of.  Samples of
+    the same tick are then located by index arithmetic in O(1):
+
+        HistoryBufferGroup group;
+        const IndexType arm = group.AddBuffer(&armHistory);
+        const IndexType tool = group.AddBuffer(&toolHistory);
+        ...
+        group.Snapshot();
+        ...
+        const TickType tick = group.GetLatestTick() - 10;
+        const ParamEigen<double> * force = group.GetSample(tool, forceHandle, tick);
+        const ParamEigen<double> * torque = group.GetSample(arm, torqueHandle, tick);
+
+    History buffers in a group should be snapshotted only through the group.
+    If a history buffer is snapshotted (or cleared) otherwise, the group
+    detects it at the next tick and its samples of earlier ticks are no longer
+    available through the group.  The group does not own history buffers.
+*/
+class SCLIB_EXPORT HistoryBufferGroup
+{
+public:
+    //! Typedef of index of history buffer in group
+    typedef HistoryBufferBase::IndexType IndexType;
+    //! Typedef of logical tick (0: first snapshot taken by group)
+    typedef boost::int64_t TickType;
+
+    //! Invalid history buffer index (e.g., returned by AddBuffer() on failure)
+    static const IndexType INVALID_BUFFER_INDEX;
+    //! Invalid tick (e.g., returned by GetLatestTick() before the first snapshot)
+    static const TickType INVALID_TICK;
+
+protected:
+    //! History buffer in group
+    struct MemberType {
+        HistoryBuffer * Buffer;
+        //! Snapshot index of history buffer after the latest tick
+        HistoryBufferBase::IndexType SnapshotIndex;
+        //! First tick that history buffer has aligned samples of
+        TickType AlignedSince;
+    };
+    typedef std::vector<MemberType> MembersType;
+
+    MembersType Members;
+
+    //! Number of ticks taken
+    TickType NumberOfTicks;
+
+    //! Returns age of sample of tick in history buffer (0: latest), or -1 if not available
+    /*!
+        \param numberOfSamples Number of samples of the signal to read
+    */
+    inline TickType GetAge(IndexType buffer, TickType tick, size_t numberOfSamples) const {
+        if (!IsAligned(buffer, tick))
+            return -1;
+        const TickType age = NumberOfTicks - 1 - tick;
+        return (age < (TickType) numberOfSamples ? age : -1);
+    }
+
+public:
+    HistoryBufferGroup(void);
+
+    //! Add history buffer to group
+    /*!
+        The history buffer has samples aligned with the group from the next
+        tick on.
+        \return index of history buffer in group (INVALID_BUFFER_INDEX if
+                buffer is 0 or already in group)
+    */
+    IndexType AddBuffer(HistoryBuffer * buffer);
+
+    //! Returns history buffer (0 if index is invalid)
+    HistoryBuffer * GetBuffer(IndexType buffer) const;
+
+    inline size_t GetNumberOfBuffers(void) const { return Members.size(); }
+
+    //! Take new snapshot of all history buffers at one tick (reads clock once)
+    void Snapshot(void);
+    //! Take new snapshot of all history buffers at one tick with the timestamp given
+    void Snapshot(SC::TimestampType timestamp);
+
+    //! Returns number of ticks taken
+    inline TickType GetNumberOfTicks(void) const { return NumberOfTicks; }
+    //! Returns the latest tick (INVALID_TICK if no snapshot has been taken)
+    inline TickType GetLatestTick(void) const { return NumberOfTicks - 1; }
+
+    //! Returns true if history buffer has samples aligned with tick
+    /*!
+        Whether samples of tick are still kept depends on depth of each signal.
+    */
+    bool IsAligned(IndexType buffer, TickType tick) const;
+
+    //! Get timestamp of tick
+    /*!
+        \return false if no history buffer keeps snapshot of tick
+    */
+    bool GetTimestamp(TickType tick, SC::TimestampType & timestamp) const;
+
+    //
+    // Aligned reads
+    //
+    //! Returns sample of signal at tick (0 if not available)
+    /*!
+        The sample is referred to in place and is overwritten by later snapshots.
+        \param buffer Index of history buffer that handle belongs to
+    */
+    template<typename _type>
+    const ParamEigen<_type> * GetSample(IndexType buffer, const SignalHandle<_type> & handle, TickType tick) const
+    {
+        if (!handle.IsValid())
+            return 0;
+        const size_t n = handle.GetNumberOfSamples();
+        const TickType age = GetAge(buffer, tick, n);
+        if (age < 0)
+            return 0;
+        return &(*handle.GetAccessor()->Container)[n - 1 - (size_t) age];
+    }
+
+    //! Copies sample of signal at tick
+    /*!
+        \return false if not available
+    */
+    template<typename _type>
+    bool GetSample(IndexType buffer, const SignalHandle<_type> & handle, TickType tick,
+                   ParamEigen<_type> & arg) const
+    {
+        const ParamEigen<_type> * sample = GetSample(buffer, handle, tick);
+        if (!sample)
+            return false;
+        arg = *sample;
+        return true;
+    }
+
+    //! Copies sample of signal at tick (signal index; type of signal is checked at every call)
+    template<typename _type>
+    bool GetSample(IndexType buffer, HistoryBufferBase::IndexType signal, TickType tick,
+                   ParamEigen<_type> & arg) const
+    {
+        HistoryBuffer * hb = GetBuffer(buffer);
+        if (!hb)
+            return false;
+        return GetSample(buffer, hb->GetSignalHandle<_type>(signal), tick, arg);
+    }
+
+    //! Get window of samples of signal at consecutive ticks
+    /*!
+        \param first First tick of window
+        \param count Number of ticks in window
+        \return false if samples of any tick in window are not available
+    */
+    template<typename _type>
+    bool GetWindow(IndexType buffer, const SignalHandle<_type> & handle, TickType first, size_t count,
+                   SignalWindow<ParamEigen<_type> > & window) const
+    {
+        window = SignalWindow<ParamEigen<_type> >();
+        if (!handle.IsValid() || count == 0)
+            return false;
+        const size_t n = handle.GetNumberOfSamples();
+        // The oldest and the latest ticks of window must be available
+        const TickType age = GetAge(buffer, first, n);
+        if (age < 0 || GetAge(buffer, first + (TickType) count - 1, n) < 0)
+            return false;
+        return handle.GetWindow(n - 1 - (size_t) age, count, window);
+    }
+};
+
+};
+
+#endif // _HistoryBufferGroup_h
@@ -0,0 +1,374 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _HistoryBufferMapped_h
+#define _HistoryBufferMapped_h
+
+#include <vector>
+#include <map>
+#include <cstring>
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/is_signed.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+
+#include "common/common.h"
+#include "common/utils.h"
+#include "safecass/historyBufferBase.h"
+
+namespace SC {
+
+//
+// Layout of history buffer file
+//
+//   +----------------------------------+  0
+//   | MappedFileHeader                 |
+//   +----------------------------------+  sizeof(MappedFileHeader)
+//   | MappedSignalHeader x MaxSignals  |
+//   +----------------------------------+  TimestampOffset
+//   | Timestamp column (BufferSize)    |
+//   +----------------------------------+
+//   | Value column of signal 0         |
+//   | Valid column of signal 0         |
+//   +----------------------------------+
+//   | ... (appended by AddSignal())    |
+//   +----------------------------------+  FileSize
+//
+// All columns share the same ring position: the k-th snapshot (k = 1, 2, ...)
+// is stored at row (k - 1) % BufferSize.  SnapshotCount in the file header is
+// updated only after all columns of a snapshot are written.  Once the ring has
+// wrapped, however, the next snapshot overwrites the oldest row in place, and
+// a crash in the middle of a snapshot leaves that row torn.  The file thus has
+// one row more than the length of history, and readers expose only the latest
+// BufferSize - 1 snapshots, which are complete even if the writer crashed.
+//
+
+//! Magic string identifying history buffer file
+#define SC_HISTORY_BUFFER_FILE_MAGIC   "SCHBUF"
+//! Version of history buffer file layout
+#define SC_HISTORY_BUFFER_FILE_VERSION 2
+//! Max length of signal name (including null character)
+#define SC_HISTORY_BUFFER_FILE_NAME_LENGTH 64
+
+//! Header of history buffer file
+struct MappedFileHeader
+{
+    char            Magic[8];
+    boost::uint32_t Version;
+    boost::uint32_t BufferSize;       //!< Number of rows (length of history + 1)
+    boost::uint32_t MaxSignals;       //!< Number of signal header slots
+    boost::uint32_t NumberOfSignals;  //!< Number of signal headers in use
+    boost::uint64_t SnapshotCount;    //!< Number of complete snapshots
+    boost::uint64_t TimestampOffset;  //!< File offset of timestamp column
+    boost::uint64_t FileSize;
+};
+
+//! Header describing one signal in history buffer file
+struct MappedSignalHeader
+{
+    //! Kind of signal
+    typedef enum {
+        KIND_SCALAR,          /*!< Numeric type */
+        KIND_EIGEN_COL_MAJOR, /*!< Fixed-size Eigen type, column major */
+        KIND_EIGEN_ROW_MAJOR  /*!< Fixed-size Eigen type, row major */
+    } KindType;
+
+    //! Kind of scalar
+    typedef enum {
+        SCALAR_BOOL,
+        SCALAR_SIGNED,
+        SCALAR_UNSIGNED,
+        SCALAR_FLOAT
+    } ScalarKindType;
+
+    char            Name[SC_HISTORY_BUFFER_FILE_NAME_LENGTH];
+    boost::uint8_t  Kind;
+    boost::uint8_t  ScalarKind;
+    boost::uint8_t  ScalarSize;       //!< Bytes per scalar
+    boost::uint8_t  Reserved[5];
+    boost::uint32_t Rows;             //!< 1 for scalar
+    boost::uint32_t Cols;             //!< 1 for scalar
+    boost::uint64_t FirstSnapshot;    //!< SnapshotCount when signal was added
+    boost::uint64_t ValueOffset;      //!< File offset of value column
+    boost::uint64_t ValidOffset;      //!< File offset of valid column (one byte per row)
+
+    inline size_t GetValueSize(void) const { return (size_t) ScalarSize * Rows * Cols; }
+};
+
+//! Type information of signals stored in history buffer file
+template <typename T, bool eigen = is_eigen_matrix<T>::value>
+struct MappedTypeInfo {
+    typedef T ScalarType;
+    enum { Kind = MappedSignalHeader::KIND_SCALAR, Rows = 1, Cols = 1 };
+
+    //! Returns storage of value (copied to and from file as is)
+    static inline void * GetData(T & value) { return &value; }
+    static inline const void * GetData(const T & value) { return &value; }
+};
+
+template <typename T>
+struct MappedTypeInfo<T, true> {
+    typedef typename T::Scalar ScalarType;
+    enum { Kind = (T::IsRowMajor ? MappedSignalHeader::KIND_EIGEN_ROW_MAJOR
+                                 : MappedSignalHeader::KIND_EIGEN_COL_MAJOR),
+           Rows = T::RowsAtCompileTime,
+           Cols = T::ColsAtCompileTime };
+
+    //! Returns storage of coefficients (fixed-size only)
+    static inline void * GetData(T & value) { return value.data(); }
+    static inline const void * GetData(const T & value) { return value.data(); }
+};
+
+/*!
+    Memory-mapped history buffer for black-box recording
+
+    Columns of this history buffer live in a memory-mapped file so that the
+    latest BufferSize snapshots of all signals survive a crash of the process.
+    Snapshot() only copies values into the mapping (no system call); the
+    operating system writes dirty pages back to the file, even after the
+    process terminated abnormally.  Flush() can be called to force write-back,
+    e.g., to survive power loss.
+
+    The file is self-describing: its header describes type, size, and ring
+    position of each signal.  A file can be opened read-only with Open() for
+    post-mortem analysis, and Serialize() dumps its content in the format of
+    HistoryBuffer::Serialize() (see tools/hbdump).
+
+    Only signals of fixed memory layout (numeric types and fixed-size Eigen
+    types) can be added.  Adding signals remaps the file and should be done
+    before the component starts running.
+
+    \sa HistoryBufferColumnar
+*/
+class SCLIB_EXPORT HistoryBufferMapped: public HistoryBufferBase
+{
+public:
+    //! Typedef of base type
+    typedef HistoryBufferBase BaseType;
+
+protected:
+    //! Base class of typed columns (used by writer only)
+    class ColumnBase
+    {
+    public:
+        virtual ~ColumnBase() {}
+        //! Copy current value of signal object to the row specified
+        virtual void Capture(char * base, const MappedSignalHeader & header, size_t row) const = 0;
+        //! Read value at the row specified
+        virtual bool Read(const char * base, const MappedSignalHeader & header, size_t row, ParamBase & arg) const = 0;
+    };
+
+    //! Typed column
+    template<typename _type>
+    class Column: public ColumnBase
+    {
+    public:
+        typedef ParamEigen<_type> ParamType;
+
+    protected:
+        //! Reference to original object associated with this column
+        const ParamType & SignalObject;
+
+    public:
+        Column(const ParamType & object): SignalObject(object) {}
+
+        void Capture(char * base, const MappedSignalHeader & header, size_t row) const {
+            memcpy(base + header.ValueOffset + row * sizeof(_type),
+                   MappedTypeInfo<_type>::GetData(SignalObject.Val), sizeof(_type));
+            base[header.ValidOffset + row] = (SignalObject.IsValid() ? 1 : 0);
+        }
+
+        bool Read(const char * base, const MappedSignalHeader & header, size_t row, ParamBase & arg) const {
+            ParamType * pArg = dynamic_cast<ParamType *>(&arg);
+            if (!pArg)
+                return false;
+            memcpy(MappedTypeInfo<_type>::GetData(pArg->Val),
+                   base + header.ValueOffset + row * sizeof(_type), sizeof(_type));
+            pArg->SetValid(base[header.ValidOffset + row] != 0);
+            return true;
+        }
+    };
+
+    //! Typedef of vector containing a set of columns
+    typedef std::vector<ColumnBase *> ColumnsType;
+
+    //! Typedef of map for look up (key: name of signal, value: column index)
+    typedef std::map<BaseType::IDType, BaseType::IndexType> ColumnsMapType;
+
+    //! Name of file
+    std::string FileName;
+
+    //! File descriptor (-1 if no file is open)
+    int FileDescriptor;
+
+    //! Base address of mapping (0 if no file is mapped)
+    char * Base;
+
+    //! Size of mapping
+    size_t MappedSize;
+
+    //! If file was opened read-only by Open()
+    bool ReadOnly;
+
+    //! Columns of signals (empty if ReadOnly)
+    ColumnsType Columns;
+
+    //! Map for column index lookup using signal name
+    ColumnsMapType ColumnsMap;
+
+    inline MappedFileHeader * GetFileHeader(void) const {
+        return reinterpret_cast<MappedFileHeader *>(Base);
+    }
+    inline MappedSignalHeader * GetSignalHeader(size_t index) const {
+        return reinterpret_cast<MappedSignalHeader *>(Base + sizeof(MappedFileHeader)) + index;
+    }
+    inline SC::TimestampType * GetTimestampColumn(void) const {
+        return reinterpret_cast<SC::TimestampType *>(Base + GetFileHeader()->TimestampOffset);
+    }
+
+    //! Resize file and map it again
+    bool Remap(size_t fileSize);
+
+    //! Add signal header and allocate its columns in file
+    MappedSignalHeader * AddSignalHeader(const BaseType::IDType & name, int kind,
+                                         int scalarKind, size_t scalarSize,
+                                         size_t rows, size_t cols);
+
+    //! Returns kind of scalar type
+    template<typename _scalar>
+    static int GetScalarKind(void) {
+        if (boost::is_same<_scalar, bool>::value)          return MappedSignalHeader::SCALAR_BOOL;
+        if (boost::is_floating_point<_scalar>::value)      return MappedSignalHeader::SCALAR_FLOAT;
+        if (boost::is_signed<_scalar>::value)              return MappedSignalHeader::SCALAR_SIGNED;
+        return MappedSignalHeader::SCALAR_UNSIGNED;
+    }
+
+    //! Returns number of complete snapshots of signal that can be read
+    size_t GetNumberOfSamples(const MappedSignalHeader & signal) const;
+
+    //! Unmap and close file
+    void Close(void);
+
+public:
+    //! Constructor
+    HistoryBufferMapped(void);
+
+    //! Destructor
+    /*!
+        Unmaps and closes file.  The file is not removed.
+    */
+    virtual ~HistoryBufferMapped();
+
+    //! Create (or truncate) file for recording
+    /*!
+        \param fileName Name of file
+        \param bufferSize Length of history (one more row is allocated in file)
+        \param maxSignals Max number of signals that can be added
+        \return true if success; false otherwise
+    */
+    bool Create(const std::string & fileName, size_t bufferSize = 128, size_t maxSignals = 256);
+
+    //! Open existing file read-only (e.g., recorded by a crashed process)
+    /*!
+        AddSignal() and Snapshot() are not available for files opened by Open().
+        \return true if success; false otherwise
+    */
+    bool Open(const std::string & fileName);
+
+    //! Force write-back of mapping to file (system call)
+    bool Flush(void);
+
+    //
+    // Methods required by the base class
+    //
+    //! Get latest value from history buffer using signal id
+    /*!
+        Not available for files opened by Open()
+        \sa HistoryBufferBase()
+    */
+    virtual bool GetNewValue(const BaseType::IDType & id, ParamBase & arg) const;
+
+    //! Get latest value from history buffer using signal index
+    /*!
+        Not available for files opened by Open()
+        \sa HistoryBufferBase()
+    */
+    virtual bool GetNewValue(const BaseType::IndexType & index, ParamBase & arg) const;
+
+    //
+    // Interfaces to manage signals
+    //
+    //! Add signal
+    /*!
+        \param arg Signal object whose value is copied at every snapshot
+        \param name Name of signal (max 63 characters)
+        \return random accessible index of the signal if successful.
+                HistoryBufferBase::INVALID_SIGNAL_INDEX otherwise.
+    */
+    template<typename _type>
+    BaseType::IndexType AddSignal(const ParamEigen<_type> & arg, const BaseType::IDType & name)
+    {
+        // Values of dynamic memory layout cannot be copied into mapping
+        BOOST_STATIC_ASSERT(IsFixedSize<_type>::Yes);
+
+        typedef MappedTypeInfo<_type> InfoType;
+        typedef typename InfoType::ScalarType ScalarType;
+
+        MappedSignalHeader * header =
+            AddSignalHeader(name, InfoType::Kind, GetScalarKind<ScalarType>(),
+                            sizeof(ScalarType), InfoType::Rows, InfoType::Cols);
+        if (!header)
+            return BaseType::INVALID_SIGNAL_INDEX;
+        SCASSERT(header->GetValueSize() == sizeof(_type));
+
+        BaseType::IndexType columnId = (BaseType::IndexType) Columns.size();
+
+        Columns.push_back(new Column<_type>(arg));
+        ColumnsMap.insert(std::make_pair(name, columnId));
+
+        SCLOG_INFO << "Created column (id=" << columnId << "): \"" << name << "\" in " << FileName << std::endl;
+
+        return columnId;
+    }
+
+    //! Find signal using signal name
+    bool FindSignal(const BaseType::IDType & id) const;
+
+    //! Take new snapshot of all signals
+    void Snapshot(void);
+
+    //
+    // Getters
+    //
+    inline bool IsOpen(void) const { return (Base != 0); }
+    inline bool IsReadOnly(void) const { return ReadOnly; }
+    inline const std::string & GetFileName(void) const { return FileName; }
+    size_t GetBufferSize(void) const;
+    size_t GetNumberOfSignals(void) const;
+    BaseType::IndexType GetSnapshotIndex(void) const;
+
+    BaseType::IndexType GetSignalIndex(const BaseType::IDType & id) const;
+
+    //! Export content of file in the format of HistoryBuffer::Serialize()
+    /*!
+        Timestamps of samples are those of snapshots.
+    */
+    void Serialize(std::ostream & os) const;
+
+    virtual void ToStream(std::ostream & os) const;
+};
+
+};
+
+#endif // _HistoryBufferMapped_h
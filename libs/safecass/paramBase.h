@@ -7,7 +7,7 @@
 //-----------------------------------------------------------------------------------
 //
 // Created on   : Apr 2, 2016
-// Last revision: Apr 19, 2016
+// Last revision: Oct 17, 2026
 // Author       : Min Yang Jung <myj@jhu.edu>
 // Github       : https://github.com/safecass/safecass
 //
@@ -39,6 +39,8 @@ public:
     ParamBase(void): Valid(false) {
         Timestamp = GetCurrentTimestamp();
     }
+    //! Constructor with given timestamp and validity (does not read clock)
+    ParamBase(TimestampType timestamp, bool valid): Valid(valid), Timestamp(timestamp) {}
     virtual ~ParamBase() {}
 
     //! Returns if this object is valid
@@ -65,12 +67,25 @@ public:
 
     inline TimestampType GetTimestamp(void) const { return Timestamp; }
 
+    //! Overrides timestamp of this object
+    /*!
+        Used by history buffers that keep timestamps separately from values
+        (e.g., HistoryBufferColumnar) to restore timestamp of a sample read.
+    */
+    inline void SetTimestamp(TimestampType timestamp) { Timestamp = timestamp; }
+
     virtual void ToStream(std::ostream & os) const {
         PrintTime(Timestamp, os);
         os << ", " << (Valid ? "[o]" : "[x]");
     }
 
     virtual ParamBase * Clone(void) const = 0;
+
+    //! Copies value, timestamp, and validity of other object without allocation
+    /*!
+        \return false if other is of different type
+    */
+    virtual bool CopyFrom(const ParamBase & other) = 0;
 };
 
 inline std::ostream & operator << (std::ostream & os, const ParamBase & param)
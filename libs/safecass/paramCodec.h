@@ -0,0 +1,372 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+/*!
+    This file implements binary and text encoding of values of parameter types
+    (see paramEigen.h), which HistoryBuffer uses to export and import its
+    content (see HistoryBuffer::Serialize() and HistoryBuffer::Deserialize()).
+
+    Supported types are numeric types, Eigen types, and collections of numeric
+    types (e.g., std::vector<double>, std::list<int>).
+
+    Binary encoding uses native byte order:
+      - numeric types: raw bytes
+      - fixed-size Eigen types: raw coefficients in storage order
+      - dynamic-size Eigen types: rows (int32), cols (int32), raw coefficients
+      - collections: number of elements (uint32), raw elements
+
+    Text encoding separates numbers by a space and never emits a comma, so that
+    values can be used as fields of CSV files:
+      - numeric types: number (floating point numbers with full precision)
+      - fixed-size Eigen types: coefficients in storage order
+      - dynamic-size Eigen types: rows, cols, coefficients in storage order
+      - collections: elements
+*/
+
+#ifndef _ParamCodec_h
+#define _ParamCodec_h
+
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <boost/cstdint.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/is_signed.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include "safecass/paramEigen.h"
+
+namespace SC {
+
+namespace ParamCodecDetail {
+
+    //! Appends raw bytes of value to buffer
+    template <typename T>
+    inline void AppendRaw(std::string & buffer, const T & value) {
+        buffer.append(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    //! Reads raw bytes of value from [p, end) and advances p
+    template <typename T>
+    inline bool ReadRaw(const char *& p, const char * end, T & value) {
+        if (end - p < (std::ptrdiff_t) sizeof(T))
+            return false;
+        memcpy(&value, p, sizeof(T));
+        p += sizeof(T);
+        return true;
+    }
+
+    //! Skips spaces and returns true if p has not reached end
+    inline bool SkipSpaces(const char *& p, const char * end) {
+        while (p < end && *p == ' ')
+            ++p;
+        return (p < end);
+    }
+
+    //! Text encoding of numeric types: unsigned integers and bool
+    template <typename T,
+              bool fp = boost::is_floating_point<T>::value,
+              bool sgn = boost::is_signed<T>::value>
+    struct ScalarText {
+        static inline void Write(T value, std::string & buffer) {
+            char s[24];
+            buffer.append(s, snprintf(s, sizeof(s), "%llu", (unsigned long long) value));
+        }
+        static inline bool Read(const char *& p, const char * end, T & value) {
+            if (!SkipSpaces(p, end))
+                return false;
+            char * e;
+            value = static_cast<T>(strtoull(p, &e, 10));
+            if (e == p || e > end)
+                return false;
+            p = e;
+            return true;
+        }
+        static inline char Kind(void) {
+            return (boost::is_same<T, bool>::value ? 'b' : 'u');
+        }
+    };
+
+    //! Text encoding of numeric types: signed integers
+    template <typename T>
+    struct ScalarText<T, false, true> {
+        static inline void Write(T value, std::string & buffer) {
+            char s[24];
+            buffer.append(s, snprintf(s, sizeof(s), "%lld", (long long) value));
+        }
+        static inline bool Read(const char *& p, const char * end, T & value) {
+            if (!SkipSpaces(p, end))
+                return false;
+            char * e;
+            value = static_cast<T>(strtoll(p, &e, 10));
+            if (e == p || e > end)
+                return false;
+            p = e;
+            return true;
+        }
+        static inline char Kind(void) { return 'i'; }
+    };
+
+    //! Text encoding of numeric types: floating point numbers
+    /*!
+        Numbers are printed with enough digits to be read back without loss
+    */
+    template <typename T, bool sgn>
+    struct ScalarText<T, true, sgn> {
+        static inline void Write(T value, std::string & buffer) {
+            char s[32];
+            buffer.append(s, snprintf(s, sizeof(s), "%.*g", (sizeof(T) == sizeof(float) ? 9 : 17),
+                                      (double) value));
+        }
+        static inline bool Read(const char *& p, const char * end, T & value) {
+            if (!SkipSpaces(p, end))
+                return false;
+            char * e;
+            value = static_cast<T>(strtod(p, &e));
+            if (e == p || e > end)
+                return false;
+            p = e;
+            return true;
+        }
+        static inline char Kind(void) { return 'f'; }
+    };
+
+    //! Appends type descriptor of numeric type (e.g., "f8" for double)
+    template <typename T>
+    inline void AppendScalarType(std::string & type) {
+        type += ScalarText<T>::Kind();
+        ScalarText<size_t>::Write(sizeof(T), type);
+    }
+
+} // ParamCodecDetail
+
+//! Binary and text encoding of parameter values
+/*!
+    Generic version for collections of numeric types
+*/
+template <typename T, bool num = (IsNum<T>::Yes == 1), bool eigen = is_eigen_matrix<T>::value>
+struct ParamCodec {
+    typedef typename T::value_type ElementType;
+    typedef ParamCodecDetail::ScalarText<ElementType> TextType;
+
+    static void GetType(std::string & type) {
+        type = "seq<";
+        ParamCodecDetail::AppendScalarType<ElementType>(type);
+        type += ">";
+    }
+
+    static void WriteBinary(const T & value, std::string & buffer) {
+        ParamCodecDetail::AppendRaw(buffer, (boost::uint32_t) value.size());
+        typename T::const_iterator it = value.begin();
+        for (; it != value.end(); ++it)
+            ParamCodecDetail::AppendRaw(buffer, static_cast<ElementType>(*it));
+    }
+
+    static bool ReadBinary(const char *& p, const char * end, T & value) {
+        boost::uint32_t n;
+        if (!ParamCodecDetail::ReadRaw(p, end, n))
+            return false;
+        value.clear();
+        ElementType e;
+        for (boost::uint32_t i = 0; i < n; ++i) {
+            if (!ParamCodecDetail::ReadRaw(p, end, e))
+                return false;
+            value.push_back(e);
+        }
+        return true;
+    }
+
+    static void WriteText(const T & value, std::string & buffer) {
+        typename T::const_iterator it = value.begin();
+        for (; it != value.end(); ++it) {
+            if (it != value.begin())
+                buffer += ' ';
+            TextType::Write(*it, buffer);
+        }
+    }
+
+    static bool ReadText(const char *& p, const char * end, T & value) {
+        value.clear();
+        ElementType e;
+        while (ParamCodecDetail::SkipSpaces(p, end)) {
+            if (!TextType::Read(p, end, e))
+                return false;
+            value.push_back(e);
+        }
+        return true;
+    }
+};
+
+//! Binary and text encoding of numeric types
+template <typename T>
+struct ParamCodec<T, true, false> {
+    typedef ParamCodecDetail::ScalarText<T> TextType;
+
+    static void GetType(std::string & type) {
+        type.clear();
+        ParamCodecDetail::AppendScalarType<T>(type);
+    }
+
+    static inline void WriteBinary(const T & value, std::string & buffer) {
+        ParamCodecDetail::AppendRaw(buffer, value);
+    }
+
+    static inline bool ReadBinary(const char *& p, const char * end, T & value) {
+        return ParamCodecDetail::ReadRaw(p, end, value);
+    }
+
+    static inline void WriteText(const T & value, std::string & buffer) {
+        TextType::Write(value, buffer);
+    }
+
+    static inline bool ReadText(const char *& p, const char * end, T & value) {
+        return TextType::Read(p, end, value);
+    }
+};
+
+//! Binary and text encoding of Eigen types
+/*!
+    Coefficients are accessed via data() in storage order, and thus T must be
+    a plain object type (i.e., Eigen::Matrix or Eigen::Array).
+*/
+template <typename T>
+struct ParamCodec<T, false, true> {
+    typedef typename T::Scalar ScalarType;
+    typedef ParamCodecDetail::ScalarText<ScalarType> TextType;
+
+    enum { DYNAMIC = (T::SizeAtCompileTime == Eigen::Dynamic) ? 1 : 0 };
+
+    static void AppendDimension(int dim, std::string & type) {
+        if (dim == Eigen::Dynamic)
+            type += 'X';
+        else
+            ParamCodecDetail::ScalarText<int>::Write(dim, type);
+    }
+
+    //! Type descriptor, e.g., "eigen<f8,3,3,C>" for Eigen::Matrix3d
+    static void GetType(std::string & type) {
+        type = "eigen<";
+        ParamCodecDetail::AppendScalarType<ScalarType>(type);
+        type += ',';
+        AppendDimension(T::RowsAtCompileTime, type);
+        type += ',';
+        AppendDimension(T::ColsAtCompileTime, type);
+        type += (T::IsRowMajor ? ",R>" : ",C>");
+    }
+
+    //! Checks and applies dimension read from serialized data
+    static bool Resize(int rows, int cols, T & value) {
+        if (rows < 0 || cols < 0)
+            return false;
+        if (T::RowsAtCompileTime != Eigen::Dynamic && rows != T::RowsAtCompileTime)
+            return false;
+        if (T::ColsAtCompileTime != Eigen::Dynamic && cols != T::ColsAtCompileTime)
+            return false;
+        value.resize(rows, cols);
+        return true;
+    }
+
+    static void WriteBinary(const T & value, std::string & buffer) {
+        if (DYNAMIC) {
+            ParamCodecDetail::AppendRaw(buffer, (boost::int32_t) value.rows());
+            ParamCodecDetail::AppendRaw(buffer, (boost::int32_t) value.cols());
+        }
+        buffer.append(reinterpret_cast<const char *>(value.data()), value.size() * sizeof(ScalarType));
+    }
+
+    static bool ReadBinary(const char *& p, const char * end, T & value) {
+        if (DYNAMIC) {
+            boost::int32_t rows, cols;
+            if (!ParamCodecDetail::ReadRaw(p, end, rows) || !ParamCodecDetail::ReadRaw(p, end, cols))
+                return false;
+            if (!Resize(rows, cols, value))
+                return false;
+        }
+        const size_t bytes = value.size() * sizeof(ScalarType);
+        if ((size_t)(end - p) < bytes)
+            return false;
+        memcpy(value.data(), p, bytes);
+        p += bytes;
+        return true;
+    }
+
+    static void WriteText(const T & value, std::string & buffer) {
+        if (DYNAMIC) {
+            ParamCodecDetail::ScalarText<int>::Write((int) value.rows(), buffer);
+            buffer += ' ';
+            ParamCodecDetail::ScalarText<int>::Write((int) value.cols(), buffer);
+            if (value.size())
+                buffer += ' ';
+        }
+        const ScalarType * data = value.data();
+        for (int i = 0; i < value.size(); ++i) {
+            if (i)
+                buffer += ' ';
+            TextType::Write(data[i], buffer);
+        }
+    }
+
+    static bool ReadText(const char *& p, const char * end, T & value) {
+        if (DYNAMIC) {
+            int rows, cols;
+            if (!ParamCodecDetail::ScalarText<int>::Read(p, end, rows) ||
+                !ParamCodecDetail::ScalarText<int>::Read(p, end, cols))
+                return false;
+            if (!Resize(rows, cols, value))
+                return false;
+        }
+        ScalarType * data = value.data();
+        for (int i = 0; i < value.size(); ++i) {
+            if (!TextType::Read(p, end, data[i]))
+                return false;
+        }
+        return true;
+    }
+};
+
+//
+// Encoding of parameters (type of value is deduced from parameter type)
+//
+template <typename T>
+inline std::string GetTypeDescriptor(const ParamEigenBase<T> & /*param*/) {
+    std::string type;
+    ParamCodec<T>::GetType(type);
+    return type;
+}
+
+template <typename T>
+inline void EncodeBinary(const ParamEigenBase<T> & param, std::string & buffer) {
+    ParamCodec<T>::WriteBinary(param.Val, buffer);
+}
+
+template <typename T>
+inline bool DecodeBinary(const char *& p, const char * end, ParamEigenBase<T> & param) {
+    return ParamCodec<T>::ReadBinary(p, end, param.Val);
+}
+
+template <typename T>
+inline void EncodeText(const ParamEigenBase<T> & param, std::string & buffer) {
+    ParamCodec<T>::WriteText(param.Val, buffer);
+}
+
+//! Decodes text in [p, end); fails if anything other than spaces is left
+template <typename T>
+inline bool DecodeText(const char * p, const char * end, ParamEigenBase<T> & param) {
+    if (!ParamCodec<T>::ReadText(p, end, param.Val))
+        return false;
+    return !ParamCodecDetail::SkipSpaces(p, end);
+}
+
+}; // SC
+
+#endif // _ParamCodec_h
@@ -7,7 +7,7 @@
 //-----------------------------------------------------------------------------------
 //
 // Created on   : Mar 27, 2016
-// Last revision: Apr 19, 2016
+// Last revision: Oct 17, 2026
 // Author       : Min Yang Jung <myj@jhu.edu>
 // Github       : https://github.com/safecass/safecass
 //
@@ -69,8 +69,13 @@ class ParamEigenBase: public ParamBase
 {
 protected:
     ParamEigenBase(const T& val): ParamBase(), Val(val) {}
+    ParamEigenBase(const T& val, TimestampType timestamp, bool valid)
+        : ParamBase(timestamp, valid), Val(val) {}
 
 public:
+    //! Typedef of value type
+    typedef T DataType;
+
     T Val;
 
     // don't test self-assignment, causes hopefully no problem here
@@ -90,6 +95,16 @@ public:
         SCASSERT(false); // This method must not be called
         return 0;
     }
+
+    virtual bool CopyFrom(const ParamBase & other) {
+        const ParamEigenBase<T> * param = dynamic_cast<const ParamEigenBase<T> *>(&other);
+        if (!param)
+            return false;
+        Val = param->Val;
+        SetTimestamp(param->GetTimestamp());
+        SetValid(param->IsValid());
+        return true;
+    }
 };
 
 template<typename P>
@@ -124,6 +139,47 @@ REGISTER_PRIMITIVE_TYPE(unsigned long long);
 REGISTER_PRIMITIVE_TYPE(float);
 REGISTER_PRIMITIVE_TYPE(double);
 
+// Template structs to determine types of fixed memory layout, i.e., numeric
+// types and fixed-size Eigen types.  Values of these types can be copied
+// without memory allocation or pointer indirection.
+template <typename T, bool eigen = is_eigen_matrix<T>::value> struct IsFixedSize {
+    enum { Yes = IsNum<T>::Yes, No = IsNum<T>::No };
+};
+
+template <typename T> struct IsFixedSize<T, true> {
+    enum { Yes = (T::SizeAtCompileTime != Eigen::Dynamic) ? 1 : 0 };
+    enum { No = 1 - Yes };
+};
+
+// Template structs to determine default values of Eigen types: zero for
+// fixed-size types and empty (0x0) for dynamic-size types, of which size is
+// not known at compile time
+template <typename T, bool fixed = (IsFixedSize<T>::Yes == 1)> struct EigenDefault {
+    static T Get(void) { return T::Zero(); }
+};
+
+template <typename T> struct EigenDefault<T, false> {
+    static T Get(void) { return T(); }
+};
+
+// Template structs to estimate heap memory that a value owns in addition to
+// sizeof(T), i.e., coefficients of dynamic-size Eigen types and elements of
+// collections (allocator overhead is not included)
+template <typename T, bool num = (IsNum<T>::Yes == 1), bool eigen = is_eigen_matrix<T>::value>
+struct HeapSize {
+    static size_t Get(const T & t) { return t.size() * sizeof(typename T::value_type); }
+};
+
+template <typename T> struct HeapSize<T, true, false> {
+    static size_t Get(const T & /*t*/) { return 0; }
+};
+
+template <typename T> struct HeapSize<T, false, true> {
+    static size_t Get(const T & t) {
+        return (IsFixedSize<T>::Yes ? 0 : t.size() * sizeof(typename T::Scalar));
+    }
+};
+
 // Template specialization for collections and numeric types
 template <typename T, bool num = false> struct Printer {
     void Print(const T & t, std::ostream & os = std::cout) {
@@ -147,6 +203,9 @@ public:
     typedef ParamEigenBase<T> BaseType;
 
     ParamEigen(const T & val): ParamEigenBase<T>(val) {}
+    //! Constructor with given timestamp and validity (does not read clock)
+    ParamEigen(const T & val, TimestampType timestamp, bool valid)
+        : ParamEigenBase<T>(val, timestamp, valid) {}
     ParamEigen(void): ParamEigenBase<T>(static_cast<T>(0)) {}
 
     //
@@ -169,7 +228,7 @@ public:
         BaseType::ToStream(os);
         // printer is instantiated depending on type
         Printer<T, IsNum<T>::Yes> printer;
-        printer.Print(this->Val);
+        printer.Print(this->Val, os);
     }
 
     virtual ParamBase * Clone(void) const {
@@ -231,7 +290,10 @@ public:
 
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
     ParamEigen(const T& val): ParamEigenBase<T>(val) {}
-    ParamEigen(void): ParamEigenBase<T>(T::Zero()) {}
+    //! Constructor with given timestamp and validity (does not read clock)
+    ParamEigen(const T& val, TimestampType timestamp, bool valid)
+        : ParamEigenBase<T>(val, timestamp, valid) {}
+    ParamEigen(void): ParamEigenBase<T>(EigenDefault<T>::Get()) {}
 
     void setZero() { ParamEigenBase<T>::Val.setZero(); }
 
@@ -246,6 +308,13 @@ public:
     }
 };
 
+//! Returns heap memory that value of parameter owns (see HeapSize)
+template<typename T>
+inline size_t GetHeapSize(const ParamEigenBase<T> & param)
+{
+    return HeapSize<T>::Get(param.Val);
+}
+
 template<typename T>
 inline std::ostream & operator<< (std::ostream & os, const ParamEigen<T> & param)
 {
@@ -0,0 +1,118 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+/*!
+    This file implements a compact representation of parameters for internal
+    use by history buffers and filters.
+
+    ParamEigen is polymorphic (vtable pointer), keeps validity in a separate
+    bool, and reads the clock whenever it is default-constructed or constructed
+    from a value (see ParamBase).  PackedParam is a plain struct of a value and
+    a 64-bit word that packs the timestamp (bits 0-62) and the validity (bit
+    63).  It has no constructor, and thus creating PackedParam objects (e.g.,
+    in arrays or as temporaries) never reads the clock.  For numeric types and
+    fixed-size Eigen types, it is trivially copyable and can be copied with
+    memcpy.
+
+    Conversion from and to ParamEigen (Pack() and Unpack()) should only happen
+    at API boundaries.  Unpack() does not read the clock either.
+
+    Timestamps must not be negative (see SC::TimestampType).
+*/
+
+#ifndef _ParamPacked_h
+#define _ParamPacked_h
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+
+#include "safecass/paramEigen.h"
+
+namespace SC {
+
+//! Compact, non-virtual representation of parameter
+/*!
+    Only numeric types and fixed-size Eigen types are supported.
+*/
+template <typename T>
+struct PackedParam
+{
+    BOOST_STATIC_ASSERT(IsFixedSize<T>::Yes == 1);
+
+    typedef T DataType;
+
+    //! Mask of validity bit in Stamp
+    static inline boost::uint64_t ValidMask(void) { return ((boost::uint64_t) 1) << 63; }
+
+    //! Value
+    T Val;
+    //! Timestamp (bits 0-62) and validity (bit 63)
+    boost::uint64_t Stamp;
+
+    inline SC::TimestampType GetTimestamp(void) const {
+        return (SC::TimestampType) (Stamp & ~ValidMask());
+    }
+    inline bool IsValid(void) const {
+        return ((Stamp & ValidMask()) != 0);
+    }
+
+    inline void SetTimestamp(SC::TimestampType timestamp) {
+        Stamp = (Stamp & ValidMask()) | ((boost::uint64_t) timestamp & ~ValidMask());
+    }
+    inline void SetValid(bool valid = true) {
+        Stamp = (valid ? (Stamp | ValidMask()) : (Stamp & ~ValidMask()));
+    }
+
+    //! Sets all fields at once
+    inline void Set(const T & val, SC::TimestampType timestamp, bool valid) {
+        Val = val;
+        Stamp = ((boost::uint64_t) timestamp & ~ValidMask()) | (valid ? ValidMask() : 0);
+    }
+};
+
+//
+// Conversion at API boundaries
+//
+//! Copies value, timestamp and validity of param to packed
+template <typename T>
+inline void Pack(const ParamEigenBase<T> & param, PackedParam<T> & packed)
+{
+    packed.Set(param.Val, param.GetTimestamp(), param.IsValid());
+}
+
+template <typename T>
+inline PackedParam<T> Pack(const ParamEigenBase<T> & param)
+{
+    PackedParam<T> packed;
+    Pack(param, packed);
+    return packed;
+}
+
+//! Copies value, timestamp and validity of packed to param
+template <typename T>
+inline void Unpack(const PackedParam<T> & packed, ParamEigenBase<T> & param)
+{
+    param.Val = packed.Val;
+    param.SetTimestamp(packed.GetTimestamp());
+    param.SetValid(packed.IsValid());
+}
+
+//! Returns ParamEigen object created from packed (without reading clock)
+template <typename T>
+inline ParamEigen<T> Unpack(const PackedParam<T> & packed)
+{
+    return ParamEigen<T>(packed.Val, packed.GetTimestamp(), packed.IsValid());
+}
+
+}; // SC
+
+#endif // _ParamPacked_h
@@ -0,0 +1,434 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+/*!
+    This file implements reductions (sum, mean, min, max, variance, ...) that
+    summarize windows of signal history:
+
+    - Reduce() and ReduceRing() run over contiguous arrays of numbers, e.g.,
+      value columns of HistoryBufferColumnar (see
+      HistoryBufferColumnar::ReduceLastN()).  ReduceRing() skips elements
+      whose bits in the validity mask are not set.
+    - ReduceSamples() runs over samples of SignalAccessor and HistoryBuffer
+      (see SignalAccessor::Reduce()), i.e., ParamEigen objects whose values
+      are strided in memory.  Invalid samples are skipped.
+
+    Kernels over contiguous arrays of double and float are vectorized with AVX
+    (if the library is compiled with SAFECASS_ENABLE_AVX) or SSE2, and fall
+    back to scalar code on other platforms; validity masks are applied in the
+    vector registers.  Kernels for other numeric types and ReduceSamples() are
+    scalar.  Results are computed in double precision regardless of the type
+    of input.
+
+    Because vectorized kernels add numbers in a different order, results may
+    differ from those of a naive loop in the last bits.  Results are undefined
+    if input contains NaN.
+*/
+
+#ifndef _Reduction_h
+#define _Reduction_h
+
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+#include <limits>
+#include <boost/cstdint.hpp>
+
+#include "common/common.h"
+
+namespace SC {
+
+//! Typedef of reductions
+typedef enum {
+    REDUCTION_SUM,      /*!< Sum of samples */
+    REDUCTION_MEAN,     /*!< Arithmetic mean */
+    REDUCTION_MIN,      /*!< Minimum */
+    REDUCTION_MAX,      /*!< Maximum */
+    REDUCTION_VARIANCE, /*!< Population variance, i.e., divided by the number of samples */
+    REDUCTION_L2NORM,   /*!< Square root of sum of squares */
+    REDUCTION_RMS       /*!< Root mean square */
+} ReductionType;
+
+namespace Reduction {
+
+    //
+    // Kernels (scalar versions; see reduction.cpp for vectorized versions)
+    //
+    //! Returns sum of x[0..n)
+    template <typename T>
+    double Sum(const T * x, size_t n) {
+        double sum = 0.0;
+        for (size_t i = 0; i < n; ++i)
+            sum += static_cast<double>(x[i]);
+        return sum;
+    }
+
+    //! Returns sum of squares of x[0..n)
+    template <typename T>
+    double SumSquares(const T * x, size_t n) {
+        double sum = 0.0;
+        for (size_t i = 0; i < n; ++i)
+            sum += static_cast<double>(x[i]) * static_cast<double>(x[i]);
+        return sum;
+    }
+
+    //! Returns sum of squared deviations of x[0..n) from mean
+    template <typename T>
+    double SumSquaredDeviations(const T * x, size_t n, double mean) {
+        double sum = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            const double d = static_cast<double>(x[i]) - mean;
+            sum += d * d;
+        }
+        return sum;
+    }
+
+    //! Updates min and max with x[0..n)
+    /*!
+        min and max must be initialized by the caller (e.g., with x[0])
+    */
+    template <typename T>
+    void MinMax(const T * x, size_t n, double & min, double & max) {
+        for (size_t i = 0; i < n; ++i) {
+            const double v = static_cast<double>(x[i]);
+            if (v < min) min = v;
+            if (v > max) max = v;
+        }
+    }
+
+    template <> SCLIB_EXPORT double Sum<double>(const double * x, size_t n);
+    template <> SCLIB_EXPORT double Sum<float>(const float * x, size_t n);
+    template <> SCLIB_EXPORT double SumSquares<double>(const double * x, size_t n);
+    template <> SCLIB_EXPORT double SumSquares<float>(const float * x, size_t n);
+    template <> SCLIB_EXPORT double SumSquaredDeviations<double>(const double * x, size_t n, double mean);
+    template <> SCLIB_EXPORT double SumSquaredDeviations<float>(const float * x, size_t n, double mean);
+    template <> SCLIB_EXPORT void MinMax<double>(const double * x, size_t n, double & min, double & max);
+    template <> SCLIB_EXPORT void MinMax<float>(const float * x, size_t n, double & min, double & max);
+
+    //! Returns name of instruction set used by the kernels ("AVX", "SSE2", or "scalar")
+    SCLIB_EXPORT const char * GetBackendName(void);
+
+    //! Reduces samples in two spans, i.e., x1[0..n1) followed by x2[0..n2)
+    /*!
+        Samples in a ring buffer consist of up to two spans (see SignalWindow).
+        Variance is computed in two passes (mean, then squared deviations) to
+        avoid cancellation of large sums.
+
+        \return false if there is no sample or type is invalid
+    */
+    template <typename T>
+    bool Reduce(const T * x1, size_t n1, const T * x2, size_t n2, ReductionType type, double & result)
+    {
+        const size_t n = n1 + n2;
+        if (n == 0)
+            return false;
+
+        switch (type) {
+        case REDUCTION_SUM:
+            result = Sum(x1, n1) + Sum(x2, n2);
+            return true;
+        case REDUCTION_MEAN:
+            result = (Sum(x1, n1) + Sum(x2, n2)) / n;
+            return true;
+        case REDUCTION_MIN:
+        case REDUCTION_MAX:
+            {
+                double min, max;
+                min = max = static_cast<double>(n1 ? x1[0] : x2[0]);
+                MinMax(x1, n1, min, max);
+                MinMax(x2, n2, min, max);
+                result = (type == REDUCTION_MIN ? min : max);
+            }
+            return true;
+        case REDUCTION_VARIANCE:
+            {
+                const double mean = (Sum(x1, n1) + Sum(x2, n2)) / n;
+                result = (SumSquaredDeviations(x1, n1, mean) + SumSquaredDeviations(x2, n2, mean)) / n;
+            }
+            return true;
+        case REDUCTION_L2NORM:
+            result = std::sqrt(SumSquares(x1, n1) + SumSquares(x2, n2));
+            return true;
+        case REDUCTION_RMS:
+            result = std::sqrt((SumSquares(x1, n1) + SumSquares(x2, n2)) / n);
+            return true;
+        }
+
+        return false;
+    }
+
+    //
+    // Kernels over valid elements in [begin, end) of contiguous arrays (scalar
+    // versions; see reduction.cpp for vectorized versions)
+    //
+    //! Typedef of word of validity mask: bit (i % 64) of mask[i / 64] is set if x[i] is valid
+    typedef boost::uint64_t MaskWordType;
+    enum { MASK_WORD_BITS = 64 };
+
+    //! Returns number of words of validity mask of n elements
+    inline size_t GetMaskSize(size_t n) {
+        return (n + MASK_WORD_BITS - 1) / MASK_WORD_BITS;
+    }
+    //! Returns validity of i-th element
+    inline bool IsValid(const MaskWordType * mask, size_t i) {
+        return ((mask[i / MASK_WORD_BITS] >> (i % MASK_WORD_BITS)) & 1) != 0;
+    }
+    //! Sets validity of i-th element
+    inline void SetValid(MaskWordType * mask, size_t i, bool valid) {
+        const MaskWordType bit = ((MaskWordType) 1) << (i % MASK_WORD_BITS);
+        mask[i / MASK_WORD_BITS] = (valid ? mask[i / MASK_WORD_BITS] | bit : mask[i / MASK_WORD_BITS] & ~bit);
+    }
+
+    //! Returns number of valid elements in [begin, end)
+    SCLIB_EXPORT size_t CountValid(const MaskWordType * mask, size_t begin, size_t end);
+
+    //! Returns sum of valid elements of x[begin..end)
+    template <typename T>
+    double SumValid(const T * x, const MaskWordType * mask, size_t begin, size_t end) {
+        double sum = 0.0;
+        for (size_t i = begin; i < end; ++i)
+            sum += (IsValid(mask, i) ? static_cast<double>(x[i]) : 0.0);
+        return sum;
+    }
+
+    //! Returns sum of squared deviations of valid elements of x[begin..end) from mean
+    template <typename T>
+    double SumSquaredDeviationsValid(const T * x, const MaskWordType * mask, size_t begin, size_t end,
+                                     double mean) {
+        double sum = 0.0;
+        for (size_t i = begin; i < end; ++i) {
+            const double d = (IsValid(mask, i) ? static_cast<double>(x[i]) - mean : 0.0);
+            sum += d * d;
+        }
+        return sum;
+    }
+
+    //! Updates min and max with valid elements of x[begin..end)
+    /*!
+        min and max must be initialized by the caller (e.g., with infinity and
+        -infinity)
+    */
+    template <typename T>
+    void MinMaxValid(const T * x, const MaskWordType * mask, size_t begin, size_t end,
+                     double & min, double & max) {
+        for (size_t i = begin; i < end; ++i) {
+            if (!IsValid(mask, i))
+                continue;
+            const double v = static_cast<double>(x[i]);
+            if (v < min) min = v;
+            if (v > max) max = v;
+        }
+    }
+
+    template <> SCLIB_EXPORT double SumValid<double>(const double * x, const MaskWordType * mask,
+                                                     size_t begin, size_t end);
+    template <> SCLIB_EXPORT double SumValid<float>(const float * x, const MaskWordType * mask,
+                                                    size_t begin, size_t end);
+    template <> SCLIB_EXPORT double SumSquaredDeviationsValid<double>(const double * x, const MaskWordType * mask,
+                                                                      size_t begin, size_t end, double mean);
+    template <> SCLIB_EXPORT double SumSquaredDeviationsValid<float>(const float * x, const MaskWordType * mask,
+                                                                     size_t begin, size_t end, double mean);
+    template <> SCLIB_EXPORT void MinMaxValid<double>(const double * x, const MaskWordType * mask,
+                                                      size_t begin, size_t end, double & min, double & max);
+    template <> SCLIB_EXPORT void MinMaxValid<float>(const float * x, const MaskWordType * mask,
+                                                     size_t begin, size_t end, double & min, double & max);
+
+    //! Reduces valid elements of count elements from x[begin] in ring of size elements
+    /*!
+        Elements x[begin..begin + count) are reduced, wrapping around at x[size]
+        (e.g., value column of HistoryBufferColumnar).  Elements whose bits in
+        mask are not set are skipped.  Variance is computed in two passes as in
+        Reduce().
+
+        eturn false if range is out of bound, there is no valid element, or
+                type is invalid
+    */
+    template <typename T>
+    bool ReduceRing(const T * x, const MaskWordType * mask, size_t size, size_t begin, size_t count,
+                    ReductionType type, double & result)
+    {
+        if (begin >= size || count > size)
+            return false;
+
+        // Up to two spans: [begin, end1) and [0, end2)
+        const size_t end1 = std::min(begin + count, size);
+        const size_t end2 = begin + count - end1;
+
+        const size_t n = CountValid(mask, begin, end1) + CountValid(mask, 0, end2);
+        if (n == 0)
+            return false;
+
+        switch (type) {
+        case REDUCTION_SUM:
+            result = SumValid(x, mask, begin, end1) + SumValid(x, mask, 0, end2);
+            return true;
+        case REDUCTION_MEAN:
+            result = (SumValid(x, mask, begin, end1) + SumValid(x, mask, 0, end2)) / n;
+            return true;
+        case REDUCTION_MIN:
+        case REDUCTION_MAX:
+            {
+                double min = std::numeric_limits<double>::infinity();
+                double max = -std::numeric_limits<double>::infinity();
+                MinMaxValid(x, mask, begin, end1, min, max);
+                MinMaxValid(x, mask, 0, end2, min, max);
+                result = (type == REDUCTION_MIN ? min : max);
+            }
+            return true;
+        case REDUCTION_VARIANCE:
+            {
+                const double mean = (SumValid(x, mask, begin, end1) + SumValid(x, mask, 0, end2)) / n;
+                result = (SumSquaredDeviationsValid(x, mask, begin, end1, mean) +
+                          SumSquaredDeviationsValid(x, mask, 0, end2, mean)) / n;
+            }
+            return true;
+        case REDUCTION_L2NORM:
+            result = std::sqrt(SumSquaredDeviationsValid(x, mask, begin, end1, 0.0) +
+                               SumSquaredDeviationsValid(x, mask, 0, end2, 0.0));
+            return true;
+        case REDUCTION_RMS:
+            result = std::sqrt((SumSquaredDeviationsValid(x, mask, begin, end1, 0.0) +
+                                SumSquaredDeviationsValid(x, mask, 0, end2, 0.0)) / n);
+            return true;
+        }
+
+        return false;
+    }
+
+    //
+    // Reductions over samples (e.g., ParamEigen<T>) read in place.  Values of
+    // samples are strided in memory, and thus vector loads do not apply.  These
+    // loops instead use independent accumulators to hide latency of additions,
+    // and mask invalid samples without branches.
+    //
+    //! Accumulates (x - center) or (x - center)^2 of valid samples of x[0..n)
+    template <bool squared, typename S>
+    void AccumulateSamples(const S * x, size_t n, double center, double & sum, size_t & count)
+    {
+        double a0 = 0.0, a1 = 0.0;
+        size_t c0 = 0, c1 = 0;
+        size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            const double d0 = (x[i].IsValid() ? static_cast<double>(x[i].Val) - center : 0.0);
+            const double d1 = (x[i + 1].IsValid() ? static_cast<double>(x[i + 1].Val) - center : 0.0);
+            a0 += (squared ? d0 * d0 : d0);
+            a1 += (squared ? d1 * d1 : d1);
+            c0 += (x[i].IsValid() ? 1 : 0);
+            c1 += (x[i + 1].IsValid() ? 1 : 0);
+        }
+        if (i < n && x[i].IsValid()) {
+            const double d = static_cast<double>(x[i].Val) - center;
+            a0 += (squared ? d * d : d);
+            ++c0;
+        }
+        sum += a0 + a1;
+        count += c0 + c1;
+    }
+
+    //! Updates min and max with valid samples of x[0..n)
+    /*!
+        min and max must be initialized by the caller (e.g., with a valid sample)
+    */
+    template <typename S>
+    void MinMaxSamples(const S * x, size_t n, double & min, double & max)
+    {
+        for (size_t i = 0; i < n; ++i) {
+            const double v = static_cast<double>(x[i].Val);
+            const bool valid = x[i].IsValid();
+            min = ((valid && v < min) ? v : min);
+            max = ((valid && v > max) ? v : max);
+        }
+    }
+
+    //! Reduces valid samples in two spans, i.e., x1[0..n1) followed by x2[0..n2)
+    /*!
+        Same as Reduce() but reads values of samples (e.g., ParamEigen<T>) in
+        place and skips invalid samples.
+
+        \return false if there is no valid sample or type is invalid
+    */
+    template <typename S>
+    bool ReduceSamples(const S * x1, size_t n1, const S * x2, size_t n2, ReductionType type, double & result)
+    {
+        double sum = 0.0;
+        size_t n = 0;
+
+        switch (type) {
+        case REDUCTION_SUM:
+        case REDUCTION_MEAN:
+        case REDUCTION_VARIANCE:
+            AccumulateSamples<false>(x1, n1, 0.0, sum, n);
+            AccumulateSamples<false>(x2, n2, 0.0, sum, n);
+            break;
+        case REDUCTION_L2NORM:
+        case REDUCTION_RMS:
+            AccumulateSamples<true>(x1, n1, 0.0, sum, n);
+            AccumulateSamples<true>(x2, n2, 0.0, sum, n);
+            break;
+        case REDUCTION_MIN:
+        case REDUCTION_MAX:
+            {
+                // Initialize with the first valid sample
+                size_t i = 0;
+                for (; i < n1 + n2; ++i)
+                    if ((i < n1 ? x1[i] : x2[i - n1]).IsValid())
+                        break;
+                if (i == n1 + n2)
+                    return false;
+                double min, max;
+                min = max = static_cast<double>((i < n1 ? x1[i] : x2[i - n1]).Val);
+                MinMaxSamples(x1, n1, min, max);
+                MinMaxSamples(x2, n2, min, max);
+                result = (type == REDUCTION_MIN ? min : max);
+            }
+            return true;
+        default:
+            return false;
+        }
+
+        if (n == 0)
+            return false;
+
+        switch (type) {
+        case REDUCTION_SUM:
+            result = sum;
+            break;
+        case REDUCTION_MEAN:
+            result = sum / n;
+            break;
+        case REDUCTION_VARIANCE:
+            {
+                // Second pass (see Reduce())
+                const double mean = sum / n;
+                double deviations = 0.0;
+                size_t count = 0;
+                AccumulateSamples<true>(x1, n1, mean, deviations, count);
+                AccumulateSamples<true>(x2, n2, mean, deviations, count);
+                result = deviations / n;
+            }
+            break;
+        case REDUCTION_L2NORM:
+            result = std::sqrt(sum);
+            break;
+        default: // REDUCTION_RMS
+            result = std::sqrt(sum / n);
+            break;
+        }
+
+        return true;
+    }
+
+} // Reduction
+
+}; // SC
+
+#endif // _Reduction_h
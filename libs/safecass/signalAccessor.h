@@ -7,7 +7,7 @@
 //-----------------------------------------------------------------------------------
 //
 // Created on   : Apr 10, 2016
-// Last revision: Apr 20, 2016
+// Last revision: Oct 17, 2026
 // Author       : Min Yang Jung <myj@jhu.edu>
 // Github       : https://github.com/safecass/safecass
 //
@@ -15,9 +15,15 @@
 #define _SignalAccessor_h
 
 #include <vector>
+#include <algorithm>
 #include <boost/circular_buffer.hpp>
+#include <boost/type_traits/is_same.hpp>
 
 #include "common/common.h"
+#include "common/ringBuffer.h"
+#include "safecass/paramCodec.h"
+#include "safecass/paramPacked.h"
+#include "safecass/reduction.h"
 
 namespace SC {
 
@@ -45,6 +51,61 @@ public:
     virtual void Push(void) = 0;
     virtual void GetValue(ParamBase & arg) const = 0;
     virtual void ToStream(std::ostream & os) const = 0;
+
+    //
+    // Depth of history (see HistoryBuffer::SetSignalDepth())
+    //
+    //! Returns max number of samples that this signal accessor keeps
+    virtual size_t GetCapacity(void) const { return 0; }
+    //! Changes max number of samples, keeping the latest samples
+    virtual bool SetCapacity(size_t /*capacity*/) { return false; }
+    //! Returns estimated memory usage in bytes
+    virtual size_t GetMemoryUsage(void) const { return 0; }
+    //! Returns ratio of uncompressed size to stored size of samples (1: not compressed)
+    virtual double GetCompressionRatio(void) const { return 1.0; }
+
+    //! Replaces i-th sample (0: oldest) with arg (used for deep fault injection)
+    /*!
+        \return false if i is out of range or type of arg does not match
+    */
+    virtual bool SetValue(size_t /*i*/, const ParamBase & /*arg*/) { return false; }
+
+    //
+    // Export and import of samples (see HistoryBuffer::Serialize())
+    //
+    // Because not every signal accessor may support these features, these
+    // methods are not declared as pure virtual and fail by default.
+    //
+    //! Returns number of samples in this signal accessor
+    virtual size_t GetNumberOfSamples(void) const { return 0; }
+    //! Returns type descriptor of signal (empty if not supported)
+    virtual std::string GetTypeDescriptor(void) const { return std::string(); }
+    //! Removes all samples
+    virtual void Clear(void) {}
+
+    //! Appends all samples to buffer in binary format
+    /*!
+        Layout: number of samples (uint32), timestamps (int64 each), valid flags
+        (uint8 each), values (see paramCodec.h), oldest sample first.
+    */
+    virtual bool WriteBinary(std::string & /*buffer*/) const { return false; }
+    //! Replaces samples with those in [p, end) written by WriteBinary(); p is advanced
+    virtual bool ReadBinary(const char *& /*p*/, const char * /*end*/) { return false; }
+
+    //! Appends value of i-th sample (0: oldest) to buffer in text format
+    /*!
+        \param valid Validity of the sample
+        \param timestamp Timestamp of the sample
+    */
+    virtual bool WriteText(size_t /*i*/, std::string & /*buffer*/, bool & /*valid*/,
+                           SC::TimestampType & /*timestamp*/) const {
+        return false;
+    }
+    //! Appends sample of value in [begin, end) in text format
+    virtual bool PushText(const char * /*begin*/, const char * /*end*/, bool /*valid*/,
+                          SC::TimestampType /*timestamp*/) {
+        return false;
+    }
 };
 
 inline std::ostream & operator<< (std::ostream & os, const SignalAccessorBase & accessor)
@@ -53,6 +114,100 @@ inline std::ostream & operator<< (std::ostream & os, const SignalAccessorBase &
     return os;
 }
 
+//! Read-only window of consecutive samples in a signal accessor
+/*!
+    Samples of a signal accessor are stored in a ring buffer, and thus a window
+    of consecutive samples consists of up to two contiguous spans: one before
+    and one after the wrap point of the ring.  SignalWindow refers to samples in
+    place (no copy) and remains valid until the next snapshot overwrites them.
+
+    Samples are ordered from oldest to latest, i.e., FirstSpan[0] is the oldest
+    and SecondSpan[SecondSize - 1] (or FirstSpan[FirstSize - 1] if SecondSize
+    is zero) is the latest.
+*/
+template<class T>
+struct SignalWindow
+{
+    typedef T ValueType;
+
+    //! Span before wrap point
+    const ValueType * FirstSpan;
+    size_t            FirstSize;
+    //! Span after wrap point (empty if samples are contiguous)
+    const ValueType * SecondSpan;
+    size_t            SecondSize;
+
+    SignalWindow(void): FirstSpan(0), FirstSize(0), SecondSpan(0), SecondSize(0) {}
+
+    inline size_t GetSize(void) const { return FirstSize + SecondSize; }
+    inline bool IsEmpty(void) const { return (GetSize() == 0); }
+    //! Returns true if all samples are in one contiguous span
+    inline bool IsContiguous(void) const { return (SecondSize == 0); }
+
+    //! Random access (0: oldest)
+    inline const ValueType & operator[](size_t i) const {
+        return (i < FirstSize ? FirstSpan[i] : SecondSpan[i - FirstSize]);
+    }
+};
+
+//! Get window of consecutive elements in ring buffer
+/*!
+    \param begin Index of the first element in the window (0: oldest element)
+    \param count Number of elements in the window
+    \return false if the range specified is out of bound
+*/
+template<class T>
+bool GetRingWindow(const RingBuffer<T> & ring, size_t begin, size_t count, SignalWindow<T> & window)
+{
+    window = SignalWindow<T>();
+    if (begin + count > ring.GetSize())
+        return false;
+    if (count == 0)
+        return true;
+
+    const typename RingBuffer<T>::ArrayRangeType one = ring.GetArrayOne();
+    const typename RingBuffer<T>::ArrayRangeType two = ring.GetArrayTwo();
+    if (begin < one.second) {
+        window.FirstSpan  = one.first + begin;
+        window.FirstSize  = std::min(count, one.second - begin);
+        window.SecondSpan = two.first;
+        window.SecondSize = count - window.FirstSize;
+    } else {
+        window.FirstSpan  = two.first + (begin - one.second);
+        window.FirstSize  = count;
+    }
+
+    return true;
+}
+
+//! Reductions over windows of samples
+/*!
+    Samples of signal accessors are ParamEigen objects, each of which carries
+    a vtable pointer, a timestamp and a validity flag in addition to its value.
+    Samples are reduced in place by scalar loops, skipping invalid samples (see
+    Reduction::ReduceSamples()).  No copy of values is kept.  For vectorized
+    reductions over contiguous values, see HistoryBufferColumnar.
+
+    Generic version for non-numeric types and bool: not supported.
+*/
+template <typename T, bool num = (IsNum<T>::Yes == 1 && !boost::is_same<T, bool>::value)>
+struct WindowReduction {
+    template <typename S>
+    static bool Reduce(const SignalWindow<S> & /*window*/, ReductionType /*type*/, double & /*result*/) {
+        return false;
+    }
+};
+
+//! Reductions over windows of samples: numeric types
+template <typename T>
+struct WindowReduction<T, true> {
+    template <typename S>
+    static bool Reduce(const SignalWindow<S> & window, ReductionType type, double & result) {
+        return Reduction::ReduceSamples(window.FirstSpan, window.FirstSize,
+                                           window.SecondSpan, window.SecondSize, type, result);
+    }
+};
+
 //! Signal accessor class
 template<class T>
 class SignalAccessor: public SignalAccessorBase
@@ -62,25 +217,48 @@ public:
     typedef SignalAccessorBase BaseType;
 
     //! Typedefs for container access
-    typedef boost::circular_buffer<T>          ContainerType;
-    typedef typename ContainerType::size_type  SizeType;
-    typedef typename ContainerType::value_type ValueType;
-    typedef typename ContainerType::iterator   IteratorType;
+    typedef RingBuffer<T>                      ContainerType;
+    typedef size_t                             SizeType;
+    typedef typename ContainerType::ValueType  ValueType;
     /*!
         'param_type' of boost.call_traits represents the "best" way to pass a parameter
         of type `value_type` to a method
         \sa boost/call_traits
     */
     typedef typename boost::call_traits<ValueType>::param_type ParameterType;
+    //! Typedef of raw value of samples (e.g., double for ParamEigen<double>)
+    typedef typename ValueType::DataType DataType;
 
     //! Container maintaining snapshots of signals
+    /*!
+        All slots of the container are allocated when this signal accessor is
+        created, as copies of the signal object, and are then overwritten in
+        place.  Snapshots of signals of dynamic-size types (e.g., Eigen::VectorXd,
+        std::vector) thus do not allocate memory as long as the size of the
+        signal object does not change.
+    */
     ContainerType * Container;
 
+protected:
+    //! Typed reference to original object (resolved once at construction)
+    const ValueType & TypedSignalObject;
+
+    static const ValueType & CastSignalObject(const ParamBase & object) {
+        const ValueType * param = dynamic_cast<const ValueType *>(&object);
+        SCASSERT(param);
+        return *param;
+    }
+
+    inline void PushSample(const ValueType & sample) {
+        Container->PushBack(sample);
+    }
+
+public:
     //! Constructor
     SignalAccessor(const ParamBase & object, const std::string & name, size_t size)
-        : SignalAccessorBase(object, name)
+        : SignalAccessorBase(object, name), TypedSignalObject(CastSignalObject(object))
     {
-        Container = new ContainerType(size);
+        Container = new ContainerType(size, TypedSignalObject);
     }
 
     //! Destructor
@@ -88,10 +266,17 @@ public:
         delete Container;
     }
 
+    //! Push current value of the signal object (non-virtual)
+    /*!
+        Used by SignalAccessorGroup to copy signals of the same type in a tight
+        loop without virtual calls or run-time type checks.
+    */
+    inline void PushTyped(void) {
+        PushSample(TypedSignalObject);
+    }
+
     virtual void Push(void) {
-        const ValueType * param = dynamic_cast<const ValueType *>(&SignalObject);
-        SCASSERT(param);
-        Container->push_back(*param);
+        PushTyped();
     }
 
     void Push(ParameterType item, bool debug = false) {
@@ -99,10 +284,10 @@ public:
             const ValueType * _obj = dynamic_cast<const ValueType*>(&item);
             SCLOG_DEBUG << "Signal accessor \"" << this->GetSignalName() << "\": push " << *_obj << std::endl;
         }
-        Container->push_back(item);
+        PushSample(item);
         if (debug) {
             SCLOG_DEBUG << "Signal accessor \"" << this->GetSignalName() << "\": size after push = "
-                        << Container->size() << std::endl;
+                        << Container->GetSize() << std::endl;
         }
     }
 
@@ -112,48 +297,256 @@ public:
             return;
         }
 
-        // circular_buffer memory layout:
-        //
-        // boost::circular_buffer<int> cb(3);
-        // cb.push_back(1);
-        // cb.push_back(2);
-        // cb.push_back(3);
-        // cb.push_back(4);
-        //
-        // assert(cb[0] == 2);
-        // assert(cb[1] == 3);
-        // assert(cb[2] == 4);
-        //
-        // assert(*cb.begin() == 2);
-        // assert(cb.front() == 2);
-        // assert(cb.back() == 4);
-
         ValueType * pArg = dynamic_cast<ValueType *>(&arg);
         SCASSERT(pArg);
-        *pArg = Container->back();
+        *pArg = Container->Back();
+    }
+
+    //! Get window of consecutive samples
+    /*!
+        \param begin Index of the first sample in the window (0: oldest sample)
+        \param count Number of samples in the window
+        \param window Window referring to the samples
+        \return false if the range specified is out of bound
+    */
+    inline bool GetWindow(size_t begin, size_t count, SignalWindow<ValueType> & window) const {
+        return GetRingWindow(*Container, begin, count, window);
+    }
+
+    //! Get window of last n samples
+    /*!
+        If less than n samples are available, all samples are returned.
+    */
+    void GetLastN(size_t n, SignalWindow<ValueType> & window) const {
+        n = std::min(n, Container->GetSize());
+        GetWindow(Container->GetSize() - n, n, window);
+    }
+
+    //
+    // Reductions (numeric types only)
+    //
+    // Invalid samples are skipped, e.g., mean is that of valid samples.
+    //
+    //! Reduce consecutive samples
+    /*!
+        \param begin Index of the first sample (0: oldest sample)
+        \param count Number of samples
+        \param type Reduction to compute
+        \param result Result of reduction
+        \return false if the range specified is out of bound, there is no
+                valid sample in the range, or type of signal is not numeric
+    */
+    inline bool Reduce(size_t begin, size_t count, ReductionType type, double & result) const {
+        SignalWindow<ValueType> window;
+        if (!GetWindow(begin, count, window))
+            return false;
+        return WindowReduction<DataType>::Reduce(window, type, result);
+    }
+
+    //! Reduce last n samples (or all samples if less than n samples are available)
+    bool ReduceLastN(size_t n, ReductionType type, double & result) const {
+        n = std::min(n, Container->GetSize());
+        return Reduce(Container->GetSize() - n, n, type, result);
     }
 
     //
     // Getters
     //
-    inline size_t GetContainerSize(void) { return Container->size(); }
+    inline size_t GetContainerSize(void) const { return Container->GetSize(); }
+
+    //! Replaces i-th sample (0: oldest) with value (non-virtual)
+    inline bool SetSample(size_t i, const ValueType & value) {
+        if (i >= Container->GetSize())
+            return false;
+        (*Container)[i] = value;
+        return true;
+    }
+
+    virtual bool SetValue(size_t i, const ParamBase & arg) {
+        const ValueType * value = dynamic_cast<const ValueType *>(&arg);
+        if (!value)
+            return false;
+        return SetSample(i, *value);
+    }
+
+    //
+    // Packed samples (see PackedParam; numeric and fixed-size Eigen types only)
+    //
+    //! Copies i-th sample (0: oldest) to packed
+    inline bool GetPacked(size_t i, PackedParam<DataType> & packed) const {
+        if (i >= Container->GetSize())
+            return false;
+        Pack((*Container)[i], packed);
+        return true;
+    }
+
+    //! Replaces i-th sample (0: oldest) with packed
+    inline bool SetPacked(size_t i, const PackedParam<DataType> & packed) {
+        if (i >= Container->GetSize())
+            return false;
+        Unpack(packed, (*Container)[i]);
+        return true;
+    }
+
+    //! Push packed sample, converted in place into the next slot
+    inline void PushPacked(const PackedParam<DataType> & packed) {
+        if (Container->GetCapacity() == 0)
+            return;
+        Unpack(packed, Container->Advance());
+    }
+
+    //
+    // Depth of history
+    //
+    virtual size_t GetCapacity(void) const { return Container->GetCapacity(); }
+
+    virtual bool SetCapacity(size_t capacity) {
+        if (capacity == 0)
+            return false;
+        // Oldest samples are removed when shrinking
+        Container->SetCapacity(capacity, TypedSignalObject);
+        return true;
+    }
+
+    //! Slots are allocated up front, and dynamic-size types own heap memory as well
+    virtual size_t GetMemoryUsage(void) const {
+        const typename ContainerType::SlotsType & slots = Container->GetSlots();
+        size_t bytes = sizeof(*this) + sizeof(ContainerType) + slots.size() * sizeof(ValueType);
+        for (size_t i = 0; i < slots.size(); ++i)
+            bytes += GetHeapSize(slots[i]);
+        return bytes;
+    }
+
+    //
+    // Export and import of samples
+    //
+    virtual size_t GetNumberOfSamples(void) const { return Container->GetSize(); }
+
+    virtual std::string GetTypeDescriptor(void) const { return SC::GetTypeDescriptor(TypedSignalObject); }
+
+    virtual void Clear(void) {
+        Container->Clear();
+    }
+
+    virtual bool WriteBinary(std::string & buffer) const {
+        const size_t n = Container->GetSize();
+        ParamCodecDetail::AppendRaw(buffer, (boost::uint32_t) n);
+        for (size_t i = 0; i < n; ++i)
+            ParamCodecDetail::AppendRaw(buffer, (boost::int64_t) (*Container)[i].GetTimestamp());
+        for (size_t i = 0; i < n; ++i)
+            buffer += (char) ((*Container)[i].IsValid() ? 1 : 0);
+        for (size_t i = 0; i < n; ++i)
+            EncodeBinary((*Container)[i], buffer);
+        return true;
+    }
+
+    virtual bool ReadBinary(const char *& p, const char * end) {
+        Clear();
+
+        boost::uint32_t n;
+        if (!ParamCodecDetail::ReadRaw(p, end, n))
+            return false;
+        if ((size_t)(end - p) < n * (sizeof(boost::int64_t) + 1))
+            return false;
+        const char * timestamps = p;
+        const char * valid = p + n * sizeof(boost::int64_t);
+        p = valid + n;
+
+        // Copy of the signal object provides type-specific initialization
+        // (e.g., size of dynamic-size Eigen types)
+        ValueType sample(TypedSignalObject);
+        boost::int64_t timestamp;
+        for (boost::uint32_t i = 0; i < n; ++i) {
+            if (!DecodeBinary(p, end, sample))
+                return false;
+            memcpy(&timestamp, timestamps + i * sizeof(boost::int64_t), sizeof(timestamp));
+            sample.SetTimestamp(timestamp);
+            sample.SetValid(valid[i] != 0);
+            PushSample(sample);
+        }
+        return true;
+    }
+
+    virtual bool WriteText(size_t i, std::string & buffer, bool & valid, SC::TimestampType & timestamp) const {
+        if (i >= Container->GetSize())
+            return false;
+        const ValueType & sample = (*Container)[i];
+        EncodeText(sample, buffer);
+        valid = sample.IsValid();
+        timestamp = sample.GetTimestamp();
+        return true;
+    }
+
+    virtual bool PushText(const char * begin, const char * end, bool valid, SC::TimestampType timestamp) {
+        ValueType sample(TypedSignalObject);
+        if (!DecodeText(begin, end, sample))
+            return false;
+        sample.SetTimestamp(timestamp);
+        sample.SetValid(valid);
+        PushSample(sample);
+        return true;
+    }
 
     virtual void ToStream(std::ostream & os) const {
         os << "Signal accessor \"" << this->GetSignalName() << "\": " << SignalObject
            << ", container: ";
-        if (Container->empty()) {
+        if (Container->IsEmpty()) {
             os << "empty";
             return;
         }
-        IteratorType it = Container->begin();
-        for (; it != Container->end(); ++it) {
-            os << *it;
-            if (it + 1 != Container->end())
+        for (size_t i = 0; i < Container->GetSize(); ++i) {
+            if (i)
                 os << ", ";
+            os << (*Container)[i];
         }
     }
 };
 
+//! Base class of signal accessor groups
+/*!
+    HistoryBuffer groups signal accessors by type of signal so that Snapshot()
+    makes one virtual call per group, rather than one per signal.
+*/
+class SignalAccessorGroupBase
+{
+public:
+    virtual ~SignalAccessorGroupBase() {}
+
+    //! Push current values of all signals in this group
+    virtual void Push(void) = 0;
+    //! Returns number of signal accessors in this group
+    virtual size_t GetNumberOfSignals(void) const = 0;
+};
+
+//! Group of signal accessors of the same type
+/*!
+    The group does not own the signal accessors; HistoryBuffer does.
+    _accessorType is SignalAccessor<T> or another accessor class with
+    PushTyped() (e.g., CompressedSignalAccessor).
+*/
+template<class T, class _accessorType = SignalAccessor<T> >
+class SignalAccessorGroup: public SignalAccessorGroupBase
+{
+public:
+    typedef _accessorType AccessorType;
+    typedef std::vector<AccessorType *> AccessorsType;
+
+protected:
+    AccessorsType Accessors;
+
+public:
+    inline void Add(AccessorType * accessor) { Accessors.push_back(accessor); }
+
+    virtual void Push(void) {
+        typename AccessorsType::iterator it = Accessors.begin();
+        const typename AccessorsType::iterator itEnd = Accessors.end();
+        for (; it != itEnd; ++it)
+            (*it)->PushTyped();
+    }
+
+    virtual size_t GetNumberOfSignals(void) const { return Accessors.size(); }
+};
+
 };
 
 #endif // _SignalAccessor_h
@@ -7,7 +7,7 @@
 //-----------------------------------------------------------------------------------
 //
 // Created on   : Jan 7, 2012
-// Last revision: Apr 3, 2016
+// Last revision: Oct 17, 2026
 // Author       : Min Yang Jung <myj@jhu.edu>
 // Github       : https://github.com/safecass/safecass
 //
@@ -16,6 +16,7 @@
 #define _SignalElement_h
 
 #include "common/common.h"
+#include "common/stringTable.h"
 #include "safecass/historyBufferBase.h"
 
 namespace SC {
@@ -35,9 +36,24 @@ protected:
     //! Name of this signal
     const std::string Name;
 
+    //! Interned name of this signal (see StringTable::GetInstance())
+    const StringIDType NameID;
+
     //! Parameter prototype associated with this signal
     const ParamBase & ParamPrototype;
 
+    //! Output signal of upstream filter that this input signal is bound to
+    /*!
+        Set by FilterPipeline so that the filter reads the output of the
+        upstream filter in place, without going through history buffer.
+        0 if not bound.
+    */
+    const ParamBase * Source;
+
+    //! Value injected for the current run (shallow fault injection, see
+    //! FilterBase::InjectInput()); overrides Source and ParamPrototype.  0 if none.
+    const ParamBase * Injected;
+
     //! Instance of history buffer that this signal is associated with
     HistoryBufferBase * HistoryBufferInstance;
 
@@ -73,6 +89,8 @@ public:
     //
     //! Returns name of this signal
     inline const std::string & GetName(void) const { return Name; }
+    //! Returns interned name of this signal
+    inline StringIDType GetNameID(void) const { return NameID; }
 
     //! Returns copy of parameter prototype of this signal
     /*!
@@ -84,6 +102,31 @@ public:
         return ParamPrototype.Clone();
     }
 
+    //! Returns signal object associated with this signal (no copy)
+    inline const ParamBase & GetParam(void) const { return ParamPrototype; }
+
+    //! Bind this signal to output signal object of upstream filter (0: unbind)
+    inline void SetSource(const ParamBase * source) { Source = source; }
+    //! Returns output signal object that this signal is bound to (0 if not bound)
+    inline const ParamBase * GetSource(void) const { return Source; }
+
+    //! Sets value injected for the current run (0: clear)
+    inline void SetInjected(const ParamBase * injected) { Injected = injected; }
+    //! Returns value injected for the current run (0 if none)
+    inline const ParamBase * GetInjected(void) const { return Injected; }
+
+    //! Returns current value of this signal
+    /*!
+        Returns value injected for the current run if any, output of upstream
+        filter if bound (see FilterPipeline), and the signal object associated
+        with this signal otherwise.
+    */
+    inline const ParamBase & GetValue(void) const {
+        if (Injected)
+            return *Injected;
+        return (Source ? *Source : ParamPrototype);
+    }
+
     //! Return history buffer instance
     inline HistoryBufferBase * GetHistoryBufferInstance(void) const {
         return HistoryBufferInstance;
@@ -124,7 +167,12 @@ public:
 #endif
 
     //! Push new value to history buffer (used for deep fault injection)
-    void PushNewValue(const ParamBase & paramType);
+    /*!
+        \return false if history buffer or signal index is not set, or history
+                buffer does not support deep fault injection
+        \sa HistoryBufferBase::PushNewValue()
+    */
+    bool PushNewValue(const ParamBase & paramType);
 
     //! Serialized representation of this signal object
     void ToStream(std::ostream & os) const;
@@ -0,0 +1,154 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _SignalHandle_h
+#define _SignalHandle_h
+
+#include "safecass/historyBufferBase.h"
+#include "safecass/signalAccessor.h"
+
+namespace SC {
+
+//! Typed handle to signal in history buffer
+/*!
+    HistoryBuffer::GetNewValue() takes ParamBase and resolves the actual type of
+    signal by dynamic_cast at every read.  SignalHandle resolves the type once,
+    when it is created by HistoryBuffer::AddSignal() or
+    HistoryBuffer::GetSignalHandle(), and then reads samples directly from the
+    signal accessor.  Reads are inlined and need neither virtual calls nor
+    run-time type checks, and reading with a wrong type fails to compile:
+
+        SignalHandle<double> handle = hb.AddSignal(param, "velocity");
+        ...
+        double v;
+        handle.GetLatestValue(v);
+
+    A handle converts implicitly to the index of the signal, and can thus be
+    used wherever a signal index is expected.  A handle remains valid as long as
+    the history buffer that created it exists (signals cannot be removed).  Like
+    other reads from history buffer, reads through handles take no lock.
+*/
+template<typename _type>
+class SignalHandle
+{
+public:
+    typedef HistoryBufferBase::IndexType IndexType;
+    typedef ParamEigen<_type>            ParamType;
+    typedef SignalAccessor<ParamType>    AccessorType;
+    typedef SignalWindow<ParamType>      WindowType;
+
+protected:
+    //! Signal accessor (0 if this handle is invalid)
+    AccessorType * Accessor;
+    //! Index of signal in history buffer
+    IndexType Index;
+
+public:
+    //! Constructor of invalid handle
+    SignalHandle(void): Accessor(0), Index(HistoryBufferBase::INVALID_SIGNAL_INDEX) {}
+    SignalHandle(AccessorType * accessor, IndexType index): Accessor(accessor), Index(index) {}
+
+    //! Returns true if this handle refers to a signal
+    inline bool IsValid(void) const { return (Accessor != 0); }
+
+    //! Returns index of signal (HistoryBufferBase::INVALID_SIGNAL_INDEX if invalid)
+    inline IndexType GetIndex(void) const { return Index; }
+    inline operator IndexType(void) const { return Index; }
+
+    //! Returns signal accessor (0 if invalid)
+    inline const AccessorType * GetAccessor(void) const { return Accessor; }
+
+    //
+    // Reads
+    //
+    //! Returns number of samples available
+    inline size_t GetNumberOfSamples(void) const {
+        return (Accessor ? Accessor->GetContainerSize() : 0);
+    }
+
+    //! Returns latest sample (0 if invalid or no sample is available)
+    /*!
+        The sample is referred to in place and is overwritten by later snapshots.
+    */
+    inline const ParamType * GetLatest(void) const {
+        if (!Accessor || Accessor->Container->IsEmpty())
+            return 0;
+        return &Accessor->Container->Back();
+    }
+
+    //! Copies latest sample, including its validity and timestamp
+    /*!
+        \return false if invalid or no sample is available
+    */
+    inline bool GetLatest(ParamType & arg) const {
+        const ParamType * sample = GetLatest();
+        if (!sample)
+            return false;
+        arg = *sample;
+        return true;
+    }
+
+    //! Copies latest sample in packed form (see PackedParam)
+    /*!
+        \return false if invalid or no sample is available
+    */
+    inline bool GetLatest(PackedParam<_type> & packed) const {
+        const ParamType * sample = GetLatest();
+        if (!sample)
+            return false;
+        Pack(*sample, packed);
+        return true;
+    }
+
+    //! Copies value of latest sample
+    /*!
+        \return false if invalid or no sample is available
+    */
+    inline bool GetLatestValue(_type & value) const {
+        const ParamType * sample = GetLatest();
+        if (!sample)
+            return false;
+        value = sample->Val;
+        return true;
+    }
+
+    //! Get window of last n samples (see SignalAccessor::GetLastN())
+    /*!
+        \return false if invalid
+    */
+    inline bool GetLastN(size_t n, WindowType & window) const {
+        if (!Accessor) {
+            window = WindowType();
+            return false;
+        }
+        Accessor->GetLastN(n, window);
+        return true;
+    }
+
+    //! Get window of consecutive samples (see SignalAccessor::GetWindow())
+    inline bool GetWindow(size_t begin, size_t count, WindowType & window) const {
+        if (!Accessor) {
+            window = WindowType();
+            return false;
+        }
+        return Accessor->GetWindow(begin, count, window);
+    }
+
+    //! Reduce last n samples (see SignalAccessor::ReduceLastN())
+    inline bool ReduceLastN(size_t n, ReductionType type, double & result) const {
+        return (Accessor ? Accessor->ReduceLastN(n, type, result) : false);
+    }
+};
+
+};
+
+#endif // _SignalHandle_h
@@ -0,0 +1,131 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+#ifndef _SlidingWindow_h
+#define _SlidingWindow_h
+
+#include <iostream>
+
+#include <boost/cstdint.hpp>
+
+#include "common/common.h"
+#include "common/utils.h"
+#include "common/ringBuffer.h"
+
+namespace SC {
+
+//! Mean, variance, min, and max of samples in sliding window
+/*!
+    The window holds either the latest N samples (count-based window) or the
+    samples within the given duration from the latest sample (time-based
+    window, which also holds at most N samples).  Statistics are updated
+    incrementally as samples enter and leave the window, in amortized O(1) per
+    sample regardless of the window size:
+
+    - Mean and variance: Welford's algorithm, extended to removal of samples.
+      Removal accumulates rounding error, so mean and variance are
+      recomputed over the window once as many samples as the window holds
+      have been removed (O(N) every N removals).
+    - Min and max: monotonic deques of samples that can still become the
+      minimum (maximum) of the window
+
+    All storage is allocated by the constructor, and Push() does not allocate.
+    Compare with Reduction::Reduce(), which recomputes over all samples.
+*/
+class SCLIB_EXPORT SlidingWindowStatistics
+{
+public:
+    //! Typedef of window type
+    typedef enum {
+        WINDOW_COUNT, /*!< Latest N samples */
+        WINDOW_TIME   /*!< Samples within duration from the latest sample */
+    } WindowType;
+
+protected:
+    struct SampleType {
+        double Value;
+        TimestampType Timestamp;
+        //! Sequence number of sample (to match deque entries with samples leaving the window)
+        boost::uint64_t Sequence;
+    };
+    typedef RingBuffer<SampleType> SamplesType;
+
+    const WindowType Type;
+    //! Duration of time-based window (in nanoseconds)
+    const TimestampType Duration;
+
+    //! Samples in window (oldest first)
+    SamplesType Samples;
+    //! Samples in increasing (MinDeque) and decreasing (MaxDeque) order of value
+    SamplesType MinDeque;
+    SamplesType MaxDeque;
+
+    //! Sequence number of next sample
+    boost::uint64_t Sequence;
+
+    //! Running mean and sum of squared deviations from mean
+    double Mean;
+    double M2;
+    //! Number of samples removed since Mean and M2 were recomputed
+    size_t Removals;
+
+    //! Remove the oldest sample from window
+    void PopOldest(void);
+
+    //! Recompute Mean and M2 over samples in window (two-pass)
+    void Recompute(void);
+
+    static SampleType Prototype(void);
+
+public:
+    //! Count-based window of the latest size samples
+    SlidingWindowStatistics(size_t size);
+    //! Time-based window of duration (in nanoseconds) holding at most maxSize samples
+    SlidingWindowStatistics(TimestampType duration, size_t maxSize);
+
+    //! Add sample to window (timestamp is used by time-based window)
+    /*!
+        Samples leave a time-based window when their timestamp is not later
+        than (timestamp - duration); timestamps should not decrease.
+    */
+    void Push(double value, TimestampType timestamp = 0);
+
+    //! Remove all samples
+    void Reset(void);
+
+    inline WindowType GetType(void) const        { return Type; }
+    inline TimestampType GetDuration(void) const { return Duration; }
+    inline size_t GetMaxSize(void) const         { return Samples.GetCapacity(); }
+
+    //! Returns number of samples in window
+    inline size_t GetSize(void) const { return Samples.GetSize(); }
+    inline bool IsEmpty(void) const   { return Samples.IsEmpty(); }
+
+    //! Statistics of samples in window (0 if window is empty)
+    inline double GetMean(void) const { return Mean; }
+    //! Population variance, i.e., divided by the number of samples
+    double GetVariance(void) const;
+    inline double GetMin(void) const { return (MinDeque.IsEmpty() ? 0.0 : MinDeque.Front().Value); }
+    inline double GetMax(void) const { return (MaxDeque.IsEmpty() ? 0.0 : MaxDeque.Front().Value); }
+
+    void ToStream(std::ostream & os) const;
+};
+
+inline std::ostream & operator << (std::ostream & os, const SlidingWindowStatistics & window)
+{
+    window.ToStream(os);
+    return os;
+}
+
+};
+
+#endif // _SlidingWindow_h
@@ -198,6 +198,8 @@ public:
     // Called by filter when event is generated.  Event information such as timestamp,
     // location, and severity is encoded in JSON.
     // Creates event instance internally and calls the other OnEvent() method
+    // TODO: Accept typed events (SC::FilterEvent) without JSON round-trip once this
+    // library builds again; until then, filter events reach Coordinator in JSON.
     bool OnEvent(const std::string & event);
     // Called by subscriber when service state change is propagated from other component.
     bool OnEventPropagation(const JsonWrapper::JsonValue & json);
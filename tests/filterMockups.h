@@ -0,0 +1,100 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+// Mock-up filter and event sink shared by filter tests
+//
+#ifndef _filterMockups_h
+#define _filterMockups_h
+
+#include "gtest/gtest.h"
+#include "safecass/filterBase.h"
+
+#include <sstream>
+
+namespace SC {
+
+// Mock-up filter that writes signals of given type (runs in pipeline ahead of
+// filters under test)
+template <class _valueType = double>
+class FilterSource: public FilterBase
+{
+public:
+    typedef ParamEigen<_valueType> ParamType;
+
+protected:
+    std::vector<ParamType *> Outputs;
+
+    void AddSignal(const std::string & name, const _valueType & initial) {
+        Outputs.push_back(new ParamType(initial));
+        AddOutputSignal(*Outputs.back(), name);
+    }
+
+public:
+    // Writes signal "x"
+    FilterSource(const _valueType & initial)
+        : FilterBase("source", FILTERING_INTERNAL, StateMachineInfo(State::STATEMACHINE_APP, "aComponent"))
+    {
+        AddSignal("x", initial);
+    }
+
+    // Writes n signals "x0", "x1", ...
+    FilterSource(size_t n, const _valueType & initial)
+        : FilterBase("source", FILTERING_INTERNAL, StateMachineInfo(State::STATEMACHINE_APP, "aComponent"))
+    {
+        for (size_t i = 0; i < n; ++i) {
+            std::stringstream ss;
+            ss << "x" << i;
+            AddSignal(ss.str(), initial);
+        }
+    }
+
+    ~FilterSource() {
+        for (size_t i = 0; i < Outputs.size(); ++i)
+            delete Outputs[i];
+    }
+
+    inline ParamType & Out(size_t index = 0) { return *Outputs[index]; }
+
+    bool ConfigureFilter(const Json::Value & /*jsonNode*/) { return true; }
+    bool InitFilter(void) { return true; }
+    void RunFilter(void) {}
+    void CleanupFilter(void) {}
+};
+
+// Event sink that records names, timestamps, and elements in violation of events
+// (typed events arrive serialized; see FilterEventSink)
+class EventRecorder: public FilterEventSink
+{
+public:
+    std::vector<std::string> Events;
+    std::vector<TimestampType> Timestamps;
+    std::vector<Json::Value> Elements;
+
+    void OnFilterEvent(const FilterBase * /*filter*/, TimestampType timestamp, const std::string & event) {
+        Json::Value json;
+        Json::Reader reader;
+        ASSERT_TRUE(reader.parse(event, json));
+        Events.push_back(json["event"]["name"].asString());
+        Timestamps.push_back(timestamp);
+        Elements.push_back(json["event"]["elements"]);
+    }
+
+    void Clear(void) {
+        Events.clear();
+        Timestamps.clear();
+        Elements.clear();
+    }
+};
+
+};
+
+#endif // _filterMockups_h
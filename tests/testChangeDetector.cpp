@@ -0,0 +1,248 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include "gtest/gtest.h"
+#include "safecass/changeDetector.h"
+#include "safecass/filterDriftDetection.h"
+#include "safecass/filterPipeline.h"
+#include "filterMockups.h"
+
+#include <cmath>
+#include <limits>
+
+using namespace SC;
+
+namespace {
+
+// Deterministic noise in [-0.3, 0.3] with zero mean over 4 samples
+double Noise(size_t i)
+{
+    static const double noise[4] = { 0.3, -0.1, 0.1, -0.3 };
+    return noise[i % 4];
+}
+
+// Pushes samples of given mean and returns index of first alarm (n if none)
+size_t PushUntilAlarm(ChangeDetector & detector, double mean, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        if (detector.Push(mean + Noise(i)))
+            return i;
+    return n;
+}
+
+};
+
+TEST(ChangeDetector, Create)
+{
+    ChangeDetector::DetectorType type;
+    EXPECT_TRUE(ChangeDetector::GetDetectorTypeFromString("CUSUM", type));
+    EXPECT_EQ(ChangeDetector::DETECTOR_CUSUM, type);
+    EXPECT_TRUE(ChangeDetector::GetDetectorTypeFromString("page_hinkley", type));
+    EXPECT_EQ(ChangeDetector::DETECTOR_PAGE_HINKLEY, type);
+    EXPECT_TRUE(ChangeDetector::GetDetectorTypeFromString("ewma", type));
+    EXPECT_EQ(ChangeDetector::DETECTOR_EWMA, type);
+    EXPECT_FALSE(ChangeDetector::GetDetectorTypeFromString("shewhart", type));
+    EXPECT_EQ("page_hinkley", ChangeDetector::GetDetectorTypeString(ChangeDetector::DETECTOR_PAGE_HINKLEY));
+
+    EXPECT_TRUE(ChangeDetector::Create(ChangeDetector::DETECTOR_CUSUM, -1.0, 5.0) == 0);
+    EXPECT_TRUE(ChangeDetector::Create(ChangeDetector::DETECTOR_PAGE_HINKLEY, 0.1, 0.0) == 0);
+    EXPECT_TRUE(ChangeDetector::Create(ChangeDetector::DETECTOR_EWMA, 1.5, 3.0) == 0);
+
+    ChangeDetector * detector = ChangeDetector::Create(ChangeDetector::DETECTOR_EWMA, 0.2, 3.0);
+    ASSERT_TRUE(detector != 0);
+    EXPECT_EQ(ChangeDetector::DETECTOR_EWMA, detector->GetType());
+    EXPECT_EQ(0.2, dynamic_cast<EwmaDetector *>(detector)->GetLambda());
+    EXPECT_EQ(3.0, detector->GetThreshold());
+    delete detector;
+}
+
+TEST(ChangeDetector, Cusum)
+{
+    CusumDetector cusum(0.5, 4.0);
+    cusum.SetTarget(10.0);
+
+    // In control: deviations never exceed drift
+    EXPECT_EQ(1000, PushUntilAlarm(cusum, 10.0, 1000));
+    EXPECT_EQ(0.0, cusum.GetStatistic());
+
+    // Shift of +1.5: statistic grows by about 1 per sample
+    const size_t delay = PushUntilAlarm(cusum, 11.5, 100);
+    EXPECT_LE(3, delay);
+    EXPECT_GE(5, delay);
+    EXPECT_TRUE(cusum.IsAlarm());
+
+    // Back in control: statistic decreases by drift per sample
+    const double statistic = cusum.GetStatistic();
+    cusum.Push(10.0);
+    EXPECT_DOUBLE_EQ(statistic - 0.5, cusum.GetStatistic());
+    for (size_t i = 0; i < 100; ++i)
+        cusum.Push(10.0 + Noise(i));
+    EXPECT_FALSE(cusum.IsAlarm());
+    EXPECT_EQ(0.0, cusum.GetStatistic());
+
+    // Negative shift
+    cusum.Reset();
+    EXPECT_GT(100, PushUntilAlarm(cusum, 8.5, 100));
+}
+
+TEST(ChangeDetector, WarmUp)
+{
+    CusumDetector cusum(0.5, 4.0);
+    cusum.SetWarmUp(8);
+    EXPECT_TRUE(cusum.IsWarmingUp());
+
+    // No alarm during warm-up, whatever the samples
+    for (size_t i = 0; i < 8; ++i)
+        EXPECT_FALSE(cusum.Push(-3.0 + Noise(i)));
+    EXPECT_FALSE(cusum.IsWarmingUp());
+    EXPECT_DOUBLE_EQ(-3.0, cusum.GetMean());
+    EXPECT_NEAR(std::sqrt(0.05), cusum.GetStdDev(), 1e-12);
+
+    EXPECT_EQ(100, PushUntilAlarm(cusum, -3.0, 100));
+    EXPECT_GT(100, PushUntilAlarm(cusum, -1.0, 100));
+
+    // Target estimated again after reset
+    cusum.Reset();
+    EXPECT_EQ(0, cusum.GetCount());
+    EXPECT_EQ(100, PushUntilAlarm(cusum, -1.0, 100));
+    EXPECT_DOUBLE_EQ(-1.0, cusum.GetMean());
+}
+
+TEST(ChangeDetector, PageHinkley)
+{
+    PageHinkleyDetector ph(0.5, 5.0);
+
+    // No target needed: running mean follows the signal
+    EXPECT_EQ(1000, PushUntilAlarm(ph, 42.0, 1000));
+
+    // Detects shift in either direction
+    EXPECT_GT(20, PushUntilAlarm(ph, 44.0, 100));
+    ph.Reset();
+    EXPECT_EQ(1000, PushUntilAlarm(ph, 42.0, 1000));
+    EXPECT_GT(20, PushUntilAlarm(ph, 40.0, 100));
+}
+
+TEST(ChangeDetector, Ewma)
+{
+    EwmaDetector ewma(0.2, 3.0);
+    ewma.SetTarget(0.0, 0.2);
+
+    EXPECT_EQ(1000, PushUntilAlarm(ewma, 0.0, 1000));
+    EXPECT_GT(20, PushUntilAlarm(ewma, 0.5, 100));
+    EXPECT_TRUE(ewma.IsAlarm());
+
+    // Average decays towards target once back in control
+    for (size_t i = 0; i < 100; ++i)
+        ewma.Push(Noise(i));
+    EXPECT_FALSE(ewma.IsAlarm());
+    EXPECT_NEAR(0.0, ewma.GetAverage(), 0.2);
+
+    // Constant signal in control
+    ewma.SetTarget(1.0, 0.0);
+    EXPECT_FALSE(ewma.Push(1.0));
+    EXPECT_TRUE(ewma.Push(1.1));
+}
+
+TEST(FilterDriftDetection, Json)
+{
+    const std::string config =
+        "{ \"target\": { \"type\": \"s_A\", \"component\": \"robot\" },"
+        "  \"type\": \"INTERNAL\","
+        "  \"argument\": {"
+        "    \"input_signal\": \"x\", \"detector\": \"ewma\","
+        "    \"drift\": 0.1, \"threshold\": 3.0, \"mean\": 1.0, \"stddev\": 0.5,"
+        "    \"event_onset\": \"EVT_DRIFT\", \"event_completion\": \"/EVT_DRIFT\" } }";
+    Json::Value json;
+    Json::Reader reader;
+    ASSERT_TRUE(reader.parse(config, json));
+
+    FilterBase * filter = FilterDriftDetection::Create(json);
+    FilterDriftDetection * drift = dynamic_cast<FilterDriftDetection *>(filter);
+    ASSERT_TRUE(drift != 0);
+    EXPECT_EQ("FilterDriftDetection", drift->GetFilterName());
+    EXPECT_EQ("x", drift->GetNameOfInputSignal());
+    EXPECT_EQ(2, drift->GetNumberOfOutputSignal());
+    EXPECT_EQ("EVT_DRIFT", drift->GetEventNameOnset());
+    EXPECT_EQ("/EVT_DRIFT", drift->GetEventNameCompletion());
+    EXPECT_EQ(ChangeDetector::DETECTOR_EWMA, drift->GetDetector().GetType());
+    EXPECT_EQ(3.0, drift->GetDetector().GetThreshold());
+    EXPECT_EQ(1.0, drift->GetDetector().GetMean());
+    EXPECT_EQ(0.5, drift->GetDetector().GetStdDev());
+    delete filter;
+
+    // Target estimated from warm-up
+    json["argument"].removeMember("mean");
+    json["argument"]["detector"] = "cusum";
+    json["argument"]["warm_up"] = 50;
+    filter = FilterDriftDetection::Create(json);
+    drift = dynamic_cast<FilterDriftDetection *>(filter);
+    EXPECT_EQ(ChangeDetector::DETECTOR_CUSUM, drift->GetDetector().GetType());
+    EXPECT_EQ(50, drift->GetDetector().GetWarmUp());
+    delete filter;
+
+    // Neither target nor warm-up: default detector is kept
+    json["argument"].removeMember("warm_up");
+    json["argument"]["detector"] = "ewma";
+    filter = FilterDriftDetection::Create(json);
+    EXPECT_EQ(ChangeDetector::DETECTOR_CUSUM, dynamic_cast<FilterDriftDetection *>(filter)->GetDetector().GetType());
+    delete filter;
+}
+
+TEST(FilterDriftDetection, Run)
+{
+    FilterSource<> source(0.0);
+    FilterDriftDetection drift(FilterBase::FILTERING_INTERNAL, FilterBase::StateMachineInfo(State::STATEMACHINE_APP, "aComponent"),
+                               "x", ChangeDetector::DETECTOR_CUSUM, 0.5, 4.0, "EVT_DRIFT", "/EVT_DRIFT");
+    drift.GetDetector().SetTarget(0.0);
+    drift.Enable();
+
+    EventRecorder recorder;
+    drift.SetEventSink(&recorder);
+
+    FilterPipeline pipeline;
+    pipeline.AddFilter(&source);
+    pipeline.AddFilter(&drift);
+
+    for (size_t i = 0; i < 100; ++i) {
+        source.Out().Val = Noise(i);
+        EXPECT_TRUE(pipeline.Run());
+    }
+    EXPECT_TRUE(recorder.Events.empty());
+    EXPECT_EQ(0.0, drift.GetAlarm().Val);
+
+    // NaN samples are ignored
+    source.Out().Val = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_EQ(0.0, drift.GetStatistic().Val);
+
+    // One onset event for the shift (edge-triggered)
+    for (size_t i = 0; i < 20; ++i) {
+        source.Out().Val = 1.5 + Noise(i);
+        EXPECT_TRUE(pipeline.Run());
+    }
+    ASSERT_EQ(1, recorder.Events.size());
+    EXPECT_EQ("EVT_DRIFT", recorder.Events[0]);
+    EXPECT_EQ(1.0, drift.GetAlarm().Val);
+    EXPECT_LT(4.0, drift.GetStatistic().Val);
+    EXPECT_EQ(FilterBase::STATE_DETECTED, drift.GetFilterState());
+
+    // Completion event once statistic falls below threshold
+    for (size_t i = 0; i < 100; ++i) {
+        source.Out().Val = Noise(i);
+        EXPECT_TRUE(pipeline.Run());
+    }
+    ASSERT_EQ(2, recorder.Events.size());
+    EXPECT_EQ("/EVT_DRIFT", recorder.Events[1]);
+    EXPECT_EQ(0.0, drift.GetAlarm().Val);
+    EXPECT_EQ(FilterBase::STATE_ENABLED, drift.GetFilterState());
+}
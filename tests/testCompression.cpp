@@ -0,0 +1,198 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include "gtest/gtest.h"
+#include "safecass/compression.h"
+
+#include <cmath>
+#include <limits>
+
+using namespace SC;
+using namespace SC::Compression;
+
+TEST(Compression, BitStream)
+{
+    WordsType words;
+    BitWriter writer(words);
+    writer.Write(0x5, 3);
+    writer.Write(0xFFFFFFFFFFFFFFFFULL, 64);
+    writer.WriteBit(false);
+    writer.Write(0x123456789ULL, 37);
+    writer.Write(0, 0);
+    EXPECT_EQ(105, writer.GetBitCount());
+    EXPECT_EQ(2, words.size());
+
+    BitReader reader(words);
+    EXPECT_EQ(0x5, reader.Read(3));
+    EXPECT_EQ(0xFFFFFFFFFFFFFFFFULL, reader.Read(64));
+    EXPECT_FALSE(reader.ReadBit());
+    EXPECT_EQ(0x123456789ULL, reader.Read(37));
+
+    EXPECT_EQ(0, ZigZagEncode(0));
+    EXPECT_EQ(1, ZigZagEncode((boost::uint64_t) -1));
+    EXPECT_EQ(2, ZigZagEncode(1));
+    EXPECT_EQ((boost::uint64_t) -3, ZigZagDecode(ZigZagEncode((boost::uint64_t) -3)));
+}
+
+TEST(Compression, Integers)
+{
+    const boost::int64_t minValue = std::numeric_limits<boost::int64_t>::min();
+    const boost::int64_t maxValue = std::numeric_limits<boost::int64_t>::max();
+    boost::int64_t x[BLOCK_SIZE], y[BLOCK_SIZE];
+
+    // Extreme deltas
+    for (size_t i = 0; i < BLOCK_SIZE; ++i)
+        x[i] = (i % 2 ? minValue : maxValue);
+    WordsType words;
+    {
+        BitWriter writer(words);
+        EncodeIntegers(x, BLOCK_SIZE, writer);
+    }
+    BitReader reader(words);
+    DecodeIntegers(reader, BLOCK_SIZE, y);
+    EXPECT_TRUE(std::equal(x, x + BLOCK_SIZE, y));
+
+    // Constant values: first value and width only
+    for (size_t i = 0; i < BLOCK_SIZE; ++i)
+        x[i] = -42;
+    BitWriter writer(words);
+    EncodeIntegers(x, BLOCK_SIZE, writer);
+    EXPECT_EQ(64 + 7, writer.GetBitCount());
+    BitReader reader2(words);
+    DecodeIntegers(reader2, BLOCK_SIZE, y);
+    EXPECT_TRUE(std::equal(x, x + BLOCK_SIZE, y));
+}
+
+TEST(Compression, Timestamps)
+{
+    SC::TimestampType t[BLOCK_SIZE], u[BLOCK_SIZE];
+    for (size_t i = 0; i < BLOCK_SIZE; ++i)
+        t[i] = 1476700000000000000LL + i * 1000000LL + (i % 3);
+
+    WordsType words;
+    BitWriter writer(words);
+    EncodeTimestamps(t, BLOCK_SIZE, writer);
+    // Delta-of-deltas are within [-2, 2]
+    EXPECT_GT(8 * sizeof(t) / 10, writer.GetBitCount());
+
+    BitReader reader(words);
+    DecodeTimestamps(reader, BLOCK_SIZE, u);
+    EXPECT_TRUE(std::equal(t, t + BLOCK_SIZE, u));
+}
+
+template <typename T>
+static void ExpectFloatRoundTrip(const T * x, size_t n)
+{
+    WordsType words;
+    {
+        BitWriter writer(words);
+        ValueCodec<T>::Encode(x, n, writer);
+    }
+    T y[BLOCK_SIZE];
+    BitReader reader(words);
+    ValueCodec<T>::Decode(reader, n, y);
+    for (size_t i = 0; i < n; ++i) {
+        // Bitwise equality (NaN and signed zero included)
+        EXPECT_EQ(0, memcmp(&x[i], &y[i], sizeof(T))) << "index " << i;
+    }
+}
+
+TEST(Compression, Floats)
+{
+    double d[BLOCK_SIZE];
+    float f[BLOCK_SIZE];
+    for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+        d[i] = std::sin(0.01 * i) * 100.0;
+        f[i] = (float) d[i];
+    }
+    d[3] = std::numeric_limits<double>::quiet_NaN();
+    d[4] = -0.0;
+    d[5] = std::numeric_limits<double>::infinity();
+    d[6] = std::numeric_limits<double>::denorm_min();
+    f[7] = -std::numeric_limits<float>::infinity();
+    f[8] = f[9] = f[10];
+    ExpectFloatRoundTrip(d, BLOCK_SIZE);
+    ExpectFloatRoundTrip(f, BLOCK_SIZE);
+    ExpectFloatRoundTrip(d, 1);
+
+    // Unchanged values cost one bit each
+    for (size_t i = 0; i < BLOCK_SIZE; ++i)
+        d[i] = 36.6;
+    WordsType words;
+    BitWriter writer(words);
+    ValueCodec<double>::Encode(d, BLOCK_SIZE, writer);
+    EXPECT_EQ(64 + BLOCK_SIZE - 1, writer.GetBitCount());
+}
+
+TEST(Compression, CompressedColumn)
+{
+    const size_t N = 300;
+    CompressedColumn<int> column(N);
+    EXPECT_EQ(0, column.GetSize());
+    EXPECT_EQ(1.0, column.GetCompressionRatio());
+
+    int value;
+    SC::TimestampType timestamp;
+    bool valid;
+    EXPECT_FALSE(column.Get(0, value, timestamp, valid));
+
+    // Wraps around
+    const size_t total = 1000;
+    for (size_t i = 0; i < total; ++i)
+        column.Push((int) (i / 10), 1000 * i, (i % 7 != 0));
+    EXPECT_EQ(N, column.GetSize());
+    // Open block is not compressed
+    EXPECT_GT(column.GetCompressionRatio(), 2.5);
+
+    for (size_t i = 0; i < N; ++i) {
+        const size_t k = total - N + i;
+        ASSERT_TRUE(column.Get(i, value, timestamp, valid));
+        EXPECT_EQ((int) (k / 10), value);
+        EXPECT_EQ((SC::TimestampType) (1000 * k), timestamp);
+        EXPECT_EQ(k % 7 != 0, valid);
+    }
+    EXPECT_FALSE(column.Get(N, value, timestamp, valid));
+
+    // Range across blocks
+    std::vector<int> values(N);
+    std::vector<SC::TimestampType> timestamps(N);
+    EXPECT_TRUE(column.Read(10, N - 10, &values[0], &timestamps[0], 0));
+    EXPECT_EQ((int) ((total - N + 10) / 10), values[0]);
+    EXPECT_EQ((int) ((total - 1) / 10), values[N - 11]);
+    EXPECT_EQ((SC::TimestampType) (1000 * (total - 1)), timestamps[N - 11]);
+    EXPECT_FALSE(column.Read(10, N, &values[0], 0, 0));
+
+    // Replace samples in sealed and open blocks
+    EXPECT_TRUE(column.Set(0, -5, 7, false));
+    EXPECT_TRUE(column.Set(N - 1, 12345678, 8, true));
+    EXPECT_TRUE(column.Get(0, value, timestamp, valid));
+    EXPECT_EQ(-5, value);
+    EXPECT_EQ(7, timestamp);
+    EXPECT_FALSE(valid);
+    EXPECT_TRUE(column.Get(1, value, timestamp, valid));
+    EXPECT_EQ((int) ((total - N + 1) / 10), value);
+    EXPECT_TRUE(column.Get(N - 1, value, timestamp, valid));
+    EXPECT_EQ(12345678, value);
+
+    // Shrink keeps latest samples
+    column.SetCapacity(50);
+    EXPECT_EQ(50, column.GetSize());
+    EXPECT_TRUE(column.Get(49, value, timestamp, valid));
+    EXPECT_EQ(12345678, value);
+
+    column.Clear();
+    EXPECT_EQ(0, column.GetSize());
+    column.Push(3, 1, true);
+    EXPECT_TRUE(column.Get(0, value, timestamp, valid));
+    EXPECT_EQ(3, value);
+}
@@ -0,0 +1,184 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include "gtest/gtest.h"
+#include "safecass/filterEvent.h"
+#include "safecass/filterThresholdBank.h"
+#include "safecass/filterScheduler.h"
+
+using namespace SC;
+
+namespace {
+
+// Event sink that records typed events and counts events given in JSON
+class TypedRecorder: public FilterEventSink
+{
+public:
+    std::vector<FilterEvent> Events;
+    size_t NumberOfJsonEvents;
+
+    TypedRecorder(void): NumberOfJsonEvents(0) {}
+
+    void OnFilterEvent(const FilterBase * /*filter*/, TimestampType /*timestamp*/, const std::string & /*event*/) {
+        ++NumberOfJsonEvents;
+    }
+    void OnFilterEvent(const FilterBase * filter, const FilterEvent & event) {
+        EXPECT_EQ(filter->GetFilterID(), event.FilterUID);
+        Events.push_back(event);
+    }
+};
+
+// Event sink that handles events in JSON only
+class JsonRecorder: public FilterEventSink
+{
+public:
+    std::vector<Json::Value> Events;
+
+    void OnFilterEvent(const FilterBase * /*filter*/, TimestampType /*timestamp*/, const std::string & event) {
+        Json::Value json;
+        Json::Reader reader;
+        ASSERT_TRUE(reader.parse(event, json));
+        Events.push_back(json);
+    }
+};
+
+const FilterBase::StateMachineInfo Target(State::STATEMACHINE_PROVIDED, "robot", "control");
+
+};
+
+TEST(FilterEvent, Json)
+{
+    StringTable * strings = StringTable::GetInstance();
+
+    FilterEvent event;
+    EXPECT_EQ(0, event.PayloadSize);
+    EXPECT_EQ(0, event.Elements);
+
+    event.FilterUID = 7;
+    event.Name = strings->Intern("EVT_FORCE");
+    event.Timestamp = 1476707588000000123LL;
+    event.TargetType = State::STATEMACHINE_PROVIDED;
+    event.TargetComponent = strings->Intern("robot");
+    event.TargetInterface = strings->Intern("control");
+    EXPECT_EQ("EVT_FORCE", event.GetName());
+
+    // No signal, no payload
+    Json::Value json;
+    event.ToJson(json);
+    EXPECT_EQ(7, json["event"]["fuid"].asInt());
+    EXPECT_EQ("EVT_FORCE", json["event"]["name"].asString());
+    EXPECT_EQ(1476707588000000123LL, json["event"]["timestamp"].asInt64());
+    EXPECT_FALSE(json["event"].isMember("signal"));
+    EXPECT_FALSE(json["event"].isMember("value"));
+    EXPECT_FALSE(json["event"].isMember("elements"));
+    EXPECT_EQ((int) State::STATEMACHINE_PROVIDED, json["target"]["type"].asInt());
+    EXPECT_EQ("robot", json["target"]["component"].asString());
+    EXPECT_EQ("control", json["target"]["interface"].asString());
+
+    // Payload is bounded
+    for (int i = 0; i < FilterEvent::PAYLOAD_SIZE; ++i)
+        EXPECT_TRUE(event.AddPayload(i + 0.5));
+    EXPECT_FALSE(event.AddPayload(10.0));
+    EXPECT_EQ(FilterEvent::PAYLOAD_SIZE, event.PayloadSize);
+
+    event.Signal = strings->Intern("Force");
+    event.AddElement(0);
+    event.AddElement(63);
+    event.AddElement(64);
+
+    Json::Reader reader;
+    json.clear();
+    ASSERT_TRUE(reader.parse(event.ToJsonString(), json));
+    EXPECT_EQ("Force", json["event"]["signal"].asString());
+    EXPECT_EQ(0.5, json["event"]["value"].asDouble());
+    ASSERT_EQ(FilterEvent::PAYLOAD_SIZE, json["event"]["payload"].size());
+    EXPECT_EQ(3.5, json["event"]["payload"][3].asDouble());
+    ASSERT_EQ(2, json["event"]["elements"].size());
+    EXPECT_EQ(0, json["event"]["elements"][0].asInt());
+    EXPECT_EQ(63, json["event"]["elements"][1].asInt());
+
+    std::stringstream ss;
+    ss << event;
+    EXPECT_NE(std::string::npos, ss.str().find("EVT_FORCE"));
+}
+
+TEST(FilterEvent, Emit)
+{
+    FilterThresholdBank bank(FilterBase::FILTERING_INTERNAL, Target);
+    bank.AddSignal("x", 1.0, 0.0, "EVT_X", "/EVT_X");
+    bank.Enable();
+
+    ParamEigen<double> x(0.0);
+    bank.GetInputSignalElement(0)->SetSource(&x);
+
+    // Typed event delivered as such
+    TypedRecorder typed;
+    bank.SetEventSink(&typed);
+
+    FilterBase & filter = bank;
+    x.Val = 2.0;
+    x.SetTimestamp(1000);
+    filter.RunFilter();
+    ASSERT_EQ(1, typed.Events.size());
+    EXPECT_EQ(0, typed.NumberOfJsonEvents);
+
+    const FilterEvent & event = typed.Events[0];
+    EXPECT_EQ("EVT_X", event.GetName());
+    EXPECT_EQ(1000, event.Timestamp);
+    EXPECT_EQ(State::STATEMACHINE_PROVIDED, event.TargetType);
+    EXPECT_EQ("robot", StringTable::GetInstance()->GetString(event.TargetComponent));
+    EXPECT_EQ("control", StringTable::GetInstance()->GetString(event.TargetInterface));
+    EXPECT_EQ(bank.GetInputSignalElement(0)->GetNameID(), event.Signal);
+    ASSERT_EQ(1, event.PayloadSize);
+    EXPECT_EQ(2.0, event.Payload[0]);
+
+    // Sinks that handle JSON only get event serialized
+    JsonRecorder json;
+    bank.SetEventSink(&json);
+
+    x.Val = 0.0;
+    x.SetTimestamp(2000);
+    filter.RunFilter();
+    ASSERT_EQ(1, json.Events.size());
+    EXPECT_EQ("/EVT_X", json.Events[0]["event"]["name"].asString());
+    EXPECT_EQ("x", json.Events[0]["event"]["signal"].asString());
+    EXPECT_EQ(2000, json.Events[0]["event"]["timestamp"].asInt64());
+    EXPECT_EQ("robot", json.Events[0]["target"]["component"].asString());
+}
+
+TEST(FilterEvent, Scheduler)
+{
+    FilterThresholdBank bank(FilterBase::FILTERING_EXTERNAL, Target);
+    bank.AddSignal("x", 1.0, 0.0, "EVT_X", "/EVT_X");
+    bank.Enable();
+
+    ParamEigen<double> x(0.0);
+    bank.GetInputSignalElement(0)->SetSource(&x);
+
+    TypedRecorder typed;
+    {
+        FilterScheduler scheduler(2);
+        scheduler.SetEventSink(&typed);
+        EXPECT_TRUE(scheduler.AddFilter(&bank));
+
+        x.Val = 2.0;
+        x.SetTimestamp(1000);
+        EXPECT_TRUE(scheduler.Run());
+    }
+
+    // Buffered and delivered without serialization
+    ASSERT_EQ(1, typed.Events.size());
+    EXPECT_EQ(0, typed.NumberOfJsonEvents);
+    EXPECT_EQ("EVT_X", typed.Events[0].GetName());
+    EXPECT_EQ(2.0, typed.Events[0].Payload[0]);
+}
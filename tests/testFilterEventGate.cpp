@@ -0,0 +1,310 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include "gtest/gtest.h"
+#include "safecass/filterEventGate.h"
+#include "safecass/filterThresholdBank.h"
+#include "filterMockups.h"
+
+using namespace SC;
+
+namespace {
+
+const TimestampType MS = 1000000LL;
+
+// Returns event of name with value at time t (in milliseconds)
+FilterEvent MakeEvent(const std::string & name, TimestampType t, double value, const std::string & signal = "")
+{
+    FilterEvent event;
+    event.Name = StringTable::GetInstance()->Intern(name);
+    if (!signal.empty())
+        event.Signal = StringTable::GetInstance()->Intern(signal);
+    event.Timestamp = t * MS;
+    event.AddPayload(value);
+    return event;
+}
+
+const FilterBase::StateMachineInfo Target(State::STATEMACHINE_APP, "aComponent");
+
+};
+
+TEST(FilterEventGate, Configure)
+{
+    FilterEventGate gate;
+    EXPECT_FALSE(gate.IsEnabled());
+    EXPECT_FALSE(gate.Configure(-1, 0.0, 0.0));
+    EXPECT_FALSE(gate.Configure(0, 0.0, -1.0));
+    // Hysteresis requires dwell time
+    EXPECT_FALSE(gate.Configure(0, 0.5, 0.0));
+    EXPECT_FALSE(gate.IsEnabled());
+
+    // Inactive gate passes all events
+    EXPECT_TRUE(gate.Configure(0, 0.0, 0.0));
+    EXPECT_TRUE(gate.Push(MakeEvent("on", 0, 1.0)));
+    EXPECT_TRUE(gate.Push(MakeEvent("off", 0, 1.0)));
+
+    Json::Value json;
+    Json::Reader reader;
+    ASSERT_TRUE(reader.parse("{ \"min_dwell_time\": 0.1, \"hysteresis\": 0.5, \"max_rate\": 10 }", json));
+    EXPECT_TRUE(gate.Configure(json));
+    EXPECT_TRUE(gate.IsEnabled());
+    EXPECT_EQ(100 * MS, gate.GetMinDwellTime());
+    EXPECT_EQ(0.5, gate.GetHysteresisBand());
+    EXPECT_EQ(10.0, gate.GetMaxRate());
+    EXPECT_EQ(0, gate.GetDelivered());
+}
+
+TEST(FilterEventGate, Rate)
+{
+    FilterEventGate gate;
+    ASSERT_TRUE(gate.Configure(0, 0.0, 10.0));
+
+    // Level-triggered event at every 1 ms: burst of 10, then one per 100 ms
+    size_t delivered = 0;
+    for (TimestampType t = 0; t < 990; ++t)
+        if (gate.Push(MakeEvent("on", t, 1.0)))
+            ++delivered;
+    EXPECT_EQ(19, delivered);
+    EXPECT_EQ(19, gate.GetDelivered());
+    EXPECT_EQ(990 - 19, gate.GetSuppressed(FilterEventGate::SUPPRESSED_RATE));
+
+    // Flip is held, not dropped, and released once rate allows
+    EXPECT_FALSE(gate.Push(MakeEvent("off", 990, 0.0)));
+    EXPECT_TRUE(gate.HasPendingEvent());
+    FilterEvent released;
+    EXPECT_FALSE(gate.Flush(995 * MS, released));
+    EXPECT_TRUE(gate.Flush(1000 * MS, released));
+    EXPECT_EQ("off", released.GetName());
+    EXPECT_EQ(1, gate.GetReleased());
+
+    // Events in JSON
+    gate.Reset();
+    EXPECT_TRUE(gate.Push((TimestampType) 0));
+    EXPECT_EQ(1, gate.GetDelivered());
+}
+
+TEST(FilterEventGate, Dwell)
+{
+    FilterEventGate gate;
+    ASSERT_TRUE(gate.Configure(100 * MS, 0.0, 0.0));
+
+    FilterEvent released;
+    EXPECT_TRUE(gate.Push(MakeEvent("on", 0, 1.0)));
+
+    // Flip within dwell time held; flip back drops both
+    EXPECT_FALSE(gate.Push(MakeEvent("off", 10, 0.0)));
+    EXPECT_FALSE(gate.Push(MakeEvent("on", 20, 1.0)));
+    EXPECT_FALSE(gate.HasPendingEvent());
+    EXPECT_EQ(2, gate.GetSuppressed(FilterEventGate::SUPPRESSED_DWELL));
+
+    // Flip persists: released when dwell time has passed
+    EXPECT_FALSE(gate.Push(MakeEvent("off", 30, 0.0)));
+    EXPECT_FALSE(gate.Flush(50 * MS, released));
+    EXPECT_TRUE(gate.Flush(100 * MS, released));
+    EXPECT_EQ("off", released.GetName());
+    EXPECT_EQ(30 * MS, released.Timestamp);
+    EXPECT_FALSE(gate.HasPendingEvent());
+
+    // Flip after dwell time passes; events released are not suppressed
+    EXPECT_TRUE(gate.Push(MakeEvent("on", 130, 1.0)));
+    EXPECT_EQ(2, gate.GetDelivered());
+    EXPECT_EQ(1, gate.GetReleased());
+    EXPECT_EQ(2, gate.GetSuppressed());
+
+    // Event held is replaced by later event held
+    EXPECT_FALSE(gate.Push(MakeEvent("off", 140, 0.0)));
+    EXPECT_FALSE(gate.Push(MakeEvent("off", 150, 0.0)));
+    EXPECT_EQ(3, gate.GetSuppressed());
+    EXPECT_TRUE(gate.Flush(230 * MS, released));
+    EXPECT_EQ(150 * MS, released.Timestamp);
+    EXPECT_EQ(7, gate.GetDelivered() + gate.GetSuppressed() + gate.GetReleased());
+}
+
+TEST(FilterEventGate, Hysteresis)
+{
+    FilterEventGate gate;
+    ASSERT_TRUE(gate.Configure(10 * MS, 0.5, 0.0));
+
+    EXPECT_TRUE(gate.Push(MakeEvent("on", 0, 10.6)));
+    EXPECT_FALSE(gate.Push(MakeEvent("off", 20, 10.4)));
+    EXPECT_FALSE(gate.Push(MakeEvent("on", 21, 10.6)));
+    EXPECT_FALSE(gate.Push(MakeEvent("off", 22, 10.2)));
+
+    FilterEvent released;
+    EXPECT_FALSE(gate.Flush(25 * MS, released));
+
+    // Flip out of band passes, and event held is suppressed
+    EXPECT_TRUE(gate.Push(MakeEvent("off", 24, 10.0)));
+    EXPECT_FALSE(gate.HasPendingEvent());
+    EXPECT_EQ(3, gate.GetSuppressed(FilterEventGate::SUPPRESSED_HYSTERESIS));
+
+    // Flip within band is released after dwell time, even if not emitted again
+    // (e.g., edge-triggered filter)
+    EXPECT_FALSE(gate.Push(MakeEvent("on", 40, 10.4)));
+    EXPECT_FALSE(gate.Flush(45 * MS, released));
+    EXPECT_TRUE(gate.Flush(50 * MS, released));
+    EXPECT_EQ("on", released.GetName());
+    EXPECT_EQ(40 * MS, released.Timestamp);
+    EXPECT_EQ(3, gate.GetSuppressed());
+    EXPECT_EQ(2, gate.GetDelivered());
+    EXPECT_EQ(1, gate.GetReleased());
+}
+
+TEST(FilterEventGate, Signals)
+{
+    FilterEventGate gate;
+    ASSERT_TRUE(gate.Configure(10 * MS, 0.5, 0.0));
+
+    // Events of one signal do not hold or drop events of another
+    EXPECT_TRUE(gate.Push(MakeEvent("a_on", 0, 10.0, "a")));
+    EXPECT_TRUE(gate.Push(MakeEvent("b_on", 1, 10.2, "b")));
+    EXPECT_FALSE(gate.Push(MakeEvent("a_off", 2, 0.0, "a")));
+    EXPECT_TRUE(gate.Push(MakeEvent("c_on", 3, 10.0, "c")));
+    EXPECT_TRUE(gate.HasPendingEvent());
+
+    // Hysteresis compares values of the same signal
+    EXPECT_FALSE(gate.Push(MakeEvent("b_off", 20, 10.0, "b")));
+    EXPECT_TRUE(gate.Push(MakeEvent("c_off", 20, 0.0, "c")));
+
+    // Events held are released one by one
+    FilterEvent released;
+    EXPECT_TRUE(gate.Flush(30 * MS, released));
+    EXPECT_EQ("a_off", released.GetName());
+    EXPECT_EQ(2 * MS, released.Timestamp);
+    EXPECT_TRUE(gate.Flush(30 * MS, released));
+    EXPECT_EQ("b_off", released.GetName());
+    EXPECT_FALSE(gate.Flush(30 * MS, released));
+    EXPECT_FALSE(gate.HasPendingEvent());
+
+    // Repeated event drops event held of its signal only
+    EXPECT_TRUE(gate.Push(MakeEvent("a_on", 25, 10.0, "a")));
+    EXPECT_FALSE(gate.Push(MakeEvent("a_off", 26, 0.0, "a")));
+    EXPECT_FALSE(gate.Push(MakeEvent("b_on", 26, 11.0, "b")));
+    EXPECT_FALSE(gate.Push(MakeEvent("a_on", 27, 10.0, "a")));
+    EXPECT_TRUE(gate.HasPendingEvent());
+    EXPECT_TRUE(gate.Flush(100 * MS, released));
+    EXPECT_EQ("b_on", released.GetName());
+    EXPECT_FALSE(gate.HasPendingEvent());
+
+    // Filter that monitors two signals, edge-triggered
+    FilterThresholdBank bank(FilterBase::FILTERING_INTERNAL, Target);
+    bank.AddSignal("a", 1.0, 0.0, "A_on", "A_off");
+    bank.AddSignal("b", 1.0, 0.0, "B_on", "B_off");
+    bank.Enable();
+    ASSERT_TRUE(bank.GetEventGate().Configure(10 * MS, 0.0, 0.0));
+
+    ParamEigen<double> a(0.0), b(0.0);
+    bank.GetInputSignalElement(0)->SetSource(&a);
+    bank.GetInputSignalElement(1)->SetSource(&b);
+
+    EventRecorder recorder;
+    bank.SetEventSink(&recorder);
+
+    FilterBase & filter = bank;
+    const double as[] = { 2.0, 2.0, 0.0, 0.0 };
+    const double bs[] = { 0.0, 2.0, 2.0, 2.0 };
+    const TimestampType ts[] = { 0, 1, 2, 12 };
+    for (size_t i = 0; i < 4; ++i) {
+        a.Val = as[i];
+        b.Val = bs[i];
+        a.SetTimestamp(ts[i] * MS);
+        b.SetTimestamp(ts[i] * MS);
+        filter.RunFilter();
+    }
+    ASSERT_EQ(3, recorder.Events.size());
+    EXPECT_EQ("A_on", recorder.Events[0]);
+    EXPECT_EQ("B_on", recorder.Events[1]);
+    EXPECT_EQ("A_off", recorder.Events[2]);
+    EXPECT_EQ(2 * MS, recorder.Timestamps[2]);
+}
+
+TEST(FilterEventGate, Filter)
+{
+    // Level-triggered filter with input oscillating around threshold
+    FilterThresholdBank bank(FilterBase::FILTERING_INTERNAL, Target, 0.0, 1.0, FilterBase::EVENT_DETECTION_LEVEL);
+    bank.AddSignal("x", 1.0, 0.0, "on", "off");
+    bank.Enable();
+    ASSERT_TRUE(bank.GetEventGate().Configure(5 * MS, 0.5, 0.0));
+
+    ParamEigen<double> x(0.0);
+    bank.GetInputSignalElement(0)->SetSource(&x);
+
+    EventRecorder recorder;
+    bank.SetEventSink(&recorder);
+
+    FilterBase & filter = bank;
+    TimestampType t = 0;
+    for (; t <= 100; ++t) {
+        x.Val = (t & 1) ? 0.95 : 1.05;
+        x.SetTimestamp(t * MS);
+        filter.RunFilter();
+    }
+    ASSERT_EQ(1, recorder.Events.size());
+    EXPECT_EQ("on", recorder.Events[0]);
+
+    x.Val = 0.0;
+    x.SetTimestamp(t * MS);
+    filter.RunFilter();
+    ASSERT_EQ(2, recorder.Events.size());
+    EXPECT_EQ("off", recorder.Events[1]);
+    EXPECT_EQ(100, bank.GetEventGate().GetSuppressed());
+
+    std::stringstream ss;
+    bank.ToStream(ss, true);
+    EXPECT_NE(std::string::npos, ss.str().find("dwell: 4, hysteresis: 96"));
+    ss.str("");
+    bank.ToStream(ss, false);
+    EXPECT_NE(std::string::npos, ss.str().find("100 events suppressed"));
+
+    // Edge-triggered filter with dwell time: held event released by later run
+    FilterThresholdBank edge(FilterBase::FILTERING_INTERNAL, Target);
+    edge.AddSignal("x", 1.0, 0.0, "on", "off");
+    edge.Enable();
+    ASSERT_TRUE(edge.GetEventGate().Configure(100 * MS, 0.0, 0.0));
+    edge.GetInputSignalElement(0)->SetSource(&x);
+    edge.SetEventSink(&recorder);
+    recorder.Clear();
+
+    FilterBase & filterEdge = edge;
+    x.Val = 2.0;
+    x.SetTimestamp(1000 * MS);
+    filterEdge.RunFilter();
+    x.Val = 0.0;
+    x.SetTimestamp(1010 * MS);
+    filterEdge.RunFilter();
+    x.SetTimestamp(1050 * MS);
+    filterEdge.RunFilter();
+    ASSERT_EQ(1, recorder.Events.size());
+    x.SetTimestamp(1100 * MS);
+    filterEdge.RunFilter();
+    ASSERT_EQ(2, recorder.Events.size());
+    EXPECT_EQ("off", recorder.Events[1]);
+    EXPECT_EQ(1010 * MS, recorder.Timestamps[1]);
+
+    // Configuration in JSON
+    const std::string config =
+        "{ \"target\": { \"type\": \"s_A\", \"component\": \"robot\" },"
+        "  \"type\": \"INTERNAL\","
+        "  \"event_output\": { \"min_dwell_time\": 0.05, \"max_rate\": 20 },"
+        "  \"argument\": {"
+        "    \"signals\": ["
+        "      { \"input_signal\": \"y\", \"threshold\": 1.0, \"tolerance\": 0.0,"
+        "        \"event_onset\": \"on\", \"event_completion\": \"off\" } ] } }";
+    Json::Value json;
+    Json::Reader reader;
+    ASSERT_TRUE(reader.parse(config, json));
+    FilterBase * created = FilterThresholdBank::Create(json);
+    EXPECT_EQ(50 * MS, created->GetEventGate().GetMinDwellTime());
+    EXPECT_EQ(20.0, created->GetEventGate().GetMaxRate());
+    delete created;
+}
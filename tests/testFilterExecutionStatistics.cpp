@@ -0,0 +1,79 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include "gtest/gtest.h"
+#include "safecass/filterExecutionStatistics.h"
+
+#include <sstream>
+
+using namespace SC;
+
+TEST(FilterExecutionStatistics, Bins)
+{
+    EXPECT_EQ(0, FilterExecutionStatistics::GetBin(0));
+    EXPECT_EQ(0, FilterExecutionStatistics::GetBin(999));
+    EXPECT_EQ(1, FilterExecutionStatistics::GetBin(1000));
+    EXPECT_EQ(1, FilterExecutionStatistics::GetBin(1999));
+    EXPECT_EQ(2, FilterExecutionStatistics::GetBin(2000));
+    EXPECT_EQ(3, FilterExecutionStatistics::GetBin(4500));
+    EXPECT_EQ(FilterExecutionStatistics::NUMBER_OF_BINS - 1, FilterExecutionStatistics::GetBin(1000000000LL));
+
+    EXPECT_EQ(1, FilterExecutionStatistics::GetBinUpperBound(0));
+    EXPECT_EQ(4, FilterExecutionStatistics::GetBinUpperBound(2));
+    EXPECT_EQ(0, FilterExecutionStatistics::GetBinUpperBound(FilterExecutionStatistics::NUMBER_OF_BINS - 1));
+}
+
+TEST(FilterExecutionStatistics, Record)
+{
+    FilterExecutionStatistics statistics;
+    EXPECT_EQ(0, statistics.GetCount());
+    EXPECT_EQ(0.0, statistics.GetMean());
+    EXPECT_EQ(0, statistics.GetPercentileBin(0.99));
+
+    // 98 runs under 1 us, one of 3 us and one of 1 s
+    for (int i = 0; i < 98; ++i)
+        statistics.Record(500);
+    statistics.Record(3000);
+    statistics.Record(1000000000LL);
+    statistics.RecordDeferred();
+    statistics.RecordOffloaded();
+    statistics.RecordOffloaded();
+    statistics.RecordSkipped();
+
+    EXPECT_EQ(100, statistics.GetCount());
+    EXPECT_EQ(1000000000LL, statistics.GetMax());
+    EXPECT_EQ(98 * 500 + 3000 + 1000000000LL, statistics.GetTotal());
+    EXPECT_EQ(98, statistics.GetBinCount(0));
+    EXPECT_EQ(1, statistics.GetBinCount(2));
+    EXPECT_EQ(1, statistics.GetBinCount(FilterExecutionStatistics::NUMBER_OF_BINS - 1));
+    EXPECT_EQ(0, statistics.GetBinCount(FilterExecutionStatistics::NUMBER_OF_BINS));
+    EXPECT_EQ(1, statistics.GetDeferred());
+    EXPECT_EQ(2, statistics.GetOffloaded());
+    EXPECT_EQ(1, statistics.GetSkipped());
+
+    EXPECT_EQ(0, statistics.GetPercentileBin(0.5));
+    EXPECT_EQ(2, statistics.GetPercentileBin(0.99));
+    EXPECT_EQ(FilterExecutionStatistics::NUMBER_OF_BINS - 1, statistics.GetPercentileBin(1.0));
+
+    std::stringstream ss;
+    ss << statistics;
+    EXPECT_NE(std::string::npos, ss.str().find("runs: 100"));
+    EXPECT_NE(std::string::npos, ss.str().find("p99 < 4 us"));
+    EXPECT_NE(std::string::npos, ss.str().find("offloaded: 2"));
+    EXPECT_NE(std::string::npos, ss.str().find("<1:98"));
+
+    statistics.Reset();
+    EXPECT_EQ(0, statistics.GetCount());
+    EXPECT_EQ(0, statistics.GetBinCount(0));
+    EXPECT_EQ(0, statistics.GetOffloaded());
+}
@@ -0,0 +1,369 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include "gtest/gtest.h"
+#include "safecass/filterPipeline.h"
+
+#include <sstream>
+
+#include <boost/thread.hpp>
+
+using namespace SC;
+
+typedef ParamEigen<double> ParamType;
+
+// Mock-up filter: output = sum of inputs * gain + offset
+class FilterLinear: public FilterBase
+{
+public:
+    ParamType In1, In2;
+    ParamType Out;
+    double Gain, Offset;
+
+    FilterLinear(const std::string & name,
+                 const std::string & input1, const std::string & input2, const std::string & output,
+                 double gain = 1.0, double offset = 0.0)
+        : FilterBase(name, FILTERING_INTERNAL, StateMachineInfo(State::STATEMACHINE_APP, "aComponent")),
+          In1(0.0), In2(0.0), Out(0.0), Gain(gain), Offset(offset)
+    {
+        AddInputSignal(In1, input1);
+        if (!input2.empty())
+            AddInputSignal(In2, input2);
+        AddOutputSignal(Out, output);
+    }
+
+    bool ConfigureFilter(const Json::Value & /*jsonNode*/) { return true; }
+    bool InitFilter(void) { return true; }
+    void RunFilter(void) {
+        double sum = 0.0;
+        for (size_t i = 0; i < GetNumberOfInputSignal(); ++i)
+            sum += GetInputValue<ParamType>(i).Val;
+        Out.Val = sum * Gain + Offset;
+    }
+    void CleanupFilter(void) {}
+};
+
+// Mock-up filter that takes at least given time to run
+class FilterSlow: public FilterLinear
+{
+public:
+    TimestampType Delay;
+
+    FilterSlow(const std::string & name, const std::string & input, const std::string & output,
+               TimestampType microseconds)
+        : FilterLinear(name, input, "", output, 1.0, 1.0), Delay(microseconds * 1000)
+    {}
+
+    void RunFilter(void) {
+        const TimestampType start = GetMonotonicTimestamp();
+        while (GetMonotonicTimestamp() - start < Delay) ;
+        FilterLinear::RunFilter();
+    }
+};
+
+TEST(FilterPipeline, Build)
+{
+    // x -> scale -> x:scaled -> offset -> x:offset -> sum -> out
+    //                    |                            ^
+    //                    +----------------------------+
+    FilterLinear sum("sum", "x:offset", "x:scaled", "out");
+    FilterLinear offset("offset", "x:scaled", "", "x:offset", 1.0, 1.0);
+    FilterLinear scale("scale", "x", "", "x:scaled", 2.0);
+    FilterLinear other("other", "y", "", "y:copy");
+
+    FilterPipeline pipeline;
+    EXPECT_TRUE(pipeline.AddFilter(&sum));
+    EXPECT_TRUE(pipeline.AddFilter(&offset));
+    EXPECT_TRUE(pipeline.AddFilter(&scale));
+    EXPECT_TRUE(pipeline.AddFilter(&other));
+    EXPECT_FALSE(pipeline.AddFilter(&scale));
+    EXPECT_FALSE(pipeline.AddFilter(0));
+    EXPECT_EQ(4, pipeline.GetNumberOfFilters());
+    EXPECT_FALSE(pipeline.IsBuilt());
+    EXPECT_EQ(0, pipeline.GetNumberOfStages());
+
+    EXPECT_TRUE(pipeline.Build());
+    EXPECT_TRUE(pipeline.IsBuilt());
+    ASSERT_EQ(4, pipeline.GetNumberOfStages());
+    EXPECT_TRUE(pipeline.GetStage(0) == &scale);
+    EXPECT_TRUE(pipeline.GetStage(1) == &offset);
+    EXPECT_TRUE(pipeline.GetStage(2) == &sum);
+    EXPECT_TRUE(pipeline.GetStage(3) == &other);
+    EXPECT_TRUE(pipeline.GetStage(4) == 0);
+    EXPECT_FALSE(pipeline.IsLastFilterOfPipeline(0));
+    EXPECT_FALSE(pipeline.IsLastFilterOfPipeline(1));
+    EXPECT_TRUE(pipeline.IsLastFilterOfPipeline(2));
+    EXPECT_TRUE(pipeline.IsLastFilterOfPipeline(3));
+
+    // Bound inputs refer to upstream outputs; others are not bound
+    EXPECT_TRUE(sum.GetInputSignalElement(0)->GetSource() == &offset.Out);
+    EXPECT_TRUE(sum.GetInputSignalElement(1)->GetSource() == &scale.Out);
+    EXPECT_TRUE(offset.GetInputSignalElement(0)->GetSource() == &scale.Out);
+    EXPECT_TRUE(scale.GetInputSignalElement(0)->GetSource() == 0);
+    EXPECT_TRUE(other.GetInputSignalElement(0)->GetSource() == 0);
+
+    // Adding filter invalidates build
+    FilterLinear last("last", "out", "", "out:copy");
+    EXPECT_TRUE(pipeline.AddFilter(&last));
+    EXPECT_FALSE(pipeline.IsBuilt());
+    EXPECT_TRUE(sum.GetInputSignalElement(0)->GetSource() == 0);
+    EXPECT_TRUE(pipeline.Build());
+    EXPECT_FALSE(pipeline.IsLastFilterOfPipeline(2));
+    EXPECT_TRUE(pipeline.IsLastFilterOfPipeline(4));
+}
+
+TEST(FilterPipeline, Run)
+{
+    FilterLinear sum("sum", "x:offset", "x:scaled", "out");
+    FilterLinear offset("offset", "x:scaled", "", "x:offset", 1.0, 1.0);
+    FilterLinear scale("scale", "x", "", "x:scaled", 2.0);
+
+    {
+        FilterPipeline pipeline;
+        pipeline.AddFilter(&sum);
+        pipeline.AddFilter(&offset);
+        pipeline.AddFilter(&scale);
+
+        // Builds pipeline at first run
+        for (int i = 0; i < 10; ++i) {
+            scale.In1.Val = i;
+            EXPECT_TRUE(pipeline.Run());
+            // (2i + 1) + 2i
+            EXPECT_DOUBLE_EQ(4.0 * i + 1.0, sum.Out.Val);
+        }
+        EXPECT_TRUE(pipeline.IsBuilt());
+
+        for (size_t i = 0; i < pipeline.GetNumberOfStages(); ++i) {
+            const FilterPipeline::LatencyType * latency = pipeline.GetLatency(i);
+            ASSERT_TRUE(latency != 0);
+            EXPECT_EQ(10, latency->Count);
+            EXPECT_LE(latency->Min, latency->Max);
+            EXPECT_LE(latency->GetMean(), (double) latency->Max);
+        }
+        EXPECT_TRUE(pipeline.GetLatency(3) == 0);
+
+        std::stringstream ss;
+        pipeline.ReportLatency(ss);
+        EXPECT_NE(std::string::npos, ss.str().find("offset"));
+
+        pipeline.ResetLatency();
+        EXPECT_EQ(0, pipeline.GetLatency(0)->Count);
+    }
+
+    // Inputs are unbound when pipeline is destroyed
+    EXPECT_TRUE(sum.GetInputSignalElement(0)->GetSource() == 0);
+    EXPECT_TRUE(offset.GetInputSignalElement(0)->GetSource() == 0);
+    sum.RunFilter();
+    EXPECT_DOUBLE_EQ(0.0, sum.Out.Val);
+}
+
+TEST(FilterPipeline, Errors)
+{
+    // Circular dependency
+    {
+        FilterLinear a("a", "c:out", "", "a:out");
+        FilterLinear b("b", "a:out", "", "b:out");
+        FilterLinear c("c", "b:out", "", "c:out");
+        FilterLinear d("d", "x", "", "d:out");
+
+        FilterPipeline pipeline;
+        pipeline.AddFilter(&d);
+        pipeline.AddFilter(&a);
+        pipeline.AddFilter(&b);
+        pipeline.AddFilter(&c);
+        EXPECT_FALSE(pipeline.Build());
+        EXPECT_FALSE(pipeline.Run());
+        EXPECT_EQ(0, pipeline.GetNumberOfStages());
+        EXPECT_TRUE(a.GetInputSignalElement(0)->GetSource() == 0);
+    }
+
+    // Filter reading its own output
+    {
+        FilterLinear a("a", "a:out", "", "a:out");
+        FilterPipeline pipeline;
+        pipeline.AddFilter(&a);
+        EXPECT_FALSE(pipeline.Build());
+    }
+
+    // Signal written by more than one filter
+    {
+        FilterLinear a("a", "x", "", "out");
+        FilterLinear b("b", "y", "", "out");
+        FilterPipeline pipeline;
+        pipeline.AddFilter(&a);
+        pipeline.AddFilter(&b);
+        EXPECT_FALSE(pipeline.Build());
+    }
+
+    // Type mismatch
+    {
+        class FilterInt: public FilterLinear {
+        public:
+            ParamEigen<int> InInt;
+            FilterInt(void): FilterLinear("int", "x", "", "int:out"), InInt(0) {
+                AddInputSignal(InInt, "a:out");
+            }
+        };
+        FilterLinear a("a", "x", "", "a:out");
+        FilterInt b;
+        FilterPipeline pipeline;
+        pipeline.AddFilter(&a);
+        pipeline.AddFilter(&b);
+        EXPECT_FALSE(pipeline.Build());
+    }
+}
+
+TEST(FilterPipeline, BudgetDefer)
+{
+    // Every stage alone uses up the budget
+    FilterSlow a("a", "x", "a:out", 200);
+    FilterSlow b("b", "a:out", "b:out", 200);
+    FilterSlow c("c", "b:out", "c:out", 200);
+
+    FilterPipeline pipeline;
+    pipeline.AddFilter(&c);
+    pipeline.AddFilter(&b);
+    pipeline.AddFilter(&a);
+    pipeline.SetBudget(100);
+    EXPECT_EQ(100, pipeline.GetBudget());
+    EXPECT_EQ(FilterPipeline::OVERRUN_DEFER, pipeline.GetOverrunPolicy());
+
+    // One stage per tick, then the pass starts over
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_EQ(1, pipeline.GetNextStage());
+    EXPECT_DOUBLE_EQ(1.0, a.Out.Val);
+    EXPECT_DOUBLE_EQ(0.0, b.Out.Val);
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_EQ(2, pipeline.GetNextStage());
+    EXPECT_DOUBLE_EQ(2.0, b.Out.Val);
+    EXPECT_DOUBLE_EQ(0.0, c.Out.Val);
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_EQ(0, pipeline.GetNextStage());
+    EXPECT_DOUBLE_EQ(3.0, c.Out.Val);
+    EXPECT_EQ(2, pipeline.GetNumberOfOverruns());
+
+    EXPECT_EQ(1, a.GetExecutionStatistics().GetCount());
+    EXPECT_EQ(0, a.GetExecutionStatistics().GetDeferred());
+    EXPECT_EQ(1, b.GetExecutionStatistics().GetDeferred());
+    EXPECT_EQ(2, c.GetExecutionStatistics().GetDeferred());
+    EXPECT_GE(c.GetExecutionStatistics().GetMax(), 200 * 1000);
+
+    std::stringstream ss;
+    pipeline.ReportLatency(ss);
+    EXPECT_NE(std::string::npos, ss.str().find("overruns: 2"));
+
+    // Without budget, all stages run every tick
+    pipeline.SetBudget(0);
+    a.In1.Val = 10.0;
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_DOUBLE_EQ(13.0, c.Out.Val);
+    EXPECT_EQ(2, pipeline.GetNumberOfOverruns());
+}
+
+TEST(FilterPipeline, BudgetOffload)
+{
+    FilterSlow a("a", "x", "a:out", 200);
+    FilterSlow b("b", "a:out", "b:out", 0);
+    FilterSlow c("c", "b:out", "c:out", 0);
+
+    FilterOffloadQueue queue;
+    EXPECT_FALSE(queue.IsBusy());
+    EXPECT_EQ(0, queue.Run());
+
+    FilterPipeline pipeline;
+    pipeline.AddFilter(&a);
+    pipeline.AddFilter(&b);
+    pipeline.AddFilter(&c);
+    pipeline.SetOffloadQueue(&queue);
+    pipeline.SetBudget(100, FilterPipeline::OVERRUN_OFFLOAD);
+
+    // b and c are offloaded
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_TRUE(queue.IsBusy());
+    EXPECT_EQ(0, pipeline.GetNextStage());
+    EXPECT_EQ(1, b.GetExecutionStatistics().GetOffloaded());
+    EXPECT_EQ(1, c.GetExecutionStatistics().GetOffloaded());
+
+    // b and c are skipped until the queue completes, and b reads output of a
+    // at the time of offload
+    a.In1.Val = 10.0;
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_DOUBLE_EQ(11.0, a.Out.Val);
+    EXPECT_EQ(1, b.GetExecutionStatistics().GetSkipped());
+    EXPECT_EQ(1, c.GetExecutionStatistics().GetSkipped());
+    EXPECT_EQ(1, pipeline.GetNumberOfOverruns());
+
+    EXPECT_EQ(2, queue.Run());
+    EXPECT_FALSE(queue.IsBusy());
+    EXPECT_DOUBLE_EQ(3.0, c.Out.Val);
+    EXPECT_EQ(1, c.GetExecutionStatistics().GetCount());
+
+    // b reads output of a in place again
+    pipeline.SetBudget(0);
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_DOUBLE_EQ(13.0, c.Out.Val);
+
+    // Falls back to deferral without queue
+    pipeline.SetOffloadQueue(0);
+    pipeline.SetBudget(100, FilterPipeline::OVERRUN_OFFLOAD);
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_EQ(1, pipeline.GetNextStage());
+    EXPECT_EQ(1, b.GetExecutionStatistics().GetDeferred());
+    EXPECT_FALSE(queue.IsBusy());
+}
+
+TEST(FilterPipeline, UnbindOffloaded)
+{
+    FilterSlow a("a", "x", "a:out", 200);
+    FilterSlow b("b", "a:out", "b:out", 0);
+    FilterSlow c("c", "b:out", "c:out", 50 * 1000);
+
+    FilterOffloadQueue queue;
+
+    // Offloaded stages that have not started are dropped
+    {
+        FilterPipeline pipeline;
+        pipeline.AddFilter(&a);
+        pipeline.AddFilter(&b);
+        pipeline.SetOffloadQueue(&queue);
+        pipeline.SetBudget(100, FilterPipeline::OVERRUN_OFFLOAD);
+        EXPECT_TRUE(pipeline.Run());
+        EXPECT_TRUE(queue.IsBusy());
+    }
+    EXPECT_FALSE(queue.IsBusy());
+    EXPECT_EQ(0, queue.Run());
+    EXPECT_EQ(0, b.GetExecutionStatistics().GetCount());
+
+    // Offloaded stages that are running complete before inputs are unbound
+    {
+        FilterPipeline pipeline;
+        pipeline.AddFilter(&c);
+        pipeline.AddFilter(&b);
+        pipeline.AddFilter(&a);
+        pipeline.SetOffloadQueue(&queue);
+        pipeline.SetBudget(100, FilterPipeline::OVERRUN_OFFLOAD);
+        EXPECT_TRUE(pipeline.Run());
+        EXPECT_TRUE(queue.IsBusy());
+
+        boost::thread monitor(boost::bind(&FilterOffloadQueue::Run, &queue));
+        while (b.GetExecutionStatistics().GetCount() == 0 && queue.IsBusy())
+            boost::this_thread::yield();
+        // c is running; statistics are read while the monitoring thread records
+        std::stringstream ss;
+        ss << c.GetExecutionStatistics();
+        pipeline.SetOffloadQueue(0);
+        EXPECT_FALSE(queue.IsBusy());
+        EXPECT_EQ(1, c.GetExecutionStatistics().GetCount());
+        monitor.join();
+    }
+}
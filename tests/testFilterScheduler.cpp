@@ -0,0 +1,168 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include "gtest/gtest.h"
+#include "safecass/filterScheduler.h"
+
+#include <sstream>
+
+using namespace SC;
+
+typedef ParamEigen<double> ParamType;
+
+// Tick that filters run at (set by test before FilterScheduler::Run())
+static int CurrentTick = 0;
+
+// Mock-up external filter: output = input + 1, emits event at every tick
+class FilterCount: public FilterBase
+{
+public:
+    ParamType In;
+    ParamType Out;
+    std::vector<int> Ticks;
+    TimestampType EventTimestamp;
+    size_t Work;
+
+    FilterCount(const std::string & name, const std::string & input, const std::string & output,
+                TimestampType eventTimestamp = -1, size_t work = 0,
+                FilteringType type = FILTERING_EXTERNAL)
+        : FilterBase(name, type, StateMachineInfo(State::STATEMACHINE_APP, "aComponent")),
+          In(0.0), Out(0.0), EventTimestamp(eventTimestamp), Work(work)
+    {
+        AddInputSignal(In, input);
+        AddOutputSignal(Out, output);
+    }
+
+    bool ConfigureFilter(const Json::Value & /*jsonNode*/) { return true; }
+    bool InitFilter(void) { return true; }
+    void RunFilter(void) {
+        double x = GetInputValue<ParamType>(0).Val;
+        for (size_t i = 0; i < Work; ++i)
+            x = x * 0.999999 + 1e-6;
+        Out.Val = GetInputValue<ParamType>(0).Val + 1.0 + (x - x);
+        Ticks.push_back(CurrentTick);
+        if (EventTimestamp >= 0)
+            EmitEvent(CurrentTick * 1000 + EventTimestamp, GetFilterName());
+    }
+    void CleanupFilter(void) {}
+};
+
+// Event sink that records events
+class EventRecorder: public FilterEventSink
+{
+public:
+    std::vector<std::pair<TimestampType, FilterBase::FilterIDType> > Events;
+
+    void OnFilterEvent(const FilterBase * filter, TimestampType timestamp, const std::string & event) {
+        EXPECT_EQ(filter->GetFilterName(), event);
+        Events.push_back(std::make_pair(timestamp, filter->GetFilterID()));
+    }
+};
+
+TEST(FilterScheduler, Build)
+{
+    FilterCount a("a", "x", "a:out");
+    FilterCount b("b", "a:out", "b:out");
+    FilterCount c("c", "y", "c:out");
+    FilterCount d("d", "b:out", "d:out");
+    FilterCount internal("internal", "z", "z:out", -1, 0, FilterBase::FILTERING_INTERNAL);
+
+    FilterScheduler scheduler(2);
+    EXPECT_EQ(2, scheduler.GetNumberOfWorkers());
+    EXPECT_TRUE(scheduler.AddFilter(&d));
+    EXPECT_TRUE(scheduler.AddFilter(&c));
+    EXPECT_TRUE(scheduler.AddFilter(&b));
+    EXPECT_TRUE(scheduler.AddFilter(&a));
+    EXPECT_FALSE(scheduler.AddFilter(&a));
+    EXPECT_FALSE(scheduler.AddFilter(0));
+    EXPECT_FALSE(scheduler.AddFilter(&internal));
+    EXPECT_EQ(4, scheduler.GetNumberOfFilters());
+
+    // a -> b -> d form one task, c another
+    EXPECT_TRUE(scheduler.Build());
+    EXPECT_EQ(2, scheduler.GetNumberOfTasks());
+
+    // Chained filters run in order within the same tick
+    a.In.Val = 10.0;
+    EXPECT_TRUE(scheduler.Run());
+    EXPECT_DOUBLE_EQ(13.0, d.Out.Val);
+    EXPECT_DOUBLE_EQ(1.0, c.Out.Val);
+}
+
+TEST(FilterScheduler, Run)
+{
+    const size_t numFilters = 64;
+    const int numTicks = 200;
+
+    // Filters emit events in reverse order of timestamp
+    std::vector<FilterCount *> filters;
+    for (size_t i = 0; i < numFilters; ++i) {
+        std::stringstream ss;
+        ss << "filter" << i;
+        filters.push_back(new FilterCount(ss.str(), ss.str() + ":in", ss.str() + ":out",
+                                          (TimestampType) ((numFilters - i) / 2), (i % 4) * 1000));
+    }
+
+    EventRecorder recorder;
+    {
+        FilterScheduler scheduler(4);
+        scheduler.SetEventSink(&recorder);
+        for (size_t i = 0; i < numFilters; ++i)
+            EXPECT_TRUE(scheduler.AddFilter(filters[i]));
+
+        for (CurrentTick = 0; CurrentTick < numTicks; ++CurrentTick)
+            EXPECT_TRUE(scheduler.Run());
+        EXPECT_EQ(numFilters, scheduler.GetNumberOfTasks());
+
+        // Every filter ran once per tick, in order of ticks
+        for (size_t i = 0; i < numFilters; ++i) {
+            ASSERT_EQ(numTicks, filters[i]->Ticks.size());
+            for (int t = 0; t < numTicks; ++t)
+                EXPECT_EQ(t, filters[i]->Ticks[t]);
+        }
+
+        // Events delivered in timestamp order, then in order of filter ID
+        EXPECT_EQ(numFilters * numTicks, scheduler.GetNumberOfEvents());
+        ASSERT_EQ(numFilters * numTicks, recorder.Events.size());
+        for (size_t i = 1; i < recorder.Events.size(); ++i)
+            EXPECT_TRUE(recorder.Events[i - 1] < recorder.Events[i]);
+
+        // Statistics
+        size_t tasks = 0;
+        for (size_t i = 0; i < scheduler.GetNumberOfWorkers(); ++i) {
+            const FilterScheduler::WorkerStatisticsType * stats = scheduler.GetWorkerStatistics(i);
+            ASSERT_TRUE(stats != 0);
+            tasks += stats->Tasks;
+            EXPECT_LE(stats->Steals, stats->Tasks);
+            EXPECT_GE(scheduler.GetUtilization(i), 0.0);
+            EXPECT_LE(scheduler.GetUtilization(i), 1.0);
+        }
+        EXPECT_EQ(numFilters * numTicks, tasks);
+        EXPECT_TRUE(scheduler.GetWorkerStatistics(4) == 0);
+        EXPECT_EQ(0.0, scheduler.GetUtilization(4));
+
+        std::stringstream ss;
+        scheduler.ReportUtilization(ss);
+        EXPECT_NE(std::string::npos, ss.str().find("utilization"));
+
+        scheduler.ResetStatistics();
+        EXPECT_EQ(0, scheduler.GetWorkerStatistics(0)->Tasks);
+        EXPECT_EQ(0.0, scheduler.GetUtilization(0));
+    }
+
+    // Event sinks of filters are restored
+    for (size_t i = 0; i < numFilters; ++i) {
+        EXPECT_TRUE(filters[i]->GetEventSink() == 0);
+        delete filters[i];
+    }
+}
@@ -0,0 +1,162 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include "gtest/gtest.h"
+#include "safecass/filterThresholdBank.h"
+#include "safecass/filterPipeline.h"
+#include "filterMockups.h"
+
+#include <sstream>
+#include <limits>
+
+using namespace SC;
+
+TEST(FilterThresholdBank, Json)
+{
+    const std::string config =
+        "{ \"target\": { \"type\": \"s_A\", \"component\": \"robot\" },"
+        "  \"type\": \"INTERNAL\","
+        "  \"argument\": {"
+        "    \"output_above\": 5.0, \"output_below\": -5.0,"
+        "    \"signals\": ["
+        "      { \"input_signal\": \"x0\", \"threshold\": 1.0, \"tolerance\": 0.5,"
+        "        \"event_onset\": \"EVT_X0\", \"event_completion\": \"/EVT_X0\" },"
+        "      { \"input_signal\": \"x1\", \"threshold\": -2.0, \"tolerance\": 0.0,"
+        "        \"event_onset\": \"EVT_X1\", \"event_completion\": \"/EVT_X1\" } ] } }";
+    Json::Value json;
+    Json::Reader reader;
+    ASSERT_TRUE(reader.parse(config, json));
+
+    FilterBase * filter = FilterThresholdBank::Create(json);
+    FilterThresholdBank * bank = dynamic_cast<FilterThresholdBank *>(filter);
+    ASSERT_TRUE(bank != 0);
+    EXPECT_EQ("FilterThresholdBank", bank->GetFilterName());
+    EXPECT_EQ(FilterBase::FILTERING_INTERNAL, bank->GetFilteringType());
+    EXPECT_EQ("robot", bank->GetStateMachineInfo().GetComponentName());
+    ASSERT_EQ(2, bank->GetNumberOfSignals());
+    EXPECT_EQ(2, bank->GetNumberOfInputSignal());
+    EXPECT_EQ("x1", bank->GetInputSignalName(1));
+    EXPECT_EQ(1.0, bank->GetThreshold(0));
+    EXPECT_EQ(0.5, bank->GetTolerance(0));
+    EXPECT_EQ(-2.0, bank->GetThreshold(1));
+    EXPECT_EQ("EVT_X1", bank->GetEventNameAbove(1));
+    EXPECT_EQ("/EVT_X1", bank->GetEventNameBelow(1));
+    EXPECT_EQ(5.0, bank->GetOutputAbove());
+    EXPECT_EQ(-5.0, bank->GetOutputBelow());
+    ASSERT_EQ(2, bank->GetOutput().Val.size());
+    EXPECT_EQ(-5.0, bank->GetOutput().Val(0));
+
+    std::stringstream ss;
+    bank->ToStream(ss, true);
+    EXPECT_NE(std::string::npos, ss.str().find("EVT_X0"));
+
+    delete filter;
+
+    // Duplicate signal names
+    json["argument"]["signals"][1]["input_signal"] = "x0";
+    filter = FilterThresholdBank::Create(json);
+    EXPECT_EQ(1, dynamic_cast<FilterThresholdBank *>(filter)->GetNumberOfSignals());
+    delete filter;
+}
+
+TEST(FilterThresholdBank, Run)
+{
+    // More than one bitmask word, and not a multiple of vector width
+    const size_t n = 131;
+
+    FilterSource<> source(n, 0.0);
+    FilterThresholdBank bank(FilterBase::FILTERING_INTERNAL, FilterBase::StateMachineInfo(State::STATEMACHINE_APP, "aComponent"));
+    for (size_t i = 0; i < n; ++i) {
+        std::stringstream ss;
+        ss << "x" << i;
+        EXPECT_TRUE(bank.AddSignal(ss.str(), (double) i, 0.5, ss.str(), "/" + ss.str()));
+    }
+    EXPECT_FALSE(bank.AddSignal("x0", 0.0, 0.0, "", ""));
+    ASSERT_EQ(n, bank.GetNumberOfSignals());
+
+    EventRecorder recorder;
+    bank.SetEventSink(&recorder);
+
+    FilterPipeline pipeline;
+    pipeline.AddFilter(&source);
+    pipeline.AddFilter(&bank);
+
+    // Disabled filter does not run
+    source.Out(0).Val = 100.0;
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_EQ(0, bank.GetNumberOfCrossings());
+
+    bank.Enable();
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_EQ(1, bank.GetNumberOfCrossings());
+    ASSERT_EQ(1, recorder.Events.size());
+    EXPECT_EQ("x0", recorder.Events[0]);
+    EXPECT_TRUE(bank.IsAbove(0));
+    EXPECT_EQ(1.0, bank.GetOutput().Val(0));
+    EXPECT_EQ(FilterBase::STATE_DETECTED, bank.GetFilterState());
+
+    // No event without crossing (edge-triggered)
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_EQ(1, recorder.Events.size());
+
+    // Tolerance, signals in second word, NaN
+    source.Out(0).Val = 0.5;   // not above 0 + 0.5
+    source.Out(70).Val = 70.6;
+    source.Out(130).Val = 130.6;
+    source.Out(129).Val = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_TRUE(pipeline.Run());
+    ASSERT_EQ(4, recorder.Events.size());
+    EXPECT_EQ("/x0", recorder.Events[1]);
+    EXPECT_EQ("x70", recorder.Events[2]);
+    EXPECT_EQ("x130", recorder.Events[3]);
+    EXPECT_EQ(4, bank.GetNumberOfCrossings());
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(i == 70 || i == 130, bank.IsAbove(i));
+        EXPECT_EQ(i == 70 || i == 130 ? 1.0 : 0.0, bank.GetOutput().Val(i));
+    }
+
+    source.Out(70).Val = 0.0;
+    source.Out(130).Val = 0.0;
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_EQ(6, recorder.Events.size());
+    EXPECT_EQ(FilterBase::STATE_ENABLED, bank.GetFilterState());
+}
+
+TEST(FilterThresholdBank, Level)
+{
+    FilterSource<> source(2, 0.0);
+    FilterThresholdBank bank(FilterBase::FILTERING_INTERNAL, FilterBase::StateMachineInfo(State::STATEMACHINE_APP, "aComponent"),
+                             0.0, 1.0, FilterBase::EVENT_DETECTION_LEVEL);
+    bank.AddSignal("x0", 1.0, 0.0, "on0", "off0");
+    bank.AddSignal("x1", 1.0, 0.0, "on1", "off1");
+    bank.Enable();
+
+    EventRecorder recorder;
+    bank.SetEventSink(&recorder);
+
+    FilterPipeline pipeline;
+    pipeline.AddFilter(&source);
+    pipeline.AddFilter(&bank);
+
+    // Onset events at every run above threshold
+    source.Out(1).Val = 2.0;
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_TRUE(pipeline.Run());
+    source.Out(1).Val = 0.0;
+    EXPECT_TRUE(pipeline.Run());
+    ASSERT_EQ(3, recorder.Events.size());
+    EXPECT_EQ("on1", recorder.Events[0]);
+    EXPECT_EQ("on1", recorder.Events[1]);
+    EXPECT_EQ("off1", recorder.Events[2]);
+    EXPECT_EQ(2, bank.GetNumberOfCrossings());
+}
@@ -0,0 +1,244 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include "gtest/gtest.h"
+#include "safecass/filterVectorNorm.h"
+#include "safecass/filterVectorBounds.h"
+#include "safecass/filterVectorRate.h"
+#include "safecass/filterPipeline.h"
+#include "filterMockups.h"
+
+#include <sstream>
+
+using namespace SC;
+
+typedef Eigen::Matrix<double, 6, 1> Vector6d;
+typedef Eigen::Matrix<double, 7, 1> Vector7d;
+
+namespace {
+
+const FilterBase::StateMachineInfo Target(State::STATEMACHINE_APP, "aComponent");
+
+};
+
+TEST(FilterVector, Norm)
+{
+    FilterSource<Eigen::Vector3d> source(Eigen::Vector3d::Zero());
+    FilterVectorNorm<Eigen::Vector3d> norm(FilterBase::FILTERING_INTERNAL, Target, "x", 10.0, 0.5, "on", "off");
+    EXPECT_EQ("FilterVectorNorm", norm.GetFilterName());
+    EXPECT_EQ(3, norm.GetDimension());
+    norm.Enable();
+
+    EventRecorder recorder;
+    norm.SetEventSink(&recorder);
+
+    FilterPipeline pipeline;
+    pipeline.AddFilter(&source);
+    pipeline.AddFilter(&norm);
+
+    // Each element within threshold, but not norm
+    source.Out().Val << 7.0, 7.0, 7.0;
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_DOUBLE_EQ(std::sqrt(147.0), norm.GetOutput().Val);
+    ASSERT_EQ(1, recorder.Events.size());
+    EXPECT_EQ("on", recorder.Events[0]);
+    EXPECT_EQ(FilterBase::STATE_DETECTED, norm.GetFilterState());
+
+    // Within tolerance
+    source.Out().Val << 0.0, 10.4, 0.0;
+    EXPECT_TRUE(pipeline.Run());
+    ASSERT_EQ(2, recorder.Events.size());
+    EXPECT_EQ("off", recorder.Events[1]);
+    EXPECT_FALSE(norm.IsViolation());
+}
+
+TEST(FilterVector, Bounds)
+{
+    const std::string config =
+        "{ \"target\": { \"type\": \"s_A\", \"component\": \"robot\" },"
+        "  \"type\": \"INTERNAL\","
+        "  \"argument\": {"
+        "    \"input_signal\": \"x\","
+        "    \"lower\": -1.0,"
+        "    \"upper\": [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0 ],"
+        "    \"event_onset\": \"EVT_LIMIT\", \"event_completion\": \"/EVT_LIMIT\" } }";
+    Json::Value json;
+    Json::Reader reader;
+    ASSERT_TRUE(reader.parse(config, json));
+
+    FilterBase * filter = FilterVectorBounds<>::Create(json);
+    FilterVectorBounds<> * bounds = dynamic_cast<FilterVectorBounds<> *>(filter);
+    ASSERT_TRUE(bounds != 0);
+    EXPECT_EQ("FilterVectorBounds", bounds->GetFilterName());
+    EXPECT_EQ(7, bounds->GetDimension());
+    EXPECT_EQ(-1.0, bounds->GetLower()(6));
+    EXPECT_EQ(7.0, bounds->GetUpper()(6));
+    EXPECT_EQ("/EVT_LIMIT", bounds->GetEventNameCompletion());
+    filter->Enable();
+
+    EventRecorder recorder;
+    filter->SetEventSink(&recorder);
+
+    FilterSource<Eigen::VectorXd> source(Eigen::VectorXd::Zero(7));
+    FilterPipeline pipeline;
+    pipeline.AddFilter(&source);
+    pipeline.AddFilter(filter);
+
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_TRUE(recorder.Events.empty());
+
+    source.Out().Val(1) = 2.5;
+    source.Out().Val(5) = -1.5;
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_EQ(2.0, bounds->GetOutput().Val);
+    ASSERT_EQ(1, recorder.Events.size());
+    ASSERT_EQ(2, recorder.Elements[0].size());
+    EXPECT_EQ(1, recorder.Elements[0][0].asInt());
+    EXPECT_EQ(5, recorder.Elements[0][1].asInt());
+
+    // Input of wrong size disables filter
+    source.Out().Val = Eigen::VectorXd::Zero(6);
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_TRUE(filter->IsDisabled());
+    EXPECT_EQ(1, recorder.Events.size());
+
+    delete filter;
+
+    // Bounds of different sizes
+    json["argument"]["lower"] = Json::Value(Json::arrayValue);
+    json["argument"]["lower"].append(0.0);
+    filter = FilterVectorBounds<>::Create(json);
+    bounds = dynamic_cast<FilterVectorBounds<> *>(filter);
+    EXPECT_EQ(bounds->GetLower().size(), bounds->GetUpper().size());
+    EXPECT_EQ(bounds->GetDimension(), bounds->GetUpper().size());
+    delete filter;
+}
+
+TEST(FilterVector, Rate)
+{
+    FilterSource<Vector7d> source(Vector7d::Zero());
+    FilterVectorRate<Vector7d> rate(FilterBase::FILTERING_INTERNAL, Target, "x",
+                                    Vector7d::Constant(1.0), "on", "off", FilterBase::EVENT_DETECTION_LEVEL);
+    rate.Enable();
+
+    EventRecorder recorder;
+    rate.SetEventSink(&recorder);
+
+    FilterPipeline pipeline;
+    pipeline.AddFilter(&source);
+    pipeline.AddFilter(&rate);
+
+    // First sample: no previous sample to compare against
+    TimestampType t = 1000000000LL;
+    source.Out().Val(3) = 100.0;
+    source.Out().SetTimestamp(t);
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_TRUE(recorder.Events.empty());
+
+    // 0.09 in 0.1 s: within 1/s
+    t += 100000000LL;
+    source.Out().Val(3) += 0.09;
+    source.Out().SetTimestamp(t);
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_TRUE(recorder.Events.empty());
+
+    // 0.2 in 0.1 s: above 1/s (either direction)
+    t += 100000000LL;
+    source.Out().Val(3) -= 0.2;
+    source.Out().Val(6) = 0.2;
+    source.Out().SetTimestamp(t);
+    EXPECT_TRUE(pipeline.Run());
+    EXPECT_EQ(2.0, rate.GetOutput().Val);
+    ASSERT_EQ(1, recorder.Events.size());
+    EXPECT_EQ("on", recorder.Events[0]);
+    EXPECT_EQ(3, rate.GetElements()[0]);
+    EXPECT_EQ(6, rate.GetElements()[1]);
+
+    // Same timestamp: sample not refreshed, still in violation (level-triggered)
+    EXPECT_TRUE(pipeline.Run());
+    ASSERT_EQ(2, recorder.Events.size());
+    EXPECT_EQ("on", recorder.Events[1]);
+
+    t += 100000000LL;
+    source.Out().SetTimestamp(t);
+    EXPECT_TRUE(pipeline.Run());
+    ASSERT_EQ(3, recorder.Events.size());
+    EXPECT_EQ("off", recorder.Events[2]);
+    EXPECT_EQ(0.0, rate.GetOutput().Val);
+}
+
+TEST(FilterVector, Create)
+{
+    const std::string config =
+        "{ \"target\": { \"type\": \"s_A\", \"component\": \"robot\" },"
+        "  \"type\": \"INTERNAL\","
+        "  \"argument\": {"
+        "    \"input_signal\": \"x\", \"dimension\": 3,"
+        "    \"threshold\": 10.0, \"tolerance\": 0.5,"
+        "    \"rate_limit\": [ 1.0, 2.0, 3.0 ],"
+        "    \"event_onset\": \"on\", \"event_completion\": \"off\" } }";
+    Json::Value json;
+    Json::Reader reader;
+    ASSERT_TRUE(reader.parse(config, json));
+
+    FilterBase * filter = FilterVectorNorm<>::Create(json);
+    FilterVectorNorm<> * norm = dynamic_cast<FilterVectorNorm<> *>(filter);
+    ASSERT_TRUE(norm != 0);
+    EXPECT_EQ("FilterVectorNorm", norm->GetFilterName());
+    EXPECT_EQ(3, norm->GetDimension());
+    EXPECT_EQ(10.0, norm->GetThreshold());
+    EXPECT_EQ(0.5, norm->GetTolerance());
+    EXPECT_EQ("on", norm->GetEventNameOnset());
+    delete filter;
+
+    filter = FilterVectorRate<>::Create(json);
+    FilterVectorRate<> * rate = dynamic_cast<FilterVectorRate<> *>(filter);
+    ASSERT_TRUE(rate != 0);
+    EXPECT_EQ("FilterVectorRate", rate->GetFilterName());
+    EXPECT_EQ(3, rate->GetDimension());
+    ASSERT_EQ(3, rate->GetLimit().size());
+    EXPECT_EQ(3.0, rate->GetLimit()(2));
+    EXPECT_EQ("off", rate->GetEventNameCompletion());
+    delete filter;
+}
+
+TEST(FilterVector, Injection)
+{
+    FilterVectorNorm<Vector6d> norm(FilterBase::FILTERING_INTERNAL, Target, "x", 1.0, 0.0, "on", "off");
+    norm.Enable();
+
+    Vector6d wrench(Vector6d::Zero());
+    ParamEigen<Vector6d> input(wrench);
+    norm.GetInputSignalElement(0)->SetSource(&input);
+
+    // Values of other types are not injected
+    norm.InjectInput("x", ParamEigen<Eigen::VectorXd>(Eigen::VectorXd::Ones(6)), false);
+    EXPECT_EQ(0, norm.GetShallowFaultInjectionQueueSize());
+
+    wrench(5) = 2.0;
+    norm.InjectInput("x", ParamEigen<Vector6d>(wrench), false);
+    EXPECT_EQ(1, norm.GetShallowFaultInjectionQueueSize());
+    std::stringstream ss;
+    norm.ToStream(ss, true);
+    EXPECT_NE(std::string::npos, ss.str().find("\"x\""));
+
+    // Injected value is used for one run in place of the actual value
+    FilterBase & filter = norm;
+    filter.RunFilter();
+    EXPECT_EQ(0, norm.GetShallowFaultInjectionQueueSize());
+    EXPECT_EQ(2.0, norm.GetOutput().Val);
+    EXPECT_TRUE(norm.IsViolation());
+
+    filter.RunFilter();
+    EXPECT_EQ(0.0, norm.GetOutput().Val);
+}
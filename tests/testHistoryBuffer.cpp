@@ -15,9 +15,11 @@
 #include "gtest/gtest.h"
 #include "safecass/historyBuffer.h"
 #include "safecass/signalAccessor.h"
+#include "safecass/signalElement.h"
 
 #include <vector>
 #include <list>
+#include <sstream>
 
 using namespace SC;
 
@@ -69,6 +71,13 @@ TEST(HistoryBuffer, AddSignal_FindSignal_GetSignal)
     EXPECT_EQ(2, hb.GetSignalIndex("IntList"));
     EXPECT_EQ(3, hb.GetSignalIndex("EigenArray33d"));
     EXPECT_EQ(INVALID_INDEX, hb.GetSignalIndex("Double-invalid"));
+
+    // Lookup using interned names
+    const StringIDType id = StringTable::GetInstance()->Find("EigenArray33d");
+    EXPECT_NE(INVALID_STRING_ID, id);
+    EXPECT_TRUE(hb.FindSignal(id));
+    EXPECT_EQ(3, hb.GetSignalIndex(id));
+    EXPECT_EQ(INVALID_INDEX, hb.GetSignalIndex(StringTable::GetInstance()->Intern("Double-invalid")));
 }
 
 TEST(HistoryBuffer, Snapshot)
@@ -206,4 +215,876 @@ TEST(HistoryBuffer, GetNewValueByIndex)
     EXPECT_EQ(aEigenRandom.Val.mean(), aEigenFetched.Val.mean());
 }
 
-// TODO: Test for PushNewValue
+// Signals of the same type are snapshot as a group; make sure that signals
+// added in interleaved order are still captured correctly
+TEST(HistoryBuffer, SnapshotInterleavedTypes)
+{
+    HistoryBuffer hb;
+
+    ParamEigen<int>             aInt1(1), aInt2(2);
+    ParamEigen<double>          aDouble(3.3);
+    ParamEigen<Eigen::Vector3d> aVec(Eigen::Vector3d(4.0, 5.0, 6.0));
+
+    EXPECT_EQ(0, hb.AddSignal(aInt1,   "aInt1"));
+    EXPECT_EQ(1, hb.AddSignal(aDouble, "aDouble"));
+    EXPECT_EQ(2, hb.AddSignal(aVec,    "aVec"));
+    EXPECT_EQ(3, hb.AddSignal(aInt2,   "aInt2"));
+
+    for (int i = 0; i < 3; ++i) {
+        aInt1 = i;
+        aInt2 = -i;
+        aDouble = i * 0.5;
+        aVec.Val.setConstant(i);
+        hb.Snapshot();
+
+        ParamEigen<int> fetchedInt;
+        ParamEigen<double> fetchedDouble;
+        ParamEigen<Eigen::Vector3d> fetchedVec;
+        EXPECT_TRUE(hb.GetNewValue(0, fetchedInt));
+        EXPECT_EQ(i, fetchedInt.Val);
+        EXPECT_TRUE(hb.GetNewValue(3, fetchedInt));
+        EXPECT_EQ(-i, fetchedInt.Val);
+        EXPECT_TRUE(hb.GetNewValue(1, fetchedDouble));
+        EXPECT_EQ(i * 0.5, fetchedDouble.Val);
+        EXPECT_TRUE(hb.GetNewValue(2, fetchedVec));
+        EXPECT_TRUE(fetchedVec.Val == Eigen::Vector3d::Constant(i));
+    }
+}
+
+// Tests for window queries
+TEST(HistoryBuffer, WindowQueries)
+{
+    const size_t N = 4;
+    HistoryBuffer hb(N);
+
+    ParamEigen<int> aInt;
+    EXPECT_EQ(0, hb.AddSignal(aInt, "aInt"));
+
+    SignalWindow<ParamEigen<int> > window;
+    EXPECT_TRUE(hb.GetLastN(0, 10, window));
+    EXPECT_TRUE(window.IsEmpty());
+
+    // Type mismatch and invalid index
+    SignalWindow<ParamEigen<double> > windowDouble;
+    EXPECT_FALSE(hb.GetLastN(0, 10, windowDouble));
+    EXPECT_FALSE(hb.GetLastN(1, 10, window));
+
+    // 6 snapshots wrap around the buffer: samples 3, 4, 5, 6 remain
+    std::vector<TimestampType> timestamps;
+    ParamEigen<double> aDouble;
+    for (int i = 1; i <= 6; ++i) {
+        aInt = i;
+        hb.Snapshot();
+        timestamps.push_back(hb.GetSnapshotTimestamp());
+        // Signal added later has fewer samples
+        if (i == 4) {
+            EXPECT_EQ(1, hb.AddSignal(aDouble, "aDouble"));
+        }
+        usleep(100);
+    }
+
+    EXPECT_TRUE(hb.GetLastN("aInt", 10, window));
+    EXPECT_EQ(N, window.GetSize());
+    for (size_t i = 0; i < window.GetSize(); ++i)
+        EXPECT_EQ(3 + (int) i, window[i].Val);
+
+    EXPECT_TRUE(hb.GetLastN(0, 3, window));
+    EXPECT_EQ(3, window.GetSize());
+    EXPECT_EQ(4, window[0].Val);
+    EXPECT_EQ(6, window[2].Val);
+
+    // Spans cover all samples without gap
+    size_t n = 0;
+    for (size_t i = 0; i < window.FirstSize; ++i, ++n)
+        EXPECT_EQ(4 + (int) n, window.FirstSpan[i].Val);
+    for (size_t i = 0; i < window.SecondSize; ++i, ++n)
+        EXPECT_EQ(4 + (int) n, window.SecondSpan[i].Val);
+    EXPECT_EQ(3, n);
+
+    // Since timestamp of snapshot 4
+    EXPECT_TRUE(hb.GetSince(0, timestamps[3], window));
+    EXPECT_EQ(3, window.GetSize());
+    EXPECT_EQ(4, window[0].Val);
+
+    // Range [snapshot 3, snapshot 5]
+    EXPECT_TRUE(hb.GetRange(0, timestamps[2], timestamps[4], window));
+    EXPECT_EQ(3, window.GetSize());
+    EXPECT_EQ(3, window[0].Val);
+    EXPECT_EQ(5, window[2].Val);
+
+    // Range older than history
+    EXPECT_TRUE(hb.GetRange(0, timestamps[0], timestamps[1], window));
+    EXPECT_TRUE(window.IsEmpty());
+
+    // Signal added after snapshot 4 has samples of snapshots 5 and 6 only
+    EXPECT_TRUE(hb.GetSince(1, timestamps[0], windowDouble));
+    EXPECT_EQ(2, windowDouble.GetSize());
+    EXPECT_TRUE(hb.GetRange(1, timestamps[4], timestamps[4], windowDouble));
+    EXPECT_EQ(1, windowDouble.GetSize());
+}
+
+TEST(HistoryBuffer, SignalHandle)
+{
+    const size_t N = 4;
+    HistoryBuffer hb(N);
+
+    ParamEigen<int>             aInt;
+    ParamEigen<Eigen::Vector3d> aVector(Eigen::Vector3d::Zero());
+
+    SignalHandle<int> handleInt = hb.AddSignal(aInt, "aInt");
+    SignalHandle<Eigen::Vector3d> handleVector = hb.AddSignal(aVector, "aVector");
+    EXPECT_TRUE(handleInt.IsValid());
+    EXPECT_TRUE(handleVector.IsValid());
+    EXPECT_EQ(0, handleInt.GetIndex());
+    EXPECT_EQ(1, handleVector);
+
+    // Duplicate name
+    SignalHandle<int> invalid = hb.AddSignal(aInt, "aInt");
+    EXPECT_FALSE(invalid.IsValid());
+    EXPECT_EQ(INVALID_INDEX, invalid);
+
+    // No sample yet
+    int value;
+    EXPECT_EQ(0, handleInt.GetNumberOfSamples());
+    EXPECT_TRUE(handleInt.GetLatest() == 0);
+    EXPECT_FALSE(handleInt.GetLatestValue(value));
+    EXPECT_FALSE(invalid.GetLatestValue(value));
+
+    for (int i = 1; i <= 6; ++i) {
+        aInt = i;
+        aInt.SetValid();
+        aVector.Val.setConstant(i * 0.5);
+        hb.Snapshot();
+    }
+
+    EXPECT_EQ(N, handleInt.GetNumberOfSamples());
+    EXPECT_TRUE(handleInt.GetLatestValue(value));
+    EXPECT_EQ(6, value);
+
+    ParamEigen<Eigen::Vector3d> latest;
+    EXPECT_TRUE(handleVector.GetLatest(latest));
+    EXPECT_EQ(3.0, latest.Val[2]);
+
+    // Same sample as GetNewValue()
+    ParamEigen<int> arg;
+    EXPECT_TRUE(hb.GetNewValue(handleInt, arg));
+    EXPECT_EQ(arg.Val, handleInt.GetLatest()->Val);
+    EXPECT_EQ(arg.GetTimestamp(), handleInt.GetLatest()->GetTimestamp());
+
+    // Windows
+    SignalWindow<ParamEigen<int> > window;
+    EXPECT_TRUE(handleInt.GetLastN(2, window));
+    EXPECT_EQ(2, window.GetSize());
+    EXPECT_EQ(5, window[0].Val);
+    EXPECT_TRUE(handleInt.GetWindow(0, 1, window));
+    EXPECT_EQ(3, window[0].Val);
+    EXPECT_FALSE(invalid.GetLastN(2, window));
+    EXPECT_TRUE(window.IsEmpty());
+
+    double sum;
+    EXPECT_TRUE(handleInt.ReduceLastN(N, REDUCTION_SUM, sum));
+    EXPECT_EQ(18.0, sum);
+
+    // Handles of existing signals; type is checked once
+    SignalHandle<int> handle = hb.GetSignalHandle<int>("aInt");
+    EXPECT_TRUE(handle.IsValid());
+    EXPECT_TRUE(handle.GetAccessor() == handleInt.GetAccessor());
+    EXPECT_FALSE(hb.GetSignalHandle<double>("aInt").IsValid());
+    EXPECT_FALSE(hb.GetSignalHandle<int>(5).IsValid());
+    EXPECT_FALSE(hb.GetSignalHandle<int>("none").IsValid());
+
+    // Handles remain valid when depth changes
+    EXPECT_TRUE(hb.SetSignalDepth(handleInt, 2));
+    EXPECT_EQ(2, handleInt.GetNumberOfSamples());
+    EXPECT_TRUE(handleInt.GetLatestValue(value));
+    EXPECT_EQ(6, value);
+}
+
+TEST(HistoryBuffer, Reduce)
+{
+    const size_t N = 4;
+    HistoryBuffer hb(N);
+
+    ParamEigen<double> aDouble;
+    EXPECT_EQ(0, hb.AddSignal(aDouble, "aDouble"));
+
+    double result;
+    EXPECT_FALSE(hb.ReduceLastN<double>(0, 10, REDUCTION_SUM, result));
+
+    // 6 snapshots wrap around the buffer: samples 3, 4, 5, 6 remain
+    std::vector<TimestampType> timestamps;
+    for (int i = 1; i <= 6; ++i) {
+        aDouble = i;
+        aDouble.SetValid();
+        hb.Snapshot();
+        timestamps.push_back(hb.GetSnapshotTimestamp());
+        usleep(100);
+    }
+
+    EXPECT_TRUE(hb.ReduceLastN<double>(0, 10, REDUCTION_SUM, result));
+    EXPECT_DOUBLE_EQ(18.0, result);
+    EXPECT_TRUE(hb.ReduceLastN<double>("aDouble", 2, REDUCTION_MEAN, result));
+    EXPECT_DOUBLE_EQ(5.5, result);
+    EXPECT_TRUE(hb.ReduceLastN<double>(0, 3, REDUCTION_MIN, result));
+    EXPECT_DOUBLE_EQ(4.0, result);
+
+    // Range [snapshot 3, snapshot 5]
+    EXPECT_TRUE(hb.ReduceRange<double>(0, timestamps[2], timestamps[4], REDUCTION_MAX, result));
+    EXPECT_DOUBLE_EQ(5.0, result);
+    EXPECT_TRUE(hb.ReduceRange<double>("aDouble", timestamps[2], timestamps[4], REDUCTION_VARIANCE, result));
+    EXPECT_DOUBLE_EQ(2.0 / 3.0, result);
+
+    // Range older than history, type mismatch, and invalid index
+    EXPECT_FALSE(hb.ReduceRange<double>(0, timestamps[0], timestamps[1], REDUCTION_SUM, result));
+    EXPECT_FALSE(hb.ReduceLastN<int>(0, 10, REDUCTION_SUM, result));
+    EXPECT_FALSE(hb.ReduceLastN<double>(1, 10, REDUCTION_SUM, result));
+
+    // Injected values are reduced as well
+    EXPECT_TRUE(hb.PushNewValue(0, ParamEigen<double>(100.0, GetCurrentTimestamp(), true)));
+    EXPECT_TRUE(hb.ReduceLastN<double>(0, 1, REDUCTION_MAX, result));
+    EXPECT_DOUBLE_EQ(100.0, result);
+
+    // Invalid samples are skipped
+    EXPECT_TRUE(hb.PushNewValue(0, ParamEigen<double>(-100.0, GetCurrentTimestamp(), false)));
+    EXPECT_FALSE(hb.ReduceLastN<double>(0, 1, REDUCTION_MAX, result));
+    EXPECT_TRUE(hb.ReduceLastN<double>(0, 10, REDUCTION_SUM, result));
+    EXPECT_DOUBLE_EQ(12.0, result);
+}
+
+// Tests for timestamp lookup
+TEST(HistoryBuffer, GetValueAt)
+{
+    HistoryBuffer hb(4);
+
+    ParamEigen<double>          aDouble;
+    ParamEigen<Eigen::Vector2d> aVec;
+    ParamEigen<std::list<int> > aList;
+    EXPECT_EQ(0, hb.AddSignal(aDouble, "aDouble"));
+    EXPECT_EQ(1, hb.AddSignal(aVec, "aVec"));
+    EXPECT_EQ(2, hb.AddSignal(aList, "aList"));
+
+    ParamEigen<double> fetched;
+    EXPECT_FALSE(hb.GetValueAt(0, GetCurrentTimestamp(), fetched));
+
+    // 6 snapshots wrap around the buffer: samples 3, 4, 5, 6 remain
+    std::vector<TimestampType> ts;
+    for (int i = 1; i <= 6; ++i) {
+        aDouble = i;
+        aDouble.SetValid();
+        aVec.Val.setConstant(i);
+        hb.Snapshot();
+        ts.push_back(hb.GetSnapshotTimestamp());
+        usleep(1000);
+    }
+
+    const TimestampType mid = ts[3] + (ts[4] - ts[3]) / 4;
+
+    EXPECT_TRUE(hb.GetValueAt("aDouble", mid, fetched, HistoryBuffer::LOOKUP_PREVIOUS));
+    EXPECT_EQ(4.0, fetched.Val);
+    EXPECT_TRUE(hb.GetValueAt("aDouble", mid, fetched, HistoryBuffer::LOOKUP_NEAREST));
+    EXPECT_EQ(4.0, fetched.Val);
+    EXPECT_TRUE(hb.GetValueAt("aDouble", mid, fetched, HistoryBuffer::LOOKUP_INTERPOLATE));
+    EXPECT_NEAR(4.0 + (double)(mid - ts[3]) / (ts[4] - ts[3]), fetched.Val, 1e-9);
+    EXPECT_EQ(mid, fetched.GetTimestamp());
+    EXPECT_TRUE(fetched.IsValid());
+
+    ParamEigen<Eigen::Vector2d> fetchedVec;
+    EXPECT_TRUE(hb.GetValueAt(1, mid, fetchedVec, HistoryBuffer::LOOKUP_INTERPOLATE));
+    EXPECT_NEAR(fetched.Val, fetchedVec.Val(0), 1e-9);
+
+    // Exact timestamp of a snapshot
+    EXPECT_TRUE(hb.GetValueAt(0, ts[4], fetched, HistoryBuffer::LOOKUP_PREVIOUS));
+    EXPECT_EQ(5.0, fetched.Val);
+
+    // Before the oldest sample (samples 1 and 2 were overwritten)
+    EXPECT_FALSE(hb.GetValueAt(0, ts[1], fetched, HistoryBuffer::LOOKUP_PREVIOUS));
+    EXPECT_TRUE(hb.GetValueAt(0, ts[1], fetched, HistoryBuffer::LOOKUP_NEAREST));
+    EXPECT_EQ(3.0, fetched.Val);
+
+    // After the latest sample
+    EXPECT_TRUE(hb.GetValueAt(0, ts[5] + 1000000, fetched, HistoryBuffer::LOOKUP_INTERPOLATE));
+    EXPECT_EQ(6.0, fetched.Val);
+
+    // Interpolation is not supported for non-numeric types
+    ParamEigen<std::list<int> > fetchedList;
+    EXPECT_FALSE(hb.GetValueAt(2, mid, fetchedList, HistoryBuffer::LOOKUP_INTERPOLATE));
+    EXPECT_TRUE(hb.GetValueAt(2, mid, fetchedList, HistoryBuffer::LOOKUP_PREVIOUS));
+}
+
+// Interpolation of unsigned and decreasing signals
+TEST(HistoryBuffer, GetValueAtInterpolateUnsigned)
+{
+    HistoryBuffer hb(4);
+
+    ParamEigen<unsigned int> aUInt;
+    ParamEigen<int>          aInt;
+    ParamEigen<double>       aDouble;
+    EXPECT_EQ(0, hb.AddSignal(aUInt, "aUInt"));
+    EXPECT_EQ(1, hb.AddSignal(aInt, "aInt"));
+    EXPECT_EQ(2, hb.AddSignal(aDouble, "aDouble"));
+
+    aUInt = 10u;
+    aInt = 10;
+    aDouble = 10.0;
+    hb.Snapshot(1000);
+    aUInt = 2u;
+    aInt = -3;
+    aDouble = 2.0;
+    hb.Snapshot(2000);
+
+    ParamEigen<unsigned int> fetchedUInt;
+    EXPECT_TRUE(hb.GetValueAt(0, 1500, fetchedUInt, HistoryBuffer::LOOKUP_INTERPOLATE));
+    EXPECT_EQ(6u, fetchedUInt.Val);
+    EXPECT_TRUE(hb.GetValueAt(0, 1750, fetchedUInt, HistoryBuffer::LOOKUP_INTERPOLATE));
+    EXPECT_EQ(4u, fetchedUInt.Val);
+
+    // Integral results are rounded to the nearest value: 10 - 13 * 0.5 = 3.5
+    ParamEigen<int> fetchedInt;
+    EXPECT_TRUE(hb.GetValueAt(1, 1500, fetchedInt, HistoryBuffer::LOOKUP_INTERPOLATE));
+    EXPECT_EQ(4, fetchedInt.Val);
+    EXPECT_TRUE(hb.GetValueAt(1, 1900, fetchedInt, HistoryBuffer::LOOKUP_INTERPOLATE));
+    EXPECT_EQ(-2, fetchedInt.Val);
+
+    ParamEigen<double> fetchedDouble;
+    EXPECT_TRUE(hb.GetValueAt(2, 1250, fetchedDouble, HistoryBuffer::LOOKUP_INTERPOLATE));
+    EXPECT_DOUBLE_EQ(8.0, fetchedDouble.Val);
+}
+
+// Snapshot timestamps going backwards are clamped
+TEST(HistoryBuffer, SnapshotTimestampNonDecreasing)
+{
+    HistoryBuffer hb(8);
+
+    ParamEigen<int> aInt;
+    EXPECT_EQ(0, hb.AddSignal(aInt, "aInt"));
+
+    const TimestampType ts[] = { 1000, 2000, 1500, 3000 };
+    for (int i = 0; i < 4; ++i) {
+        aInt = i;
+        hb.Snapshot(ts[i]);
+    }
+
+    const HistoryBuffer::TimestampsType & timestamps = hb.GetSnapshotTimestamps();
+    ASSERT_EQ(4u, timestamps.size());
+    EXPECT_EQ(2000, timestamps[2]);
+    EXPECT_EQ(3000, timestamps[3]);
+
+    ParamEigen<int> fetched;
+    EXPECT_TRUE(hb.GetValueAt(0, 2500, fetched, HistoryBuffer::LOOKUP_PREVIOUS));
+    EXPECT_EQ(2, fetched.Val);
+    EXPECT_TRUE(hb.GetValueAt(0, 1500, fetched, HistoryBuffer::LOOKUP_PREVIOUS));
+    EXPECT_EQ(0, fetched.Val);
+}
+
+// Compare timestamp lookup with linear scan
+TEST(HistoryBuffer, GetValueAtLinearScan)
+{
+    const size_t N = 1000;
+    HistoryBuffer hb(N);
+
+    ParamEigen<int> aInt;
+    EXPECT_EQ(0, hb.AddSignal(aInt, "aInt"));
+    // Irregular snapshot intervals and wrap-around
+    for (int i = 0; i < (int) (N * 3 / 2); ++i) {
+        aInt = i;
+        hb.Snapshot();
+        if (i % 7 == 0)
+            usleep(i % 5 * 10);
+    }
+
+    const HistoryBuffer::TimestampsType & ts = hb.GetSnapshotTimestamps();
+    ASSERT_EQ(N, ts.size());
+
+    srand(time(0));
+    ParamEigen<int> fetched;
+    for (int k = 0; k < 1000; ++k) {
+        const TimestampType t = ts.front() + rand() % (ts.back() - ts.front() + 1);
+        size_t expected = 0;
+        for (size_t i = 0; i < ts.size(); ++i)
+            if (ts[i] <= t)
+                expected = i;
+
+        EXPECT_TRUE(hb.GetValueAt(0, t, fetched, HistoryBuffer::LOOKUP_PREVIOUS));
+        EXPECT_EQ((int) (N / 2 + expected), fetched.Val);
+    }
+}
+
+TEST(HistoryBuffer, PushNewValue)
+{
+    HistoryBuffer hb(8);
+
+    ParamEigen<int> aInt;
+    ParamEigen<Eigen::Vector2d> aVector;
+    EXPECT_EQ(0, hb.AddSignal(aInt, "aInt"));
+    EXPECT_EQ(1, hb.AddSignal(aVector, "aVector"));
+
+    // No sample yet
+    ParamEigen<int> injected(-1);
+    EXPECT_FALSE(hb.PushNewValue(0, injected));
+
+    std::vector<TimestampType> timestamps;
+    for (int i = 1; i <= 6; ++i) {
+        aInt = i;
+        aVector.Val.setConstant(i);
+        hb.Snapshot();
+        timestamps.push_back(hb.GetSnapshotTimestamp());
+        usleep(100);
+    }
+
+    // Invalid index and type mismatch
+    EXPECT_FALSE(hb.PushNewValue(2, injected));
+    EXPECT_FALSE(hb.PushNewValue(1, injected));
+
+    // Latest sample is replaced, and the next read returns the injected value
+    injected.SetValid(true);
+    EXPECT_TRUE(hb.PushNewValue(0, injected));
+    ParamEigen<int> fetched;
+    EXPECT_TRUE(hb.GetNewValue(0, fetched));
+    EXPECT_EQ(-1, fetched.Val);
+    EXPECT_TRUE(fetched.IsValid());
+    EXPECT_EQ(6, hb.GetSnapshotTimestamps().size());
+
+    // At explicit timestamp: sample of the snapshot at or before timestamp
+    ParamEigen<Eigen::Vector2d> injectedVector(Eigen::Vector2d(10, 20));
+    EXPECT_TRUE(hb.PushNewValue(1, injectedVector, timestamps[2] + 1));
+    ParamEigen<Eigen::Vector2d> fetchedVector;
+    EXPECT_TRUE(hb.GetValueAt(1, timestamps[2], fetchedVector));
+    EXPECT_EQ(Eigen::Vector2d(10, 20), fetchedVector.Val);
+    EXPECT_EQ(timestamps[2] + 1, fetchedVector.GetTimestamp());
+    EXPECT_TRUE(hb.GetValueAt(1, timestamps[3], fetchedVector));
+    EXPECT_EQ(Eigen::Vector2d(4, 4), fetchedVector.Val);
+    EXPECT_FALSE(hb.PushNewValue(1, injectedVector, timestamps[0] - 1));
+
+    // Burst of values replaces the latest samples
+    std::vector<ParamEigen<int> > burst;
+    for (int i = 0; i < 3; ++i)
+        burst.push_back(ParamEigen<int>(100 + i));
+    EXPECT_TRUE(hb.PushNewValues(0, burst));
+
+    SignalWindow<ParamEigen<int> > window;
+    EXPECT_TRUE(hb.GetLastN(0, 6, window));
+    ASSERT_EQ(6, window.GetSize());
+    EXPECT_EQ(3, window[2].Val);
+    EXPECT_EQ(100, window[3].Val);
+    EXPECT_EQ(102, window[5].Val);
+
+    // Burst longer than history fails without modifying samples
+    burst.resize(7, ParamEigen<int>(0));
+    EXPECT_FALSE(hb.PushNewValues(0, burst));
+    EXPECT_TRUE(hb.GetLastN(0, 6, window));
+    EXPECT_EQ(100, window[3].Val);
+
+    // Burst at timestamps; fails as a whole if any timestamp is too old
+    burst.assign(2, ParamEigen<int>(7));
+    std::vector<TimestampType> at;
+    at.push_back(timestamps[0]);
+    at.push_back(timestamps[0] - 1);
+    EXPECT_FALSE(hb.PushNewValues(0, burst, at));
+    EXPECT_TRUE(hb.GetLastN(0, 6, window));
+    EXPECT_EQ(1, window[0].Val);
+
+    at[1] = timestamps[1];
+    burst[1] = 8;
+    EXPECT_TRUE(hb.PushNewValues(0, burst, at));
+    EXPECT_TRUE(hb.GetLastN(0, 6, window));
+    EXPECT_EQ(7, window[0].Val);
+    EXPECT_EQ(8, window[1].Val);
+    EXPECT_EQ(timestamps[1], window[1].GetTimestamp());
+
+    at.pop_back();
+    EXPECT_FALSE(hb.PushNewValues(0, burst, at));
+
+    // Injection via signal element
+    SignalElement signal("aInt", aInt, &hb);
+    EXPECT_FALSE(signal.PushNewValue(injected));
+    signal.SetSignalIndex(0);
+    injected = 55;
+    EXPECT_TRUE(signal.PushNewValue(injected));
+    EXPECT_TRUE(hb.GetNewValue("aInt", fetched));
+    EXPECT_EQ(55, fetched.Val);
+
+    // Regular snapshots are not affected
+    aInt = 7;
+    hb.Snapshot();
+    EXPECT_TRUE(hb.GetNewValue(0, fetched));
+    EXPECT_EQ(7, fetched.Val);
+}
+
+// Fills history buffer with 6 snapshots of signals of different types; the
+// last signal is added after the third snapshot.
+static void FillForSerialization(HistoryBuffer & hb,
+                                 ParamEigen<double> & aDouble,
+                                 ParamEigen<int> & aInt,
+                                 ParamEigen<Eigen::Vector3f> & aVector,
+                                 ParamEigen<Eigen::MatrixXd> & aMatrix,
+                                 ParamEigen<std::vector<short> > & aVec)
+{
+    EXPECT_EQ(0, hb.AddSignal(aDouble, "aDouble"));
+    EXPECT_EQ(1, hb.AddSignal(aInt, "aInt"));
+    EXPECT_EQ(2, hb.AddSignal(aVector, "aVector"));
+    EXPECT_EQ(3, hb.AddSignal(aMatrix, "aMatrix"));
+
+    for (int i = 1; i <= 6; ++i) {
+        aDouble = 1.0 / i;
+        aDouble.SetValid(i % 2 == 0);
+        aInt = -i;
+        aVector.Val = Eigen::Vector3f::Random();
+        aMatrix.Val = Eigen::MatrixXd::Random(2, i % 3 + 1);
+        aVec.Val.assign(i % 3, (short) i);
+        hb.Snapshot();
+        if (i == 3) {
+            EXPECT_EQ(4, hb.AddSignal(aVec, "aVec"));
+        }
+    }
+}
+
+template <typename T>
+static void ExpectSameSamples(const HistoryBuffer & a, const HistoryBuffer & b, const std::string & name)
+{
+    SignalWindow<ParamEigen<T> > wa, wb;
+    EXPECT_TRUE(a.GetLastN(name, 100, wa));
+    EXPECT_TRUE(b.GetLastN(name, 100, wb));
+    ASSERT_EQ(wa.GetSize(), wb.GetSize()) << name;
+    for (size_t i = 0; i < wa.GetSize(); ++i) {
+        EXPECT_TRUE(wa[i].Val == wb[i].Val) << name << "[" << i << "]";
+        EXPECT_EQ(wa[i].IsValid(), wb[i].IsValid());
+        EXPECT_EQ(wa[i].GetTimestamp(), wb[i].GetTimestamp());
+    }
+}
+
+static void SerializeRoundTrip(HistoryBuffer::FormatType format)
+{
+    const size_t N = 4;
+
+    ParamEigen<double>               aDouble;
+    ParamEigen<int>                  aInt;
+    ParamEigen<Eigen::Vector3f>      aVector;
+    ParamEigen<Eigen::MatrixXd>      aMatrix(Eigen::MatrixXd::Zero(2, 2));
+    ParamEigen<std::vector<short> >  aVec;
+    HistoryBuffer src(N);
+    FillForSerialization(src, aDouble, aInt, aVector, aMatrix, aVec);
+
+    std::stringstream ss;
+    EXPECT_TRUE(src.Serialize(ss, format));
+
+    HistoryBuffer dst(N);
+    EXPECT_EQ(0, dst.AddSignal(aDouble, "aDouble"));
+    EXPECT_EQ(1, dst.AddSignal(aInt, "aInt"));
+    EXPECT_EQ(2, dst.AddSignal(aVector, "aVector"));
+    EXPECT_EQ(3, dst.AddSignal(aMatrix, "aMatrix"));
+    EXPECT_EQ(4, dst.AddSignal(aVec, "aVec"));
+    // Existing samples are discarded
+    dst.Snapshot();
+
+    EXPECT_TRUE(dst.Deserialize(ss, format));
+
+    EXPECT_EQ(src.GetSnapshotIndex(), dst.GetSnapshotIndex());
+    ASSERT_EQ(src.GetSnapshotTimestamps().size(), dst.GetSnapshotTimestamps().size());
+    EXPECT_TRUE(std::equal(src.GetSnapshotTimestamps().begin(), src.GetSnapshotTimestamps().end(),
+                           dst.GetSnapshotTimestamps().begin()));
+
+    ExpectSameSamples<double>(src, dst, "aDouble");
+    ExpectSameSamples<int>(src, dst, "aInt");
+    ExpectSameSamples<Eigen::Vector3f>(src, dst, "aVector");
+    ExpectSameSamples<Eigen::MatrixXd>(src, dst, "aMatrix");
+    ExpectSameSamples<std::vector<short> >(src, dst, "aVec");
+
+    SignalWindow<ParamEigen<std::vector<short> > > window;
+    EXPECT_TRUE(dst.GetLastN("aVec", 100, window));
+    EXPECT_EQ(3, window.GetSize());
+
+    // Type mismatch: history buffer is left empty
+    HistoryBuffer mismatch(N);
+    ParamEigen<float> aFloat;
+    EXPECT_EQ(0, mismatch.AddSignal(aFloat, "aDouble"));
+    std::stringstream ss2(ss.str());
+    if (format == HistoryBuffer::FORMAT_BINARY) {
+        EXPECT_FALSE(mismatch.Deserialize(ss2, format));
+        EXPECT_EQ(0, mismatch.GetSnapshotTimestamps().size());
+        EXPECT_EQ(INVALID_INDEX, mismatch.GetSnapshotIndex());
+    }
+}
+
+TEST(HistoryBuffer, SerializeBinary)
+{
+    SerializeRoundTrip(HistoryBuffer::FORMAT_BINARY);
+
+    // Truncated input
+    HistoryBuffer hb(4);
+    ParamEigen<int> aInt;
+    hb.AddSignal(aInt, "aInt");
+    hb.Snapshot();
+
+    std::stringstream ss;
+    EXPECT_TRUE(hb.Serialize(ss, HistoryBuffer::FORMAT_BINARY));
+    const std::string data = ss.str();
+    for (size_t n = 0; n < data.size(); ++n) {
+        std::stringstream truncated(data.substr(0, n));
+        EXPECT_FALSE(hb.Deserialize(truncated, HistoryBuffer::FORMAT_BINARY));
+    }
+}
+
+TEST(HistoryBuffer, SerializeCsv)
+{
+    SerializeRoundTrip(HistoryBuffer::FORMAT_CSV);
+
+    HistoryBuffer hb(4);
+    ParamEigen<int> aInt;
+    ParamEigen<Eigen::Vector2d> aVector;
+    hb.AddSignal(aInt, "aInt");
+    hb.Snapshot();
+    hb.AddSignal(aVector, "aVector");
+    aInt = 7;
+    aInt.SetValid();
+    aVector.Val << 0.5, -1.25;
+    hb.Snapshot();
+
+    std::stringstream ss;
+    EXPECT_TRUE(hb.Serialize(ss, HistoryBuffer::FORMAT_CSV));
+
+    std::string line;
+    std::getline(ss, line);
+    EXPECT_EQ("snapshot,timestamp,aInt,aInt.valid,aInt.timestamp,"
+              "aVector,aVector.valid,aVector.timestamp", line);
+    std::getline(ss, line);
+    EXPECT_EQ(0, line.find("1,"));
+    EXPECT_EQ(line.size() - 3, line.rfind(",,,"));
+    std::getline(ss, line);
+    EXPECT_EQ(0, line.find("2,"));
+    EXPECT_NE(std::string::npos, line.find(",7,1,"));
+    EXPECT_NE(std::string::npos, line.find(",0.5 -1.25,0,"));
+
+    // Malformed input
+    std::stringstream bad("snapshot,timestamp,aInt,aInt.valid,aInt.timestamp\n1,100,x,1,100\n");
+    EXPECT_FALSE(hb.Deserialize(bad, HistoryBuffer::FORMAT_CSV));
+    EXPECT_EQ(0, hb.GetSnapshotTimestamps().size());
+
+    // Text format cannot be imported
+    std::stringstream text;
+    EXPECT_TRUE(hb.Serialize(text));
+    EXPECT_FALSE(hb.Deserialize(text, HistoryBuffer::FORMAT_TEXT));
+}
+
+TEST(HistoryBuffer, PerSignalDepth)
+{
+    HistoryBuffer hb(4);
+
+    ParamEigen<int>  aFast;
+    ParamEigen<bool> aFlag;
+    ParamEigen<int>  aDefault;
+    EXPECT_EQ(0, hb.AddSignal(aFast, "aFast", 8));
+    EXPECT_EQ(1, hb.AddSignal(aFlag, "aFlag", 2));
+    EXPECT_EQ(2, hb.AddSignal(aDefault, "aDefault"));
+
+    EXPECT_EQ(8, hb.GetSignalDepth(0));
+    EXPECT_EQ(2, hb.GetSignalDepth(1));
+    EXPECT_EQ(4, hb.GetSignalDepth(2));
+    EXPECT_EQ(0, hb.GetSignalDepth(3));
+
+    std::vector<TimestampType> timestamps;
+    for (int i = 1; i <= 10; ++i) {
+        aFast = i;
+        aDefault = i;
+        hb.Snapshot();
+        timestamps.push_back(hb.GetSnapshotTimestamp());
+        usleep(100);
+    }
+    // Snapshot timestamps are as deep as the deepest signal
+    EXPECT_EQ(8, hb.GetSnapshotTimestamps().size());
+
+    SignalWindow<ParamEigen<int> > window;
+    EXPECT_TRUE(hb.GetLastN(0, 100, window));
+    EXPECT_EQ(8, window.GetSize());
+    EXPECT_EQ(3, window[0].Val);
+    EXPECT_TRUE(hb.GetLastN(2, 100, window));
+    EXPECT_EQ(4, window.GetSize());
+    EXPECT_EQ(7, window[0].Val);
+
+    SignalWindow<ParamEigen<bool> > flags;
+    EXPECT_TRUE(hb.GetLastN(1, 100, flags));
+    EXPECT_EQ(2, flags.GetSize());
+
+    // Samples remain aligned with snapshot timestamps
+    ParamEigen<int> value;
+    EXPECT_TRUE(hb.GetValueAt(0, timestamps[4], value));
+    EXPECT_EQ(5, value.Val);
+    EXPECT_TRUE(hb.GetValueAt(2, timestamps[7], value));
+    EXPECT_EQ(8, value.Val);
+    EXPECT_FALSE(hb.GetValueAt(2, timestamps[4], value));
+
+    // Shrink: latest samples are kept
+    const size_t before = hb.GetMemoryUsage();
+    EXPECT_TRUE(hb.SetSignalDepth(0, 3));
+    EXPECT_FALSE(hb.SetSignalDepth(0, 0));
+    EXPECT_FALSE(hb.SetSignalDepth(5, 3));
+    EXPECT_GT(before, hb.GetMemoryUsage());
+    EXPECT_EQ(4, hb.GetSnapshotTimestamps().size());
+    EXPECT_TRUE(hb.GetLastN(0, 100, window));
+    EXPECT_EQ(3, window.GetSize());
+    EXPECT_EQ(8, window[0].Val);
+    EXPECT_EQ(10, window[2].Val);
+    EXPECT_TRUE(hb.GetValueAt(0, timestamps[8], value));
+    EXPECT_EQ(9, value.Val);
+
+    // Grow: existing samples are kept, and new samples are appended
+    EXPECT_TRUE(hb.SetBufferSize(16));
+    EXPECT_FALSE(hb.SetBufferSize(0));
+    EXPECT_EQ(16, hb.GetBufferSize());
+    for (size_t i = 0; i < 3; ++i)
+        EXPECT_EQ(16, hb.GetSignalDepth(i));
+    aFast = 11;
+    hb.Snapshot();
+    EXPECT_TRUE(hb.GetLastN(0, 100, window));
+    EXPECT_EQ(4, window.GetSize());
+    EXPECT_EQ(8, window[0].Val);
+    EXPECT_EQ(11, window[3].Val);
+    EXPECT_EQ(5, hb.GetSnapshotTimestamps().size());
+
+    // Memory report
+    std::stringstream ss;
+    EXPECT_TRUE(hb.ReportMemoryUsage(ss));
+    EXPECT_NE(std::string::npos, ss.str().find("aFlag"));
+    EXPECT_TRUE(hb.ReportMemoryUsage(ss, hb.GetMemoryUsage()));
+    EXPECT_FALSE(hb.ReportMemoryUsage(ss, 1));
+    std::cout << ss.str();
+}
+
+TEST(HistoryBuffer, PackedParam)
+{
+    const size_t N = 4;
+    HistoryBuffer hb(N);
+
+    ParamEigen<double> a;
+    SignalHandle<double> handle = hb.AddSignal(a, "a");
+    for (int i = 1; i <= 3; ++i) {
+        a = i;
+        a.SetValid();
+        hb.Snapshot();
+    }
+
+    PackedParam<double> latest;
+    EXPECT_TRUE(handle.GetLatest(latest));
+    EXPECT_EQ(3.0, latest.Val);
+    EXPECT_EQ(handle.GetLatest()->GetTimestamp(), latest.GetTimestamp());
+
+    // Burst of packed values replaces latest samples
+    std::vector<PackedParam<double> > values(2);
+    values[0].Set(20.0, 200, true);
+    values[1].Set(30.0, 300, false);
+    EXPECT_TRUE(hb.PushNewValues(handle, values));
+
+    SignalWindow<ParamEigen<double> > window;
+    EXPECT_TRUE(handle.GetLastN(3, window));
+    EXPECT_EQ(1.0, window[0].Val);
+    EXPECT_EQ(20.0, window[1].Val);
+    EXPECT_EQ(200, window[1].GetTimestamp());
+    EXPECT_TRUE(window[1].IsValid());
+    EXPECT_EQ(30.0, window[2].Val);
+    EXPECT_EQ(300, window[2].GetTimestamp());
+    EXPECT_FALSE(window[2].IsValid());
+
+    // Reductions follow (invalid sample 30.0 is skipped)
+    double mean;
+    EXPECT_TRUE(handle.ReduceLastN(3, REDUCTION_MEAN, mean));
+    EXPECT_DOUBLE_EQ(10.5, mean);
+
+    // Too many values
+    values.resize(N + 1);
+    EXPECT_FALSE(hb.PushNewValues(handle, values));
+
+    EXPECT_TRUE(handle.GetAccessor()->GetPacked(0, latest));
+    EXPECT_EQ(1.0, latest.Val);
+}
+
+TEST(HistoryBuffer, CompressedSignal)
+{
+    const size_t N = 1000;
+    HistoryBuffer hb(N);
+
+    ParamEigen<double> aDouble;
+    ParamEigen<int>    aInt;
+    ParamEigen<float>  aFloat;
+    const HistoryBufferBase::IndexType iDouble = hb.AddCompressedSignal(aDouble, "aDouble");
+    const HistoryBufferBase::IndexType iInt = hb.AddCompressedSignal(aInt, "aInt");
+    const HistoryBufferBase::IndexType iPlain = hb.AddSignal(aFloat, "aFloat");
+    EXPECT_EQ(0, iDouble);
+    EXPECT_EQ(1, iInt);
+    EXPECT_EQ(2, iPlain);
+    EXPECT_EQ(INVALID_INDEX, hb.AddCompressedSignal(aInt, "aDouble"));
+
+    // Slowly varying signals
+    for (size_t i = 0; i < 2 * N; ++i) {
+        aDouble = 20.0 + (double) (i / 50) * 0.25;
+        aDouble.SetValid(i % 100 != 0);
+        aInt = (int) (i / 20);
+        aFloat = (float) i;
+        hb.Snapshot();
+    }
+
+    EXPECT_EQ(N, hb.GetSignalDepth(iDouble));
+    EXPECT_GT(hb.GetCompressionRatio(iDouble), 4.0);
+    EXPECT_GT(hb.GetCompressionRatio(iInt), 4.0);
+    EXPECT_EQ(1.0, hb.GetCompressionRatio(iPlain));
+    EXPECT_EQ(0.0, hb.GetCompressionRatio(INVALID_INDEX));
+    EXPECT_GT(hb.GetMemoryUsage(), 0);
+
+    // Reads through base class
+    ParamEigen<double> d;
+    EXPECT_TRUE(hb.GetNewValue(iDouble, d));
+    EXPECT_EQ(20.0 + (2 * N - 1) / 50 * 0.25, d.Val);
+    EXPECT_TRUE(d.IsValid());
+
+    // Typed reads
+    EXPECT_TRUE(hb.GetCompressedSignalAccessor<float>(iDouble) == 0);
+    EXPECT_TRUE(hb.GetCompressedSignalAccessor<double>(iPlain) == 0);
+    const CompressedSignalAccessor<double> * accessor = hb.GetCompressedSignalAccessor<double>(iDouble);
+    ASSERT_TRUE(accessor != 0);
+    EXPECT_EQ(N, accessor->GetNumberOfSamples());
+    std::vector<ParamEigen<double> > samples;
+    EXPECT_TRUE(accessor->GetSamples(0, N, samples));
+    ASSERT_EQ(N, samples.size());
+    const size_t offset = hb.GetSnapshotTimestamps().size() - N;
+    for (size_t i = 0; i < N; ++i) {
+        EXPECT_EQ(20.0 + (double) ((N + i) / 50) * 0.25, samples[i].Val);
+        EXPECT_EQ((N + i) % 100 != 0, samples[i].IsValid());
+        EXPECT_GE(hb.GetSnapshotTimestamps()[offset + i], samples[i].GetTimestamp());
+    }
+    std::vector<int> ints;
+    EXPECT_TRUE(hb.GetCompressedSignalAccessor<int>(iInt)->GetValues(N - 2, 2, ints));
+    EXPECT_EQ((int) ((2 * N - 1) / 20), ints[1]);
+
+    // Typed accessors of uncompressed signals are not available
+    SignalWindow<ParamEigen<double> > window;
+    EXPECT_FALSE(hb.GetLastN(iDouble, 10, window));
+    EXPECT_FALSE(hb.GetSignalHandle<double>(iDouble).IsValid());
+
+    // Deep fault injection
+    d = -1.0;
+    EXPECT_TRUE(hb.PushNewValue(iDouble, d));
+    EXPECT_TRUE(accessor->GetSample(N - 1, d));
+    EXPECT_EQ(-1.0, d.Val);
+    ParamEigen<int> wrongType;
+    EXPECT_FALSE(hb.PushNewValue(iDouble, wrongType));
+
+    // Memory report includes compression ratio
+    std::stringstream ss;
+    EXPECT_TRUE(hb.ReportMemoryUsage(ss));
+    EXPECT_NE(std::string::npos, ss.str().find("ratio"));
+
+    // History exported from compressed signals can be imported into uncompressed ones
+    std::stringstream binary;
+    EXPECT_TRUE(hb.Serialize(binary, HistoryBuffer::FORMAT_BINARY));
+    HistoryBuffer plain(N);
+    EXPECT_EQ(0, plain.AddSignal(aDouble, "aDouble"));
+    EXPECT_EQ(1, plain.AddSignal(aInt, "aInt"));
+    EXPECT_EQ(2, plain.AddCompressedSignal(aFloat, "aFloat"));
+    EXPECT_TRUE(plain.Deserialize(binary, HistoryBuffer::FORMAT_BINARY));
+    EXPECT_TRUE(plain.GetLastN(iDouble, N, window));
+    ASSERT_EQ(N, window.GetSize());
+    EXPECT_EQ(samples[0].Val, window[0].Val);
+    EXPECT_EQ(samples[0].GetTimestamp(), window[0].GetTimestamp());
+    EXPECT_EQ(-1.0, window[N - 1].Val);
+    ParamEigen<float> f;
+    EXPECT_TRUE(plain.GetNewValue(2, f));
+    EXPECT_EQ((float) (2 * N - 1), f.Val);
+}
@@ -0,0 +1,170 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+// Tests for memory allocation of HistoryBuffer::Snapshot()
+//
+// Heap allocations are counted by interposing malloc() and friends of glibc,
+// which also catches allocations by Eigen (Eigen does not use operator new).
+// On other platforms, allocations are not counted and tests are skipped.
+//
+
+#include "gtest/gtest.h"
+#include "safecass/historyBuffer.h"
+
+#include <vector>
+
+using namespace SC;
+
+namespace {
+
+size_t NumAllocations = 0;
+bool   CountAllocations = false;
+
+//! Counts allocations while an instance of this class is alive
+class AllocationCounter
+{
+public:
+    AllocationCounter(void)  { NumAllocations = 0; CountAllocations = true; }
+    ~AllocationCounter(void) { CountAllocations = false; }
+
+    inline size_t Get(void) const { return NumAllocations; }
+};
+
+};
+
+#if defined(__GLIBC__)
+
+extern "C" {
+    void * __libc_malloc(size_t size);
+    void * __libc_calloc(size_t n, size_t size);
+    void * __libc_realloc(void * p, size_t size);
+
+    void * malloc(size_t size) {
+        if (CountAllocations)
+            ++NumAllocations;
+        return __libc_malloc(size);
+    }
+    void * calloc(size_t n, size_t size) {
+        if (CountAllocations)
+            ++NumAllocations;
+        return __libc_calloc(n, size);
+    }
+    void * realloc(void * p, size_t size) {
+        if (CountAllocations)
+            ++NumAllocations;
+        return __libc_realloc(p, size);
+    }
+}
+
+#define SKIP_IF_NOT_COUNTED
+#else
+#define SKIP_IF_NOT_COUNTED \
+    std::cout << "Allocations are not counted on this platform: test skipped" << std::endl;\
+    return;
+#endif
+
+// Make sure that the hooks above actually count allocations
+TEST(HistoryBufferAllocation, Counter)
+{
+    SKIP_IF_NOT_COUNTED
+
+    size_t n;
+    {
+        AllocationCounter counter;
+        Eigen::VectorXd v(100);
+        std::vector<double> * p = new std::vector<double>(100);
+        delete p;
+        n = counter.Get();
+    }
+    EXPECT_LE(3, n);
+}
+
+TEST(HistoryBufferAllocation, Snapshot)
+{
+    SKIP_IF_NOT_COUNTED
+
+    const size_t N = 16;
+    HistoryBuffer hb(N);
+
+    ParamEigen<double>               aDouble;
+    ParamEigen<int>                  aInt;
+    ParamEigen<bool>                 aBool;
+    ParamEigen<Eigen::Matrix3d>      aMatrix;
+    ParamEigen<Eigen::VectorXd>      aVector(Eigen::VectorXd::Zero(20));
+    ParamEigen<Eigen::MatrixXf>      aMatrixXf(Eigen::MatrixXf::Zero(4, 6));
+    ParamEigen<std::vector<double> > aVec(std::vector<double>(8, 0.0));
+    hb.AddSignal(aDouble, "aDouble");
+    hb.AddSignal(aInt, "aInt");
+    hb.AddSignal(aBool, "aBool");
+    hb.AddSignal(aMatrix, "aMatrix");
+    hb.AddSignal(aVector, "aVector");
+    hb.AddSignal(aMatrixXf, "aMatrixXf", N / 2);
+    hb.AddSignal(aVec, "aVec");
+
+    // No allocation from the very first snapshot, i.e., while filling slots
+    // of rings as well as after rings have wrapped around
+    for (size_t i = 0; i < 3 * N; ++i) {
+        aDouble = (double) i;
+        aInt = (int) i;
+        aVector.Val.setConstant((double) i);
+        aVec.Val[i % 8] = (double) i;
+
+        AllocationCounter counter;
+        hb.Snapshot();
+        EXPECT_EQ(0, counter.Get()) << "snapshot " << i;
+    }
+
+    // Values are copied correctly into preallocated slots
+    SignalWindow<ParamEigen<Eigen::VectorXd> > window;
+    EXPECT_TRUE(hb.GetLastN(4, N, window));
+    EXPECT_EQ(N, window.GetSize());
+    for (size_t i = 0; i < N; ++i) {
+        EXPECT_EQ(20, window[i].Val.size());
+        EXPECT_EQ((double) (2 * N + i), window[i].Val[19]);
+    }
+}
+
+// Slots are reused after Clear() and reallocated only if size of signal changes
+TEST(HistoryBufferAllocation, SignalAccessor)
+{
+    SKIP_IF_NOT_COUNTED
+
+    const size_t N = 8;
+    ParamEigen<Eigen::VectorXd> aVector(Eigen::VectorXd::Zero(10));
+    SignalAccessor<ParamEigen<Eigen::VectorXd> > accessor(aVector, "aVector", N);
+
+    {
+        AllocationCounter counter;
+        for (size_t i = 0; i < 2 * N; ++i)
+            accessor.Push();
+        accessor.Clear();
+        for (size_t i = 0; i < N; ++i)
+            accessor.Push();
+        EXPECT_EQ(0, counter.Get());
+    }
+
+    // Larger signal: each slot is reallocated once
+    aVector.Val = Eigen::VectorXd::Zero(30);
+    {
+        AllocationCounter counter;
+        for (size_t i = 0; i < N; ++i)
+            accessor.Push();
+        EXPECT_EQ(N, counter.Get());
+    }
+    {
+        AllocationCounter counter;
+        for (size_t i = 0; i < N; ++i)
+            accessor.Push();
+        EXPECT_EQ(0, counter.Get());
+    }
+    EXPECT_EQ(30, accessor.Container->Back().Val.size());
+}
@@ -0,0 +1,234 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include "gtest/gtest.h"
+#include "safecass/historyBufferColumnar.h"
+
+#include <cmath>
+#include <vector>
+#include <list>
+
+using namespace SC;
+
+#define INVALID_INDEX HistoryBufferBase::INVALID_SIGNAL_INDEX
+
+TEST(HistoryBufferColumnar, Initialization)
+{
+    const size_t N = 256;
+
+    HistoryBufferColumnar hb(N);
+    EXPECT_EQ(N, hb.GetBufferSize());
+    EXPECT_EQ(0, hb.GetNumberOfSignals());
+    EXPECT_EQ(INVALID_INDEX, hb.GetSnapshotIndex());
+
+    std::cout << "History Buffer: " << hb << std::endl;
+}
+
+TEST(HistoryBufferColumnar, AddSignal_FindSignal_GetSignal)
+{
+    HistoryBufferColumnar hb;
+
+    ParamEigen<double>               paramDouble;
+    ParamEigen<std::vector<double> > paramDoubleVec;
+    ParamEigen<std::list<int> >      paramIntList;
+    ParamEigen<Eigen::Array33d>      paramEigenArray33d;
+
+    EXPECT_EQ(0, hb.AddSignal(paramDouble,    "Double"));
+    EXPECT_EQ(1, hb.AddSignal(paramDoubleVec, "DoubleVec"));
+    EXPECT_EQ(2, hb.AddSignal(paramIntList,   "IntList"));
+    EXPECT_EQ(3, hb.AddSignal(paramEigenArray33d, "EigenArray33d"));
+
+    // Failures due to duplicate name
+    EXPECT_EQ(INVALID_INDEX, hb.AddSignal(paramDouble,    "Double"));
+    EXPECT_EQ(INVALID_INDEX, hb.AddSignal(paramEigenArray33d, "EigenArray33d"));
+
+    EXPECT_TRUE(hb.FindSignal("Double"));
+    EXPECT_TRUE(hb.FindSignal("EigenArray33d"));
+    EXPECT_FALSE(hb.FindSignal("Double-invalid"));
+
+    EXPECT_EQ(0, hb.GetSignalIndex("Double"));
+    EXPECT_EQ(3, hb.GetSignalIndex("EigenArray33d"));
+    EXPECT_EQ(INVALID_INDEX, hb.GetSignalIndex("Double-invalid"));
+    EXPECT_EQ(4, hb.GetNumberOfSignals());
+}
+
+TEST(HistoryBufferColumnar, GetNewValue)
+{
+    HistoryBufferColumnar hb(4);
+
+    ParamEigen<int>             aInt;
+    ParamEigen<Eigen::Matrix2d> aEigen;
+
+    EXPECT_FALSE(hb.GetNewValue("aInt", aInt));
+    EXPECT_EQ(0, hb.AddSignal(aInt, "aInt"));
+    EXPECT_EQ(1, hb.AddSignal(aEigen, "aEigen"));
+
+    // No snapshot taken yet
+    ParamEigen<int> aIntFetched;
+    EXPECT_FALSE(hb.GetNewValue("aInt", aIntFetched));
+    EXPECT_FALSE(hb.GetNewValue(1234, aIntFetched));
+
+    ParamEigen<Eigen::Matrix2d> aEigenFetched;
+    // Wrap around the table several times
+    for (int i = 1; i <= 10; ++i) {
+        aInt = i;
+        aInt.SetValid(i % 2 == 0);
+        aEigen.Val = Eigen::Matrix2d::Random();
+        hb.Snapshot();
+        EXPECT_EQ(i, hb.GetSnapshotIndex());
+
+        EXPECT_TRUE(hb.GetNewValue("aInt", aIntFetched));
+        EXPECT_EQ(i, aIntFetched.Val);
+        EXPECT_EQ(aInt.IsValid(), aIntFetched.IsValid());
+
+        EXPECT_TRUE(hb.GetNewValue(1, aEigenFetched));
+        EXPECT_TRUE(aEigenFetched.Val == aEigen.Val);
+
+        // Samples taken by the same snapshot share the same timestamp
+        EXPECT_EQ(aIntFetched.GetTimestamp(), aEigenFetched.GetTimestamp());
+    }
+
+    std::cout << "Snapshot (after 10 snapshots): " << hb << std::endl;
+}
+
+// Reductions are compared with naive loops over valid samples.  Windows start
+// at various rows and cross the wrap point and words of the validity mask.
+TEST(HistoryBufferColumnar, Reduce)
+{
+    const size_t sizes[] = { 37, 300 }; // not multiples of vector width
+    for (size_t s = 0; s < 2; ++s) {
+        const size_t N = sizes[s];
+        HistoryBufferColumnar hb(N);
+
+        ParamEigen<double> aDouble;
+        EXPECT_EQ(0, hb.AddSignal(aDouble, "aDouble"));
+
+        double result;
+        EXPECT_FALSE(hb.ReduceLastN(0, 10, REDUCTION_SUM, result));
+
+        std::vector<double> values;
+        std::vector<bool> valid;
+        std::vector<SC::TimestampType> timestamps;
+        ParamEigen<double> fetched;
+        for (size_t i = 0; i < 2 * N + N / 3; ++i) {
+            aDouble.Val = std::sin(0.1 * i) * 100.0 + i;
+            // Runs of valid, invalid, and mixed samples (covers words of the
+            // mask with all, none, and some samples valid)
+            const size_t run = (i / 150) % 3;
+            aDouble.SetValid(run == 0 || (run == 2 && i % 7 != 3 && i % 11 != 5));
+            hb.Snapshot();
+            values.push_back(aDouble.Val);
+            valid.push_back(aDouble.IsValid());
+            EXPECT_TRUE(hb.GetNewValue(0, fetched));
+            timestamps.push_back(fetched.GetTimestamp());
+
+            // Last count samples
+            const size_t count = std::min(i + 1, (size_t) (1 + (i * 13) % N));
+            double sum = 0.0, sumSquares = 0.0, min = 0.0, max = 0.0;
+            size_t n = 0;
+            for (size_t j = i + 1 - count; j <= i; ++j) {
+                if (!valid[j])
+                    continue;
+                if (n == 0 || values[j] < min) min = values[j];
+                if (n == 0 || values[j] > max) max = values[j];
+                sum += values[j];
+                sumSquares += values[j] * values[j];
+                ++n;
+            }
+            if (n == 0) {
+                EXPECT_FALSE(hb.ReduceLastN(0, count, REDUCTION_SUM, result));
+                continue;
+            }
+            const double mean = sum / n;
+            double variance = 0.0;
+            for (size_t j = i + 1 - count; j <= i; ++j)
+                if (valid[j])
+                    variance += (values[j] - mean) * (values[j] - mean);
+            variance /= n;
+
+            EXPECT_TRUE(hb.ReduceLastN(0, count, REDUCTION_SUM, result));
+            EXPECT_NEAR(sum, result, 1e-9);
+            EXPECT_TRUE(hb.ReduceLastN("aDouble", count, REDUCTION_MEAN, result));
+            EXPECT_NEAR(mean, result, 1e-9);
+            EXPECT_TRUE(hb.ReduceLastN(0, count, REDUCTION_MIN, result));
+            EXPECT_EQ(min, result);
+            EXPECT_TRUE(hb.ReduceLastN(0, count, REDUCTION_MAX, result));
+            EXPECT_EQ(max, result);
+            EXPECT_TRUE(hb.ReduceLastN(0, count, REDUCTION_VARIANCE, result));
+            EXPECT_NEAR(variance, result, 1e-6);
+            EXPECT_TRUE(hb.ReduceLastN(0, count, REDUCTION_L2NORM, result));
+            EXPECT_NEAR(std::sqrt(sumSquares), result, 1e-6);
+            EXPECT_TRUE(hb.ReduceLastN(0, count, REDUCTION_RMS, result));
+            EXPECT_NEAR(std::sqrt(sumSquares / n), result, 1e-6);
+        }
+
+        // Time range: samples kept in the table whose timestamps are in [t0, t1]
+        const size_t oldest = values.size() - N;
+        const SC::TimestampType t0 = timestamps[oldest + N / 4], t1 = timestamps[oldest + N / 2];
+        double sum = 0.0;
+        for (size_t j = oldest; j < values.size(); ++j)
+            if (valid[j] && timestamps[j] >= t0 && timestamps[j] <= t1)
+                sum += values[j];
+        EXPECT_TRUE(hb.ReduceRange(0, t0, t1, REDUCTION_SUM, result));
+        EXPECT_NEAR(sum, result, 1e-9);
+        EXPECT_TRUE(hb.ReduceRange("aDouble", t0, t1, REDUCTION_SUM, result));
+        EXPECT_NEAR(sum, result, 1e-9);
+        EXPECT_FALSE(hb.ReduceRange(0, t1, t0 - 1, REDUCTION_SUM, result));
+        EXPECT_FALSE(hb.ReduceRange(0, 0, timestamps[oldest] - 1, REDUCTION_SUM, result));
+
+        EXPECT_FALSE(hb.ReduceLastN(1, 10, REDUCTION_SUM, result));
+        EXPECT_FALSE(hb.ReduceLastN("invalid", 10, REDUCTION_SUM, result));
+    }
+}
+
+TEST(HistoryBufferColumnar, ReduceTypes)
+{
+    HistoryBufferColumnar hb(8);
+
+    ParamEigen<float> aFloat;
+    ParamEigen<int> aInt;
+    ParamEigen<Eigen::Vector3d> aVector(Eigen::Vector3d::Zero());
+    EXPECT_EQ(0, hb.AddSignal(aFloat, "aFloat"));
+    EXPECT_EQ(1, hb.AddSignal(aInt, "aInt"));
+    EXPECT_EQ(2, hb.AddSignal(aVector, "aVector"));
+
+    aFloat.SetValid(true);
+    aInt.SetValid(true);
+    aVector.SetValid(true);
+    for (int i = 1; i <= 10; ++i) {
+        aFloat.Val = 0.5f * i;
+        aInt.Val = -i;
+        hb.Snapshot();
+    }
+
+    // Samples 3 .. 10 are kept
+    double result;
+    EXPECT_TRUE(hb.ReduceLastN(0, 10, REDUCTION_SUM, result));
+    EXPECT_DOUBLE_EQ(26.0, result);
+    EXPECT_TRUE(hb.ReduceLastN(0, 3, REDUCTION_MAX, result));
+    EXPECT_DOUBLE_EQ(5.0, result);
+    EXPECT_TRUE(hb.ReduceLastN(1, 10, REDUCTION_MIN, result));
+    EXPECT_DOUBLE_EQ(-10.0, result);
+    EXPECT_TRUE(hb.ReduceLastN(1, 4, REDUCTION_VARIANCE, result));
+    EXPECT_DOUBLE_EQ(1.25, result);
+
+    // Non-numeric signals are not supported
+    EXPECT_FALSE(hb.ReduceLastN(2, 1, REDUCTION_SUM, result));
+
+    // No valid sample
+    aFloat.SetValid(false);
+    hb.Snapshot();
+    EXPECT_FALSE(hb.ReduceLastN(0, 1, REDUCTION_MAX, result));
+    EXPECT_TRUE(hb.ReduceLastN(0, 2, REDUCTION_MAX, result));
+    EXPECT_DOUBLE_EQ(5.0, result);
+}
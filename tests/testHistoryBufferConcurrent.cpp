@@ -0,0 +1,149 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include "gtest/gtest.h"
+#include "safecass/historyBufferConcurrent.h"
+
+#include <boost/thread.hpp>
+
+using namespace SC;
+
+#define INVALID_INDEX HistoryBufferBase::INVALID_SIGNAL_INDEX
+
+TEST(HistoryBufferConcurrent, AddSignal_GetNewValue)
+{
+    HistoryBufferConcurrent hb(4);
+
+    ParamEigen<int>             aInt;
+    ParamEigen<Eigen::Vector3d> aVec;
+
+    EXPECT_EQ(0, hb.AddSignal(aInt, "aInt"));
+    EXPECT_EQ(1, hb.AddSignal(aVec, "aVec"));
+    EXPECT_EQ(INVALID_INDEX, hb.AddSignal(aInt, "aInt"));
+    EXPECT_EQ(1, hb.GetSignalIndex("aVec"));
+
+    // No snapshot taken yet
+    ParamEigen<int> aIntFetched;
+    EXPECT_EQ(INVALID_INDEX, hb.GetSnapshotIndex());
+    EXPECT_FALSE(hb.GetNewValue("aInt", aIntFetched));
+
+    for (int i = 1; i <= 10; ++i) {
+        aInt = i;
+        aInt.SetValid(true);
+        hb.Snapshot();
+        EXPECT_EQ(i, hb.GetSnapshotIndex());
+        EXPECT_TRUE(hb.GetNewValue("aInt", aIntFetched));
+        EXPECT_EQ(i, aIntFetched.Val);
+        EXPECT_TRUE(aIntFetched.IsValid());
+    }
+
+    // Invalid index and type mismatch
+    ParamEigen<Eigen::Vector3d> aVecFetched;
+    EXPECT_FALSE(hb.GetNewValue(2, aVecFetched));
+    EXPECT_FALSE(hb.GetNewValue(0, aVecFetched));
+    EXPECT_TRUE(hb.GetNewValue(1, aVecFetched));
+}
+
+namespace {
+
+const int NUMBER_OF_SNAPSHOTS = 200000;
+
+struct Writer
+{
+    HistoryBufferConcurrent & HB;
+    ParamEigen<long long> & Pos;
+    ParamEigen<long long> & Neg;
+    ParamEigen<Eigen::Vector4d> & Vec;
+
+    Writer(HistoryBufferConcurrent & hb, ParamEigen<long long> & pos,
+           ParamEigen<long long> & neg, ParamEigen<Eigen::Vector4d> & vec)
+        : HB(hb), Pos(pos), Neg(neg), Vec(vec)
+    {}
+
+    void operator()(void) {
+        for (long long i = 1; i <= NUMBER_OF_SNAPSHOTS; ++i) {
+            Pos = i;
+            Neg = -i;
+            Vec.Val.setConstant((double) i);
+            HB.Snapshot();
+        }
+    }
+};
+
+struct Reader
+{
+    const HistoryBufferConcurrent & HB;
+    int Reads;
+    int Inconsistencies;
+
+    Reader(const HistoryBufferConcurrent & hb)
+        : HB(hb), Reads(0), Inconsistencies(0)
+    {}
+
+    void operator()(void) {
+        ParamEigen<long long> pos, neg;
+        ParamEigen<Eigen::Vector4d> vec;
+
+        std::vector<HistoryBufferBase::IndexType> indices;
+        indices.push_back(0);
+        indices.push_back(1);
+        indices.push_back(2);
+        std::vector<ParamBase *> args;
+        args.push_back(&pos);
+        args.push_back(&neg);
+        args.push_back(&vec);
+
+        long long last = 0;
+        while (last < NUMBER_OF_SNAPSHOTS) {
+            if (!HB.GetNewValues(indices, args))
+                continue;
+            ++Reads;
+            // All values must come from the same snapshot, and snapshots must
+            // be observed in order
+            if (pos.Val + neg.Val != 0 || (vec.Val.array() != (double) pos.Val).any() || pos.Val < last)
+                ++Inconsistencies;
+            last = pos.Val;
+        }
+    }
+};
+
+};
+
+// Stress test: one writer and multiple readers on a small buffer so that the
+// writer frequently overwrites rows being read
+TEST(HistoryBufferConcurrent, ConcurrentReaders)
+{
+    HistoryBufferConcurrent hb(2);
+
+    ParamEigen<long long>       pos(0), neg(0);
+    ParamEigen<Eigen::Vector4d> vec;
+    EXPECT_EQ(0, hb.AddSignal(pos, "pos"));
+    EXPECT_EQ(1, hb.AddSignal(neg, "neg"));
+    EXPECT_EQ(2, hb.AddSignal(vec, "vec"));
+
+    const int N = 4;
+    std::vector<Reader> readers(N, Reader(hb));
+
+    boost::thread_group threads;
+    for (int i = 0; i < N; ++i)
+        threads.create_thread(boost::ref(readers[i]));
+    Writer writer(hb, pos, neg, vec);
+    threads.create_thread(boost::ref(writer));
+    threads.join_all();
+
+    EXPECT_EQ(NUMBER_OF_SNAPSHOTS, hb.GetSnapshotIndex());
+    for (int i = 0; i < N; ++i) {
+        EXPECT_GT(readers[i].Reads, 0);
+        EXPECT_EQ(0, readers[i].Inconsistencies);
+    }
+}
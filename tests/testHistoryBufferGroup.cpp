@@ -0,0 +1,126 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include "gtest/gtest.h"
+#include "safecass/historyBufferGroup.h"
+
+using namespace SC;
+
+#define INVALID_BUFFER HistoryBufferGroup::INVALID_BUFFER_INDEX
+
+TEST(HistoryBufferGroup, Snapshot)
+{
+    HistoryBuffer hb1(8), hb2(4);
+    ParamEigen<double> a;
+    ParamEigen<int> b;
+    SignalHandle<double> handleA = hb1.AddSignal(a, "a");
+    SignalHandle<int> handleB = hb2.AddSignal(b, "b");
+
+    HistoryBufferGroup group;
+    EXPECT_EQ(HistoryBufferGroup::INVALID_TICK, group.GetLatestTick());
+    EXPECT_EQ(0, group.AddBuffer(&hb1));
+    EXPECT_EQ(1, group.AddBuffer(&hb2));
+    EXPECT_EQ(INVALID_BUFFER, group.AddBuffer(&hb1));
+    EXPECT_EQ(INVALID_BUFFER, group.AddBuffer(0));
+    EXPECT_EQ(2, group.GetNumberOfBuffers());
+    EXPECT_TRUE(group.GetBuffer(1) == &hb2);
+    EXPECT_TRUE(group.GetBuffer(2) == 0);
+
+    // Tick i: a = i, b = 10 * i
+    for (int i = 0; i < 10; ++i) {
+        a = i;
+        b = 10 * i;
+        group.Snapshot(1000 + i);
+    }
+    EXPECT_EQ(10, group.GetNumberOfTicks());
+    EXPECT_EQ(9, group.GetLatestTick());
+
+    // One timestamp for all history buffers
+    EXPECT_EQ(1009, hb1.GetSnapshotTimestamps().back());
+    EXPECT_EQ(1009, hb2.GetSnapshotTimestamps().back());
+    SC::TimestampType t;
+    EXPECT_TRUE(group.GetTimestamp(5, t));
+    EXPECT_EQ(1005, t);
+    EXPECT_FALSE(group.GetTimestamp(10, t));
+    EXPECT_FALSE(group.GetTimestamp(0, t)); // beyond depth of both buffers
+
+    // Aligned reads
+    for (HistoryBufferGroup::TickType tick = 6; tick <= 9; ++tick) {
+        const ParamEigen<double> * sampleA = group.GetSample(0, handleA, tick);
+        const ParamEigen<int> * sampleB = group.GetSample(1, handleB, tick);
+        ASSERT_TRUE(sampleA != 0);
+        ASSERT_TRUE(sampleB != 0);
+        EXPECT_EQ(tick, sampleA->Val);
+        EXPECT_EQ(10 * tick, sampleB->Val);
+        EXPECT_EQ(hb1.GetSnapshotTimestamps()[8 - (9 - tick) - 1], 1000 + tick);
+    }
+    // hb2 keeps 4 samples only
+    EXPECT_TRUE(group.GetSample(0, handleA, 2) != 0);
+    EXPECT_TRUE(group.GetSample(1, handleB, 5) == 0);
+    EXPECT_TRUE(group.GetSample(0, handleA, 10) == 0);
+    EXPECT_TRUE(group.GetSample(0, handleA, -1) == 0);
+    EXPECT_TRUE(group.GetSample(2, handleA, 9) == 0);
+
+    ParamEigen<int> arg;
+    EXPECT_TRUE(group.GetSample(1, 0, 7, arg));
+    EXPECT_EQ(70, arg.Val);
+    ParamEigen<double> wrongType;
+    EXPECT_FALSE(group.GetSample(1, 0, 7, wrongType));
+
+    SignalWindow<ParamEigen<double> > window;
+    EXPECT_TRUE(group.GetWindow(0, handleA, 4, 3, window));
+    ASSERT_EQ(3, window.GetSize());
+    EXPECT_EQ(4.0, window[0].Val);
+    EXPECT_EQ(6.0, window[2].Val);
+    EXPECT_FALSE(group.GetWindow(0, handleA, 8, 3, window));
+    EXPECT_FALSE(group.GetWindow(0, handleA, 1, 3, window));
+    EXPECT_EQ(0, window.GetSize());
+}
+
+TEST(HistoryBufferGroup, Alignment)
+{
+    HistoryBuffer hb1(8), hb2(8);
+    ParamEigen<int> a, b;
+    SignalHandle<int> handleA = hb1.AddSignal(a, "a");
+    SignalHandle<int> handleB = hb2.AddSignal(b, "b");
+
+    // Samples taken before joining are not aligned
+    hb2.Snapshot();
+
+    HistoryBufferGroup group;
+    group.AddBuffer(&hb1);
+    group.Snapshot();
+    group.AddBuffer(&hb2);
+    a = 1;
+    b = 1;
+    group.Snapshot();
+
+    EXPECT_TRUE(group.IsAligned(0, 0));
+    EXPECT_FALSE(group.IsAligned(1, 0));
+    EXPECT_TRUE(group.IsAligned(1, 1));
+    EXPECT_TRUE(group.GetSample(1, handleB, 0) == 0);
+    EXPECT_EQ(1, group.GetSample(1, handleB, 1)->Val);
+
+    // Snapshot outside group breaks alignment until the next tick
+    hb1.Snapshot();
+    EXPECT_FALSE(group.IsAligned(0, 1));
+    EXPECT_TRUE(group.GetSample(0, handleA, 1) == 0);
+    a = 2;
+    b = 2;
+    group.Snapshot();
+    EXPECT_FALSE(group.IsAligned(0, 1));
+    EXPECT_TRUE(group.IsAligned(0, 2));
+    EXPECT_EQ(2, group.GetSample(0, handleA, 2)->Val);
+    EXPECT_TRUE(group.IsAligned(1, 1));
+    EXPECT_EQ(1, group.GetSample(1, handleB, 1)->Val);
+}
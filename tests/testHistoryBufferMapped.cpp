@@ -0,0 +1,184 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include "gtest/gtest.h"
+#include "safecass/historyBufferMapped.h"
+
+#include <cstdio>
+#include <cstddef>
+#include <sstream>
+
+using namespace SC;
+
+#define INVALID_INDEX HistoryBufferBase::INVALID_SIGNAL_INDEX
+
+namespace {
+const char * FILE_NAME = "testHistoryBufferMapped.hb";
+};
+
+TEST(HistoryBufferMapped, CreateAddSignal)
+{
+    HistoryBufferMapped hb;
+    EXPECT_FALSE(hb.IsOpen());
+
+    ParamEigen<int> aInt;
+    // No file created yet
+    EXPECT_EQ(INVALID_INDEX, hb.AddSignal(aInt, "aInt"));
+
+    ASSERT_TRUE(hb.Create(FILE_NAME, 8, 2));
+    EXPECT_TRUE(hb.IsOpen());
+    EXPECT_EQ(8, hb.GetBufferSize());
+
+    ParamEigen<Eigen::Matrix<float, 2, 3, Eigen::RowMajor> > aMat;
+    ParamEigen<double> aDouble;
+    EXPECT_EQ(0, hb.AddSignal(aInt, "aInt"));
+    EXPECT_EQ(INVALID_INDEX, hb.AddSignal(aInt, "aInt"));
+    EXPECT_EQ(1, hb.AddSignal(aMat, "aMat"));
+    // Max number of signals reached
+    EXPECT_EQ(INVALID_INDEX, hb.AddSignal(aDouble, "aDouble"));
+    EXPECT_EQ(2, hb.GetNumberOfSignals());
+    EXPECT_EQ(1, hb.GetSignalIndex("aMat"));
+
+    std::remove(FILE_NAME);
+}
+
+TEST(HistoryBufferMapped, SnapshotAndOpen)
+{
+    HistoryBufferMapped * writer = new HistoryBufferMapped;
+    ASSERT_TRUE(writer->Create(FILE_NAME, 4));
+
+    ParamEigen<int>                               aInt;
+    ParamEigen<Eigen::Matrix<float, 2, 3, Eigen::RowMajor> > aMat;
+    ParamEigen<Eigen::Vector3d>                   aVec;
+    EXPECT_EQ(0, writer->AddSignal(aInt, "aInt"));
+    EXPECT_EQ(1, writer->AddSignal(aMat, "aMat"));
+
+    ParamEigen<int> fetched;
+    EXPECT_FALSE(writer->GetNewValue(0, fetched));
+
+    for (int i = 1; i <= 6; ++i) {
+        aInt = i;
+        aInt.SetValid(i % 2 == 0);
+        aMat.Val.setConstant(i * 0.5f);
+        aMat.Val(0, 2) = -i;
+        aVec.Val.setConstant(i);
+        writer->Snapshot();
+        // Signal added at run-time
+        if (i == 4) {
+            EXPECT_EQ(2, writer->AddSignal(aVec, "aVec"));
+        }
+
+        EXPECT_EQ(i, writer->GetSnapshotIndex());
+        EXPECT_TRUE(writer->GetNewValue("aInt", fetched));
+        EXPECT_EQ(i, fetched.Val);
+        EXPECT_EQ(i % 2 == 0, fetched.IsValid());
+    }
+
+    ParamEigen<Eigen::Matrix<float, 2, 3, Eigen::RowMajor> > fetchedMat;
+    EXPECT_TRUE(writer->GetNewValue(1, fetchedMat));
+    EXPECT_TRUE(fetchedMat.Val == aMat.Val);
+    // Type mismatch
+    EXPECT_FALSE(writer->GetNewValue(1, fetched));
+
+    std::stringstream ssWriter;
+    writer->Serialize(ssWriter);
+    std::cout << ssWriter.str();
+
+    // Open the file while the writer still maps it, as if the writer crashed
+    HistoryBufferMapped reader;
+    ASSERT_TRUE(reader.Open(FILE_NAME));
+    EXPECT_TRUE(reader.IsReadOnly());
+    EXPECT_EQ(6, reader.GetSnapshotIndex());
+    EXPECT_EQ(3, reader.GetNumberOfSignals());
+    EXPECT_EQ(2, reader.GetSignalIndex("aVec"));
+
+    std::stringstream ssReader;
+    reader.Serialize(ssReader);
+    EXPECT_EQ(ssWriter.str(), ssReader.str());
+
+    // Values of the latest sample of row-major matrix
+    EXPECT_NE(std::string::npos, ssReader.str().find("[ 3,  3, -6]"));
+    // Scalar samples from oldest to latest (4 rows)
+    EXPECT_NE(std::string::npos, ssReader.str().find("[x] 3, "));
+    EXPECT_NE(std::string::npos, ssReader.str().find("[o] 6\n"));
+
+    delete writer;
+
+    // File remains after writer is gone
+    ASSERT_TRUE(reader.Open(FILE_NAME));
+    std::stringstream ssReader2;
+    reader.Serialize(ssReader2);
+    EXPECT_EQ(ssWriter.str(), ssReader2.str());
+
+    std::remove(FILE_NAME);
+    EXPECT_FALSE(reader.Open("non-existent-file.hb"));
+}
+
+namespace {
+// Overwrites bytes of file at offset
+template<typename T>
+void Patch(const char * fileName, size_t offset, const T & value)
+{
+    std::FILE * f = std::fopen(fileName, "r+b");
+    ASSERT_TRUE(f != 0);
+    std::fseek(f, offset, SEEK_SET);
+    std::fwrite(&value, sizeof(T), 1, f);
+    std::fclose(f);
+}
+};
+
+TEST(HistoryBufferMapped, OpenInvalidFile)
+{
+    HistoryBufferMapped * writer = new HistoryBufferMapped;
+    ASSERT_TRUE(writer->Create(FILE_NAME, 4, 2));
+    ParamEigen<double> aDouble;
+    EXPECT_EQ(0, writer->AddSignal(aDouble, "aDouble"));
+    writer->Snapshot();
+    MappedFileHeader header;
+    MappedSignalHeader signal;
+    {
+        std::FILE * f = std::fopen(FILE_NAME, "rb");
+        ASSERT_TRUE(f != 0);
+        ASSERT_EQ(1u, std::fread(&header, sizeof(header), 1, f));
+        ASSERT_EQ(1u, std::fread(&signal, sizeof(signal), 1, f));
+        std::fclose(f);
+    }
+    delete writer;
+
+    // One spare row for the snapshot being written
+    EXPECT_EQ(5u, header.BufferSize);
+
+    HistoryBufferMapped reader;
+    ASSERT_TRUE(reader.Open(FILE_NAME));
+    EXPECT_EQ(4, reader.GetBufferSize());
+
+    // Timestamp column overlaps signal headers
+    Patch(FILE_NAME, offsetof(MappedFileHeader, TimestampOffset), (boost::uint64_t) sizeof(MappedFileHeader));
+    EXPECT_FALSE(reader.Open(FILE_NAME));
+    Patch(FILE_NAME, offsetof(MappedFileHeader, TimestampOffset), header.TimestampOffset);
+    EXPECT_TRUE(reader.Open(FILE_NAME));
+
+    // Offset of value column wraps around
+    const size_t signalOffset = sizeof(MappedFileHeader);
+    Patch(FILE_NAME, signalOffset + offsetof(MappedSignalHeader, ValueOffset), (boost::uint64_t) -8);
+    EXPECT_FALSE(reader.Open(FILE_NAME));
+    Patch(FILE_NAME, signalOffset + offsetof(MappedSignalHeader, ValueOffset), signal.ValueOffset);
+    EXPECT_TRUE(reader.Open(FILE_NAME));
+
+    // Size of value column overflows
+    Patch(FILE_NAME, signalOffset + offsetof(MappedSignalHeader, Rows), (boost::uint32_t) 0xFFFFFFFF);
+    Patch(FILE_NAME, signalOffset + offsetof(MappedSignalHeader, Cols), (boost::uint32_t) 0xFFFFFFFF);
+    EXPECT_FALSE(reader.Open(FILE_NAME));
+
+    std::remove(FILE_NAME);
+}
@@ -17,6 +17,7 @@
 #include "gtest/gtest.h"
 #include "safecass/historyBuffer.h"
 #include "safecass/paramEigen.h"
+#include "safecass/paramPacked.h"
 
 using namespace SC;
 
@@ -88,6 +89,15 @@ TEST(ParameterTypes, ParamEigen)
     v3f.setZero();
     EXPECT_EQ(0, v3f.Val.sum());
 
+    // Default values: zero for fixed-size types, empty for dynamic-size types
+    ParamEigen<Eigen::Matrix3d> m3d;
+    EXPECT_EQ(0, m3d.Val.sum());
+    ParamEigen<Eigen::VectorXd> vxd;
+    EXPECT_EQ(0, vxd.Val.size());
+    ParamEigen<Eigen::MatrixXf> mxf;
+    EXPECT_EQ(0, mxf.Val.rows());
+    EXPECT_EQ(0, mxf.Val.cols());
+
     // TODO: Could incorporate examples from the official tutorial documentation:
     // https://eigen.tuxfamily.org/dox/group__TutorialArrayClass.html
     // Eigen uses typedefs of the form ArrayNNt.
@@ -167,3 +177,68 @@ TEST(ParameterTypes, ParamEigen)
 
     // TODO: add eigen-type tests
 }
+
+TEST(ParameterTypes, ParamTimestamp)
+{
+    // Explicit timestamp and validity are kept as they are
+    ParamEigen<double> d(1.5, 1234, true);
+    EXPECT_EQ(1.5, d.Val);
+    EXPECT_EQ(1234, d.GetTimestamp());
+    EXPECT_TRUE(d.IsValid());
+
+    ParamEigen<Eigen::Vector2d> v(Eigen::Vector2d::Ones(), 5678, false);
+    EXPECT_EQ(1.0, v.Val[1]);
+    EXPECT_EQ(5678, v.GetTimestamp());
+    EXPECT_FALSE(v.IsValid());
+}
+
+TEST(ParameterTypes, PackedParam)
+{
+    EXPECT_EQ(sizeof(double) + 8, sizeof(PackedParam<double>));
+    EXPECT_EQ(sizeof(Eigen::Vector3d) + 8, sizeof(PackedParam<Eigen::Vector3d>));
+
+    PackedParam<int> p;
+    p.Set(7, 123456789, true);
+    EXPECT_EQ(7, p.Val);
+    EXPECT_EQ(123456789, p.GetTimestamp());
+    EXPECT_TRUE(p.IsValid());
+
+    p.SetValid(false);
+    EXPECT_FALSE(p.IsValid());
+    EXPECT_EQ(123456789, p.GetTimestamp());
+    p.SetTimestamp(42);
+    p.SetValid();
+    EXPECT_TRUE(p.IsValid());
+    EXPECT_EQ(42, p.GetTimestamp());
+
+    // Largest timestamp does not overlap validity
+    const SC::TimestampType maxTimestamp = 0x7FFFFFFFFFFFFFFFLL;
+    p.Set(0, maxTimestamp, false);
+    EXPECT_FALSE(p.IsValid());
+    EXPECT_EQ(maxTimestamp, p.GetTimestamp());
+
+    // Trivially copyable
+    PackedParam<int> q;
+    memcpy(&q, &p, sizeof(p));
+    EXPECT_EQ(maxTimestamp, q.GetTimestamp());
+
+    // Conversion from and to ParamEigen
+    ParamEigen<Eigen::Vector3d> param(Eigen::Vector3d(1.0, 2.0, 3.0), 1000, true);
+    PackedParam<Eigen::Vector3d> packed = Pack(param);
+    EXPECT_EQ(2.0, packed.Val[1]);
+    EXPECT_EQ(1000, packed.GetTimestamp());
+    EXPECT_TRUE(packed.IsValid());
+
+    packed.Val[1] = 5.0;
+    packed.SetTimestamp(2000);
+    ParamEigen<Eigen::Vector3d> unpacked = Unpack(packed);
+    EXPECT_EQ(5.0, unpacked.Val[1]);
+    EXPECT_EQ(2000, unpacked.GetTimestamp());
+    EXPECT_TRUE(unpacked.IsValid());
+
+    packed.SetValid(false);
+    Unpack(packed, param);
+    EXPECT_EQ(5.0, param.Val[1]);
+    EXPECT_EQ(2000, param.GetTimestamp());
+    EXPECT_FALSE(param.IsValid());
+}
@@ -14,6 +14,7 @@
 
 #include <typeinfo>
 #include <numeric> // std::accumulate
+#include <cmath>
 #include <stdlib.h>
 #include <list>
 
@@ -158,3 +159,218 @@ TEST(SignalAccessor, SignalAccessorTest)
     for (size_t i = 0; i < vec.size(); ++i)
         std::cout << *(vec[i]) << std::endl;
 }
+
+TEST(SignalAccessor, GetWindow)
+{
+    ParamEigen<int> paramInt;
+    SignalAccessor<ParamEigen<int> > accessor(paramInt, "int", 5);
+
+    SignalWindow<ParamEigen<int> > window;
+    EXPECT_TRUE(accessor.GetWindow(0, 0, window));
+    EXPECT_TRUE(window.IsEmpty());
+    EXPECT_FALSE(accessor.GetWindow(0, 1, window));
+
+    // Contiguous before wrap-around
+    for (int i = 0; i < 3; ++i)
+        accessor.Push(i);
+    EXPECT_TRUE(accessor.GetWindow(1, 2, window));
+    EXPECT_TRUE(window.IsContiguous());
+    EXPECT_EQ(1, window.FirstSpan[0].Val);
+    EXPECT_EQ(2, window.FirstSpan[1].Val);
+
+    // Two spans after wrap-around: ring contains 3, 4, 5, 6, 7
+    for (int i = 3; i < 8; ++i)
+        accessor.Push(i);
+    accessor.GetLastN(100, window);
+    EXPECT_EQ(5, window.GetSize());
+    EXPECT_FALSE(window.IsContiguous());
+    for (size_t i = 0; i < window.GetSize(); ++i)
+        EXPECT_EQ(3 + (int) i, window[i].Val);
+
+    // Window entirely after wrap point
+    EXPECT_TRUE(accessor.GetWindow(3, 2, window));
+    EXPECT_TRUE(window.IsContiguous());
+    EXPECT_EQ(6, window.FirstSpan[0].Val);
+    EXPECT_EQ(7, window.FirstSpan[1].Val);
+    EXPECT_FALSE(accessor.GetWindow(3, 3, window));
+}
+
+// Reductions are compared with naive loops over windows of ParamEigen objects
+TEST(SignalAccessor, Reduce)
+{
+    const size_t N = 37; // not a multiple of vector width
+    ParamEigen<double> paramDouble;
+    SignalAccessor<ParamEigen<double> > accessor(paramDouble, "double", N);
+
+    double result;
+    EXPECT_FALSE(accessor.ReduceLastN(10, REDUCTION_SUM, result));
+
+    // Wrap around: ring contains samples 50 .. 86
+    for (int i = 0; i < 87; ++i)
+        accessor.Push(ParamEigen<double>(std::sin(0.1 * i) * 100.0 + i, 0, true));
+
+    for (size_t count = 1; count <= N; count += 6) {
+        const size_t begin = N - count;
+        SignalWindow<ParamEigen<double> > window;
+        EXPECT_TRUE(accessor.GetWindow(begin, count, window));
+
+        double sum = 0.0, sumSquares = 0.0;
+        double min = window[0].Val, max = window[0].Val;
+        for (size_t i = 0; i < window.GetSize(); ++i) {
+            const double v = window[i].Val;
+            sum += v;
+            sumSquares += v * v;
+            min = std::min(min, v);
+            max = std::max(max, v);
+        }
+        const double mean = sum / count;
+        double variance = 0.0;
+        for (size_t i = 0; i < window.GetSize(); ++i)
+            variance += (window[i].Val - mean) * (window[i].Val - mean);
+        variance /= count;
+
+        EXPECT_TRUE(accessor.Reduce(begin, count, REDUCTION_SUM, result));
+        EXPECT_NEAR(sum, result, 1e-9);
+        EXPECT_TRUE(accessor.Reduce(begin, count, REDUCTION_MEAN, result));
+        EXPECT_NEAR(mean, result, 1e-9);
+        EXPECT_TRUE(accessor.Reduce(begin, count, REDUCTION_MIN, result));
+        EXPECT_EQ(min, result);
+        EXPECT_TRUE(accessor.Reduce(begin, count, REDUCTION_MAX, result));
+        EXPECT_EQ(max, result);
+        EXPECT_TRUE(accessor.Reduce(begin, count, REDUCTION_VARIANCE, result));
+        EXPECT_NEAR(variance, result, 1e-9);
+        EXPECT_TRUE(accessor.Reduce(begin, count, REDUCTION_L2NORM, result));
+        EXPECT_NEAR(std::sqrt(sumSquares), result, 1e-9);
+        EXPECT_TRUE(accessor.Reduce(begin, count, REDUCTION_RMS, result));
+        EXPECT_NEAR(std::sqrt(sumSquares / count), result, 1e-9);
+    }
+
+    EXPECT_FALSE(accessor.Reduce(0, 0, REDUCTION_SUM, result));
+    EXPECT_FALSE(accessor.Reduce(30, 10, REDUCTION_SUM, result));
+
+    // Reductions follow replaced samples, shrinking and clearing
+    EXPECT_TRUE(accessor.SetSample(N - 1, ParamEigen<double>(-1000.0, 0, true)));
+    EXPECT_TRUE(accessor.ReduceLastN(1, REDUCTION_MIN, result));
+    EXPECT_EQ(-1000.0, result);
+    EXPECT_TRUE(accessor.SetCapacity(2));
+    EXPECT_TRUE(accessor.ReduceLastN(10, REDUCTION_SUM, result));
+    EXPECT_NEAR((*accessor.Container)[0].Val - 1000.0, result, 1e-9);
+    accessor.Clear();
+    EXPECT_FALSE(accessor.ReduceLastN(10, REDUCTION_SUM, result));
+}
+
+TEST(SignalAccessor, ReduceTypes)
+{
+    ParamEigen<float> paramFloat;
+    SignalAccessor<ParamEigen<float> > accessorFloat(paramFloat, "float", 10);
+    ParamEigen<int> paramInt;
+    SignalAccessor<ParamEigen<int> > accessorInt(paramInt, "int", 10);
+    for (int i = 1; i <= 10; ++i) {
+        accessorFloat.Push(ParamEigen<float>(0.5f * i, 0, true));
+        accessorInt.Push(ParamEigen<int>(-i, 0, true));
+    }
+
+    double result;
+    EXPECT_TRUE(accessorFloat.ReduceLastN(10, REDUCTION_SUM, result));
+    EXPECT_DOUBLE_EQ(27.5, result);
+    EXPECT_TRUE(accessorFloat.ReduceLastN(3, REDUCTION_MAX, result));
+    EXPECT_DOUBLE_EQ(5.0, result);
+    EXPECT_TRUE(accessorInt.ReduceLastN(10, REDUCTION_MIN, result));
+    EXPECT_DOUBLE_EQ(-10.0, result);
+    EXPECT_TRUE(accessorInt.ReduceLastN(4, REDUCTION_VARIANCE, result));
+    EXPECT_DOUBLE_EQ(1.25, result);
+
+    // Non-numeric signals are not supported
+    ParamEigen<Eigen::Vector3d> paramVector(Eigen::Vector3d::Zero());
+    SignalAccessor<ParamEigen<Eigen::Vector3d> > accessorVector(paramVector, "vector", 10);
+    paramVector.SetValid(true);
+    accessorVector.Push(paramVector);
+    EXPECT_FALSE(accessorVector.ReduceLastN(1, REDUCTION_SUM, result));
+
+    std::cout << "Reduction backend: " << Reduction::GetBackendName() << std::endl;
+}
+
+// Invalid samples are skipped
+TEST(SignalAccessor, ReduceValidSamples)
+{
+    const size_t N = 600;
+    ParamEigen<double> paramDouble;
+    SignalAccessor<ParamEigen<double> > accessor(paramDouble, "double", N);
+
+    double sum = 0.0, min = 0.0, max = 0.0;
+    size_t n = 0;
+    for (size_t i = 0; i < N; ++i) {
+        const bool valid = (i % 3 != 0);
+        const double v = (valid ? std::cos(0.05 * i) * 10.0 : 1e6);
+        accessor.Push(ParamEigen<double>(v, 0, valid));
+        if (!valid)
+            continue;
+        if (n == 0)
+            min = max = v;
+        sum += v;
+        min = std::min(min, v);
+        max = std::max(max, v);
+        ++n;
+    }
+    const double mean = sum / n;
+    double variance = 0.0;
+    for (size_t i = 0; i < N; ++i)
+        if ((*accessor.Container)[i].IsValid())
+            variance += ((*accessor.Container)[i].Val - mean) * ((*accessor.Container)[i].Val - mean);
+    variance /= n;
+
+    double result;
+    EXPECT_TRUE(accessor.ReduceLastN(N, REDUCTION_SUM, result));
+    EXPECT_NEAR(sum, result, 1e-9);
+    EXPECT_TRUE(accessor.ReduceLastN(N, REDUCTION_MEAN, result));
+    EXPECT_NEAR(mean, result, 1e-9);
+    EXPECT_TRUE(accessor.ReduceLastN(N, REDUCTION_MIN, result));
+    EXPECT_EQ(min, result);
+    EXPECT_TRUE(accessor.ReduceLastN(N, REDUCTION_MAX, result));
+    EXPECT_EQ(max, result);
+    EXPECT_TRUE(accessor.ReduceLastN(N, REDUCTION_VARIANCE, result));
+    EXPECT_NEAR(variance, result, 1e-9);
+
+    // No valid sample in range
+    EXPECT_FALSE(accessor.Reduce(0, 1, REDUCTION_SUM, result));
+    EXPECT_TRUE(accessor.Reduce(0, 2, REDUCTION_SUM, result));
+    EXPECT_EQ((*accessor.Container)[1].Val, result);
+}
+
+TEST(SignalAccessor, PackedParam)
+{
+    const size_t N = 4;
+    ParamEigen<double> signal;
+    SignalAccessor<ParamEigen<double> > accessor(signal, "signal", N);
+
+    // Packed samples are written in place to slots of container
+    PackedParam<double> packed;
+    for (int i = 0; i < 6; ++i) {
+        packed.Set(i, 1000 + i, (i % 2 == 0));
+        accessor.PushPacked(packed);
+    }
+    EXPECT_EQ(N, accessor.GetContainerSize());
+
+    for (size_t i = 0; i < N; ++i) {
+        EXPECT_TRUE(accessor.GetPacked(i, packed));
+        EXPECT_EQ((double) (i + 2), packed.Val);
+        EXPECT_EQ((SC::TimestampType) (1002 + i), packed.GetTimestamp());
+        EXPECT_EQ(i % 2 == 0, packed.IsValid());
+    }
+    EXPECT_FALSE(accessor.GetPacked(N, packed));
+
+    // Reductions follow (valid samples only)
+    double sum;
+    EXPECT_TRUE(accessor.ReduceLastN(N, REDUCTION_SUM, sum));
+    EXPECT_DOUBLE_EQ(2.0 + 4.0, sum);
+
+    packed.Set(10.0, 2000, true);
+    EXPECT_TRUE(accessor.SetPacked(0, packed));
+    EXPECT_FALSE(accessor.SetPacked(N, packed));
+    SignalWindow<ParamEigen<double> > window;
+    accessor.GetLastN(N, window);
+    EXPECT_EQ(10.0, window[0].Val);
+    EXPECT_EQ(2000, window[0].GetTimestamp());
+    EXPECT_TRUE(accessor.ReduceLastN(N, REDUCTION_SUM, sum));
+    EXPECT_DOUBLE_EQ(10.0 + 4.0, sum);
+}
@@ -0,0 +1,239 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include "gtest/gtest.h"
+#include "safecass/slidingWindow.h"
+#include "safecass/filterAverage.h"
+#include "safecass/filterMinMax.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <deque>
+#include <sstream>
+
+using namespace SC;
+
+// Statistics recomputed over all samples
+static void ExpectStatistics(const std::deque<double> & samples, const SlidingWindowStatistics & window)
+{
+    ASSERT_EQ(samples.size(), window.GetSize());
+    if (samples.empty())
+        return;
+
+    double sum = 0.0;
+    for (size_t i = 0; i < samples.size(); ++i)
+        sum += samples[i];
+    const double mean = sum / samples.size();
+    double sumSquares = 0.0;
+    for (size_t i = 0; i < samples.size(); ++i)
+        sumSquares += (samples[i] - mean) * (samples[i] - mean);
+
+    EXPECT_NEAR(mean, window.GetMean(), 1e-9);
+    EXPECT_NEAR(sumSquares / samples.size(), window.GetVariance(), 1e-9);
+    EXPECT_EQ(*std::min_element(samples.begin(), samples.end()), window.GetMin());
+    EXPECT_EQ(*std::max_element(samples.begin(), samples.end()), window.GetMax());
+}
+
+TEST(SlidingWindowStatistics, Count)
+{
+    SlidingWindowStatistics window(10);
+    EXPECT_EQ(SlidingWindowStatistics::WINDOW_COUNT, window.GetType());
+    EXPECT_EQ(10, window.GetMaxSize());
+    EXPECT_TRUE(window.IsEmpty());
+    EXPECT_EQ(0.0, window.GetMean());
+    EXPECT_EQ(0.0, window.GetVariance());
+    EXPECT_EQ(0.0, window.GetMin());
+
+    std::srand(1);
+    std::deque<double> samples;
+    for (int i = 0; i < 1000; ++i) {
+        // Runs of increasing and decreasing values as well as random values
+        double value;
+        if (i < 100)      value = i;
+        else if (i < 200) value = -i;
+        else if (i < 300) value = 5.0;
+        else              value = (std::rand() % 2000) / 10.0 - 100.0;
+
+        window.Push(value);
+        samples.push_back(value);
+        if (samples.size() > 10)
+            samples.pop_front();
+        ExpectStatistics(samples, window);
+    }
+
+    window.Reset();
+    EXPECT_TRUE(window.IsEmpty());
+    window.Push(3.0);
+    EXPECT_EQ(3.0, window.GetMean());
+    EXPECT_EQ(0.0, window.GetVariance());
+}
+
+TEST(SlidingWindowStatistics, Time)
+{
+    // 1 ms window of at most 8 samples
+    SlidingWindowStatistics window((TimestampType) 1000000, 8);
+    EXPECT_EQ(SlidingWindowStatistics::WINDOW_TIME, window.GetType());
+    EXPECT_EQ(1000000, window.GetDuration());
+
+    std::srand(2);
+    std::deque<std::pair<TimestampType, double> > samples;
+    TimestampType t = 0;
+    for (int i = 0; i < 1000; ++i) {
+        // Irregular sampling: 0 to 400 us apart
+        t += (std::rand() % 5) * 100000;
+        const double value = (std::rand() % 100) / 10.0;
+        window.Push(value, t);
+
+        samples.push_back(std::make_pair(t, value));
+        while (samples.front().first <= t - 1000000 || samples.size() > 8)
+            samples.pop_front();
+
+        std::deque<double> values;
+        for (size_t j = 0; j < samples.size(); ++j)
+            values.push_back(samples[j].second);
+        ExpectStatistics(values, window);
+    }
+}
+
+TEST(SlidingWindowStatistics, Precision)
+{
+    // Large offset and long run: removal must not accumulate error
+    SlidingWindowStatistics window(100);
+    std::deque<double> samples;
+    for (int i = 0; i < 1000000; ++i) {
+        const double value = 1e6 + (i % 7) * 0.1;
+        window.Push(value);
+        samples.push_back(value);
+        if (samples.size() > 100)
+            samples.pop_front();
+    }
+    double sum = 0.0;
+    for (size_t i = 0; i < samples.size(); ++i)
+        sum += samples[i];
+    const double mean = sum / samples.size();
+    double sumSquares = 0.0;
+    for (size_t i = 0; i < samples.size(); ++i)
+        sumSquares += (samples[i] - mean) * (samples[i] - mean);
+
+    EXPECT_NEAR(mean, window.GetMean(), 1e-6);
+    EXPECT_NEAR(sumSquares / samples.size(), window.GetVariance(), 1e-6);
+    EXPECT_GE(window.GetVariance(), 0.0);
+}
+
+TEST(SlidingWindowStatistics, LongRun)
+{
+    // Segments of large and small values: removal of large values leaves
+    // rounding error that would swamp the variance of small values
+    SlidingWindowStatistics window(50);
+    std::srand(3);
+    std::deque<double> samples;
+    for (int i = 0; i < 2000000; ++i) {
+        const double noise = (std::rand() % 2001 - 1000) / 1000.0;
+        const double value = ((i / 1000) % 2 ? 1e-3 * noise : 1e8 + noise);
+        window.Push(value);
+        samples.push_back(value);
+        if (samples.size() > 50)
+            samples.pop_front();
+
+        // Check at the end of each segment
+        if (i % 1000 != 999)
+            continue;
+        double sum = 0.0;
+        for (size_t j = 0; j < samples.size(); ++j)
+            sum += samples[j];
+        const double mean = sum / samples.size();
+        double sumSquares = 0.0;
+        for (size_t j = 0; j < samples.size(); ++j)
+            sumSquares += (samples[j] - mean) * (samples[j] - mean);
+        const double variance = sumSquares / samples.size();
+
+        ASSERT_NEAR(mean, window.GetMean(), 1e-9 * std::max(1.0, std::abs(mean))) << "sample " << i;
+        ASSERT_NEAR(variance, window.GetVariance(), 1e-6 * variance) << "sample " << i;
+    }
+}
+
+TEST(FilterSlidingWindow, Run)
+{
+    FilterAverage average(FilterBase::FILTERING_INTERNAL,
+                          FilterBase::StateMachineInfo(State::STATEMACHINE_APP, "aComponent"), "x", 4);
+    FilterMinMax minmax(FilterBase::FILTERING_INTERNAL,
+                        FilterBase::StateMachineInfo(State::STATEMACHINE_APP, "aComponent"), "x", 4);
+    EXPECT_EQ("x", average.GetNameOfInputSignal());
+    EXPECT_EQ(2, average.GetNumberOfOutputSignal());
+    EXPECT_EQ(2, minmax.GetNumberOfOutputSignal());
+
+    // Inputs read upstream output in place (see FilterPipeline)
+    ParamEigen<double> x(1.0);
+    average.GetInputSignalElement(0)->SetSource(&x);
+    minmax.GetInputSignalElement(0)->SetSource(&x);
+
+    // Filters run through base class (as by FilterPipeline)
+    FilterBase & averageBase = average;
+    FilterBase & minmaxBase = minmax;
+
+    // Disabled filter does not run
+    averageBase.RunFilter();
+    EXPECT_TRUE(average.GetWindow().IsEmpty());
+
+    average.Enable();
+    minmax.Enable();
+    const double values[] = { 1.0, 5.0, 3.0, -1.0, 2.0, 2.0 };
+    for (size_t i = 0; i < 6; ++i) {
+        x.Val = values[i];
+        averageBase.RunFilter();
+        minmaxBase.RunFilter();
+    }
+    // Window: 3, -1, 2, 2
+    EXPECT_DOUBLE_EQ(1.5, average.GetMean().Val);
+    EXPECT_DOUBLE_EQ(2.25, average.GetVariance().Val);
+    EXPECT_EQ(-1.0, minmax.GetMin().Val);
+    EXPECT_EQ(3.0, minmax.GetMax().Val);
+
+    std::stringstream ss;
+    minmax.ToStream(ss, true);
+    EXPECT_NE(std::string::npos, ss.str().find("window: 4 samples"));
+}
+
+TEST(FilterSlidingWindow, Json)
+{
+    const std::string config =
+        "{ \"target\": { \"type\": \"s_A\", \"component\": \"robot\" },"
+        "  \"type\": \"EXTERNAL\","
+        "  \"argument\": { \"input_signal\": \"force\", \"window_samples\": 50, \"window_time\": 0.25 } }";
+    Json::Value json;
+    Json::Reader reader;
+    ASSERT_TRUE(reader.parse(config, json));
+
+    FilterBase * filter = FilterAverage::Create(json);
+    FilterAverage * average = dynamic_cast<FilterAverage *>(filter);
+    ASSERT_TRUE(average != 0);
+    EXPECT_EQ("FilterAverage", average->GetFilterName());
+    EXPECT_EQ(FilterBase::FILTERING_EXTERNAL, average->GetFilteringType());
+    EXPECT_EQ("force", average->GetInputSignalName(0));
+    EXPECT_EQ(SlidingWindowStatistics::WINDOW_TIME, average->GetWindow().GetType());
+    EXPECT_EQ(250000000, average->GetWindow().GetDuration());
+    EXPECT_EQ(50, average->GetWindow().GetMaxSize());
+    delete filter;
+
+    json["argument"].removeMember("window_time");
+    filter = FilterMinMax::Create(json);
+    EXPECT_EQ(SlidingWindowStatistics::WINDOW_COUNT, dynamic_cast<FilterMinMax *>(filter)->GetWindow().GetType());
+    delete filter;
+
+    // Invalid window size falls back to one sample
+    json["argument"]["window_samples"] = 0;
+    filter = FilterMinMax::Create(json);
+    EXPECT_EQ(1, dynamic_cast<FilterMinMax *>(filter)->GetWindow().GetMaxSize());
+    delete filter;
+}
@@ -0,0 +1,95 @@
+//----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2016 Min Yang Jung and Peter Kazanzides
+//
+//----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+
+#include "gtest/gtest.h"
+#include "common/stringTable.h"
+
+#include <sstream>
+
+using namespace SC;
+
+// Hash function that maps every key to the same slot
+struct CollidingHash {
+    size_t operator()(boost::uint32_t key) const { return 7; }
+};
+
+TEST(HashMap, InsertFind)
+{
+    HashMap<boost::uint32_t, int> map;
+    EXPECT_TRUE(map.IsEmpty());
+    EXPECT_EQ(0, map.Find(1));
+
+    // Growth beyond initial capacity
+    for (boost::uint32_t i = 0; i < 1000; ++i)
+        EXPECT_TRUE(map.Insert(i * 3, (int) i));
+    EXPECT_EQ(1000, map.GetSize());
+
+    // Duplicate key: value is not updated
+    EXPECT_FALSE(map.Insert(3, -1));
+
+    for (boost::uint32_t i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(map.Find(i * 3));
+        EXPECT_EQ((int) i, *map.Find(i * 3));
+        EXPECT_EQ(0, map.Find(i * 3 + 1));
+    }
+
+    map.Clear();
+    EXPECT_EQ(0, map.GetSize());
+    EXPECT_EQ(0, map.Find(3));
+}
+
+TEST(HashMap, Collisions)
+{
+    HashMap<boost::uint32_t, int, CollidingHash> map;
+    for (boost::uint32_t i = 0; i < 100; ++i)
+        EXPECT_TRUE(map.Insert(i, (int) i * 2));
+    for (boost::uint32_t i = 0; i < 100; ++i) {
+        ASSERT_TRUE(map.Find(i));
+        EXPECT_EQ((int) i * 2, *map.Find(i));
+    }
+    EXPECT_EQ(0, map.Find(100));
+}
+
+TEST(StringTable, Intern)
+{
+    StringTable table;
+    EXPECT_EQ(0, table.GetSize());
+    EXPECT_EQ(INVALID_STRING_ID, table.Find("a"));
+
+    EXPECT_EQ(0, table.Intern("a"));
+    EXPECT_EQ(1, table.Intern("b"));
+    EXPECT_EQ(0, table.Intern("a"));
+    EXPECT_EQ(2, table.Intern(""));
+    EXPECT_EQ(3, table.GetSize());
+
+    EXPECT_EQ(1, table.Find("b"));
+    EXPECT_EQ("b", table.GetString(1));
+    EXPECT_EQ("", table.GetString(1234));
+
+    // IDs and strings remain stable as the table grows
+    const std::string & a = table.GetString(0);
+    for (int i = 0; i < 10000; ++i) {
+        std::stringstream ss;
+        ss << "signal" << i;
+        EXPECT_EQ((StringIDType) (3 + i), table.Intern(ss.str()));
+    }
+    EXPECT_EQ("a", a);
+    EXPECT_EQ(0, table.Find("a"));
+    EXPECT_EQ(9999 + 3, table.Find("signal9999"));
+    EXPECT_EQ("signal42", table.GetString(42 + 3));
+
+    // Process-wide table
+    EXPECT_EQ(StringTable::GetInstance(), StringTable::GetInstance());
+    const StringIDType id = StringTable::GetInstance()->Intern("testStringTable");
+    EXPECT_EQ(id, StringTable::GetInstance()->Find("testStringTable"));
+}
@@ -0,0 +1,42 @@
+//-----------------------------------------------------------------------------------
+//
+// SAFECASS: Safety Architecture For Engineering Computer-Assisted Surgical Systems
+//
+// Copyright (C) 2012-2016 Min Yang Jung and Peter Kazanzides
+//
+//-----------------------------------------------------------------------------------
+//
+// Created on   : Oct 17, 2026
+// Last revision: Oct 17, 2026
+// Github       : https://github.com/safecass/safecass
+//
+// usage: hbdump [history buffer file]
+//
+#include <iostream>
+
+#include "common/common.h"
+#include "safecass/historyBufferMapped.h"
+
+using namespace SC;
+
+int main(int argc, char * argv[])
+{
+    if (argc != 2) {
+        std::cerr << "usage: " << argv[0] << " [history buffer file]" << std::endl;
+        return 1;
+    }
+
+    // Initialize Google logger (glog)
+    FLAGS_logtostderr = 1;
+    google::InitGoogleLogging(argv[0]);
+
+    HistoryBufferMapped hb;
+    if (!hb.Open(argv[1])) {
+        std::cerr << "Failed to open history buffer file: " << argv[1] << std::endl;
+        return 1;
+    }
+
+    hb.Serialize(std::cout);
+
+    return 0;
+}